@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <utility>
+
+namespace SvBenchmark
+{
+    constexpr int REPEAT_COUNT = 5;
+
+    /**
+     * \brief Runs the given function a few times and keeps the fastest run, so the first run's page faults and cache
+     * misses don't skew the results
+     * \param p_func The function to measure
+     * \param p_reset The function restoring the measured function's initial state before each run. Not measured
+     * \return The fastest run's duration in ms
+     */
+    template <class Func, class Reset>
+    double MeasureBest(Func&& p_func, Reset&& p_reset)
+    {
+        using clock = std::chrono::steady_clock;
+
+        double bestTime = DBL_MAX;
+
+        for (int i = 0; i < REPEAT_COUNT; ++i)
+        {
+            p_reset();
+
+            const clock::time_point start = clock::now();
+            p_func();
+
+            bestTime = std::min(bestTime, std::chrono::duration<double, std::milli>(clock::now() - start).count());
+        }
+
+        return bestTime;
+    }
+
+    /**
+     * \brief Runs the given function a few times and keeps the fastest run
+     * \param p_func The function to measure. Must be safe to run several times in a row
+     * \return The fastest run's duration in ms
+     */
+    template <class Func>
+    double MeasureBest(Func&& p_func)
+    {
+        return MeasureBest(std::forward<Func>(p_func), []
+        {
+        });
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace SvBenchmark
+{
+    /**
+     * \brief Runs the regression checks for bugs which only show up outside of a frame, e.g. during static destruction.
+     * Some checks only fail once main returns, by exiting with a failure code
+     * \return True if every check passed. False otherwise
+     */
+    bool RunRegressions();
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace SvBenchmark
+{
+    /**
+     * \brief Measures the cost of an EventManager::Invoke with 1, 10 and 100 listeners, in ns per invoke
+     */
+    void RunEventBenchmarks();
+
+    /**
+     * \brief Measures the creation, iteration, structural changes and destruction of 1M entities in a World
+     */
+    void RunWorldBenchmarks();
+
+    /**
+     * \brief Measures saving, opening and instantiating a scene of 100k entities
+     */
+    void RunSceneBenchmarks();
+
+    /**
+     * \brief Measures the cost of entering and exiting a profiler zone, enabled and disabled, and of draining the
+     * recorded zones at the end of a frame
+     */
+    void RunProfilerBenchmarks();
+}
@@ -0,0 +1,55 @@
+#include "SurvivantBenchmark/Measure.h"
+#include "SurvivantBenchmark/Suites.h"
+
+#include <SurvivantCore/Debug/Logger.h>
+
+#include <SurvivantTest/EventManager.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace SvBenchmark
+{
+    namespace
+    {
+        using BenchmarkEvent = Core::Event<int>;
+
+        constexpr std::array<int, 3> LISTENER_COUNTS = { 1, 10, 100 };
+
+        // Roughly the same number of listener calls for each count, so every case runs for about as long
+        constexpr int LISTENER_CALL_COUNT = 1 << 22;
+    }
+
+    void RunEventBenchmarks()
+    {
+        for (const int listenerCount : LISTENER_COUNTS)
+        {
+            // A manager per case so the listeners of the previous cases aren't called
+            Core::EventManager eventManager;
+            BenchmarkEvent*    event = eventManager.AddEvent<BenchmarkEvent>(std::make_shared<BenchmarkEvent>());
+
+            uint64_t sum = 0;
+
+            for (int i = 0; i < listenerCount; ++i)
+            {
+                event->AddListener([&sum](const int& p_value)
+                {
+                    sum += static_cast<uint64_t>(p_value);
+                });
+            }
+
+            const int invokeCount = LISTENER_CALL_COUNT / listenerCount;
+
+            const double time = MeasureBest([&]
+            {
+                for (int i = 0; i < invokeCount; ++i)
+                    eventManager.Invoke<BenchmarkEvent>(i);
+            });
+
+            // The sum is logged so the calls can't be optimized away
+            SV_LOG("%-20s %3d listener(s): %8.2f ns per invoke (sum %llu)", "Event invoke", listenerCount,
+                   time * 1e6 / invokeCount, static_cast<unsigned long long>(sum));
+        }
+    }
+}
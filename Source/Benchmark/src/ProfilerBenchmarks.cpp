@@ -0,0 +1,53 @@
+#include "SurvivantBenchmark/Measure.h"
+#include "SurvivantBenchmark/Suites.h"
+
+#include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/Debug/Profiler.h>
+
+using namespace SvCore::Debug;
+
+namespace SvBenchmark
+{
+    namespace
+    {
+        // Fits in a thread's event buffer, so no zone is overwritten before the frame ends
+        constexpr size_t ZONE_COUNT = Profiler::THREAD_BUFFER_CAPACITY / 2;
+
+        void RecordZones()
+        {
+            for (size_t i = 0; i < ZONE_COUNT; ++i)
+            {
+                // The zone class is used directly so the profiler is measured even when the macros are compiled out
+                const ProfileZone zone("Benchmark zone");
+            }
+        }
+
+        void LogTime(const char* p_name, const double p_time)
+        {
+            SV_LOG("%-24s %8.3f ms (%6.2f ns per zone)", p_name, p_time, p_time * 1e6 / ZONE_COUNT);
+        }
+    }
+
+    void RunProfilerBenchmarks()
+    {
+        Profiler&  profiler  = Profiler::GetInstance();
+        const bool isEnabled = Profiler::IsEnabled();
+
+        auto endFrame = [&profiler]
+        {
+            profiler.EndFrame();
+        };
+
+        Profiler::SetEnabled(true);
+
+        LogTime("Profile zone enabled", MeasureBest(RecordZones, endFrame));
+        LogTime("Profiler end frame", MeasureBest(endFrame, RecordZones));
+
+        Profiler::SetEnabled(false);
+
+        LogTime("Profile zone disabled", MeasureBest(RecordZones, endFrame));
+
+        Profiler::SetEnabled(isEnabled);
+        profiler.EndFrame();
+    }
+}
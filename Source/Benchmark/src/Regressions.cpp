@@ -0,0 +1,303 @@
+#include "SurvivantBenchmark/Regressions.h"
+
+#include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/ECS/SceneFile.h>
+#include <SurvivantCore/ECS/SceneWriter.h>
+#include <SurvivantCore/Memory/ConcurrentObjectPool.h>
+
+#include <SurvivantRendering/Utility/MipGenerator.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace SvCore::ECS;
+using namespace SvCore::Memory;
+using namespace SvRendering::Resources;
+using namespace SvRendering::Utility;
+
+namespace SvBenchmark
+{
+    namespace
+    {
+        struct PooledObject
+        {
+            uint64_t m_value;
+        };
+
+        ConcurrentObjectPool<PooledObject>& GetLeakedPool()
+        {
+            // Never destroyed - like the engine's buffer pools, it must outlive the statics freeing its objects
+            static ConcurrentObjectPool<PooledObject>* pool = new ConcurrentObjectPool<PooledObject>("Regressions");
+            return *pool;
+        }
+
+        /**
+         * \brief Frees a pooled object once the main thread's thread-local caches are gone, like the meshes released by
+         * the resource manager singleton
+         */
+        struct StaticPoolHolder
+        {
+            ConcurrentObjectPool<PooledObject>::Ptr m_object;
+
+            ~StaticPoolHolder()
+            {
+                ConcurrentObjectPool<PooledObject>& pool = GetLeakedPool();
+
+                m_object.reset();
+                pool.Delete(pool.New());
+
+                // The logger may already be destroyed
+                if (pool.GetStats().m_liveCount != 0)
+                {
+                    std::fputs("Pooled objects leaked during static destruction\n", stderr);
+                    std::_Exit(EXIT_FAILURE);
+                }
+            }
+        };
+
+        bool CheckPoolStaticDestruction()
+        {
+            static StaticPoolHolder holder;
+
+            ConcurrentObjectPool<PooledObject>& pool = GetLeakedPool();
+
+            // Both frees must find the main thread's cache destroyed, so make sure it exists first
+            pool.Delete(pool.New());
+            holder.m_object = pool.MakeUnique(PooledObject{ 1 });
+
+            return holder.m_object != nullptr;
+        }
+
+        struct SceneNode
+        {
+            float  m_value;
+            Entity m_parent;
+        };
+
+        struct SceneWeight
+        {
+            float m_value;
+        };
+
+        std::string ReadFile(const std::string& p_path)
+        {
+            std::ifstream file(p_path, std::ios::binary);
+            return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        }
+
+        bool OpensAs(const std::string& p_path, const std::string& p_bytes)
+        {
+            std::ofstream(p_path, std::ios::binary | std::ios::trunc).write(p_bytes.data(),
+                static_cast<std::streamsize>(p_bytes.size()));
+
+            SceneFile scene;
+            return scene.Open(p_path);
+        }
+
+        template <class T>
+        T ReadAt(const std::string& p_bytes, const uint64_t p_offset)
+        {
+            T value;
+            std::memcpy(&value, p_bytes.data() + p_offset, sizeof(T));
+            return value;
+        }
+
+        template <class T>
+        void WriteAt(std::string& p_bytes, const uint64_t p_offset, const T& p_value)
+        {
+            std::memcpy(p_bytes.data() + p_offset, &p_value, sizeof(T));
+        }
+
+        bool CheckSceneRoundTrip(const std::string& p_path, const std::string& p_copyPath)
+        {
+            World world;
+
+            const Entity root = world.CreateEntity(SceneNode{ 1.f, Entity() }, SceneWeight{ 2.f });
+            world.CreateEntity(SceneNode{ 3.f, root });
+
+            if (!SaveScene(world, p_path))
+                return false;
+
+            SceneFile scene;
+
+            if (!scene.Open(p_path) || scene.GetEntityCount() != 2)
+                return false;
+
+            World                     loadedWorld;
+            const std::vector<Entity> entities = scene.Instantiate(loadedWorld);
+
+            if (entities.size() != 2)
+                return false;
+
+            const SceneNode*   loadedRoot   = loadedWorld.GetComponent<SceneNode>(entities[0]);
+            const SceneNode*   loadedChild  = loadedWorld.GetComponent<SceneNode>(entities[1]);
+            const SceneWeight* loadedWeight = loadedWorld.GetComponent<SceneWeight>(entities[0]);
+
+            if (!loadedRoot || !loadedChild || !loadedWeight || loadedRoot->m_value != 1.f
+                || loadedChild->m_value != 3.f || loadedChild->m_parent != entities[0] || loadedWeight->m_value != 2.f)
+                return false;
+
+            // Saving the loaded world again must give the same scene
+            SceneFile copy;
+            return SaveScene(loadedWorld, p_copyPath) && copy.Open(p_copyPath)
+                && copy.ExportJson() == scene.ExportJson();
+        }
+
+        bool CheckSceneValidation(const std::string& p_path, const std::string& p_corruptedPath)
+        {
+            using namespace SceneFormat;
+
+            const std::string bytes = ReadFile(p_path);
+
+            if (bytes.size() < sizeof(Header) || !OpensAs(p_corruptedPath, bytes))
+                return false;
+
+            const Header header = ReadAt<Header>(bytes, 0);
+            const Block  block  = ReadAt<Block>(bytes, header.m_blocks.m_offset);
+
+            if (block.m_columns.m_count < 2)
+                return false;
+
+            // Cut in the middle of the tables, with and without the header's size matching the truncated file
+            std::string truncated = bytes.substr(0, header.m_fixups.m_offset + sizeof(Fixup) / 2);
+
+            if (OpensAs(p_corruptedPath, truncated))
+                return false;
+
+            Header truncatedHeader     = header;
+            truncatedHeader.m_fileSize = truncated.size();
+            WriteAt(truncated, 0, truncatedHeader);
+
+            if (OpensAs(p_corruptedPath, truncated))
+                return false;
+
+            // A column over the header, its fixups moved with it, would let the fixups patch the header
+            std::string         overHeader = bytes;
+            Column              column     = ReadAt<Column>(bytes, block.m_columns.m_offset);
+            const ComponentType type       = ReadAt<ComponentType>(bytes,
+                header.m_componentTypes.m_offset + column.m_componentType * sizeof(ComponentType));
+            const uint64_t      dataBegin  = column.m_data;
+            const uint64_t      dataEnd    = dataBegin + static_cast<uint64_t>(block.m_entityCount) * type.m_size;
+
+            column.m_data = 0;
+            WriteAt(overHeader, block.m_columns.m_offset, column);
+
+            for (uint64_t i = 0; i < header.m_fixups.m_count; ++i)
+            {
+                const uint64_t offset = header.m_fixups.m_offset + i * sizeof(Fixup);
+                Fixup          fixup  = ReadAt<Fixup>(bytes, offset);
+
+                if (fixup.m_offset >= dataBegin && fixup.m_offset < dataEnd)
+                {
+                    fixup.m_offset -= dataBegin;
+                    WriteAt(overHeader, offset, fixup);
+                }
+            }
+
+            if (OpensAs(p_corruptedPath, overHeader))
+                return false;
+
+            // Two columns sharing their data
+            std::string    sharedData   = bytes;
+            const uint64_t secondOffset = block.m_columns.m_offset + sizeof(Column);
+            Column         second       = ReadAt<Column>(bytes, secondOffset);
+
+            second.m_data = dataBegin;
+            WriteAt(sharedData, secondOffset, second);
+
+            return !OpensAs(p_corruptedPath, sharedData);
+        }
+
+        bool CheckSceneFiles()
+        {
+            RegisterSerializedComponent<SceneNode>("RegressionSceneNode", {
+                SV_FIELD(SceneNode, m_value, FLOAT), SV_FIELD(SceneNode, m_parent, ENTITY)
+            });
+
+            RegisterSerializedComponent<SceneWeight>("RegressionSceneWeight", {
+                SV_FIELD(SceneWeight, m_value, FLOAT)
+            });
+
+            const std::filesystem::path directory = std::filesystem::temp_directory_path();
+            const std::string           path      = (directory / "SvRegressionScene.svscene").string();
+            const std::string           copyPath  = (directory / "SvRegressionSceneCopy.svscene").string();
+
+            SV_LOG("Scene validation regressions - the following scene errors are expected");
+
+            const bool isSuccess = CheckSceneRoundTrip(path, copyPath) && CheckSceneValidation(path, copyPath);
+
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            std::filesystem::remove(copyPath, error);
+
+            return isSuccess;
+        }
+
+        bool CheckOddMips()
+        {
+            // A single lit texel in the last row and column of an odd sized image must reach every level
+            constexpr int   size      = 5;
+            constexpr float litWeight = 1.f / static_cast<float>(size * size);
+
+            std::vector<uint8_t> pixels(static_cast<size_t>(size) * size);
+            pixels.back() = UINT8_MAX;
+
+            const std::vector<TextureMip> mips = GenerateMips(pixels.data(), size, size, 1, { .m_isSrgb = false });
+
+            if (mips.size() != 3 || mips.back().m_width != 1 || mips.back().m_height != 1)
+                return false;
+
+            const long expected = std::lround(litWeight * UINT8_MAX);
+
+            if (mips.back().m_data.front() != expected || mips[1].m_data.back() == 0)
+                return false;
+
+            // The weights must still sum to 1
+            std::vector<uint8_t> flat(static_cast<size_t>(size) * size, 100);
+
+            for (const TextureMip& mip : GenerateMips(flat.data(), size, size, 1, { .m_isSrgb = false }))
+            {
+                for (const uint8_t value : mip.m_data)
+                {
+                    if (value != 100)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    bool RunRegressions()
+    {
+        bool isSuccess = true;
+
+        if (!CheckPoolStaticDestruction())
+        {
+            SV_LOG_ERROR("Regression failed: pooled object freed during static destruction");
+            isSuccess = false;
+        }
+
+        if (!CheckSceneFiles())
+        {
+            SV_LOG_ERROR("Regression failed: scene round trip or truncated/overlapping scene validation");
+            isSuccess = false;
+        }
+
+        if (!CheckOddMips())
+        {
+            SV_LOG_ERROR("Regression failed: odd sized mips dropped their last row or column");
+            isSuccess = false;
+        }
+
+        return isSuccess;
+    }
+}
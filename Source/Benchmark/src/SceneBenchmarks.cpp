@@ -0,0 +1,101 @@
+#include "SurvivantBenchmark/Measure.h"
+#include "SurvivantBenchmark/Suites.h"
+
+#include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/ECS/SceneFile.h>
+#include <SurvivantCore/ECS/SceneWriter.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace SvCore::ECS;
+
+namespace SvBenchmark
+{
+    namespace
+    {
+        struct SceneTransform
+        {
+            float  m_x, m_y, m_z;
+            Entity m_parent;
+        };
+
+        struct SceneRenderer
+        {
+            uint32_t m_mesh;
+            uint32_t m_material;
+        };
+
+        constexpr size_t SCENE_ENTITY_COUNT = 100000;
+
+        // Every entity is parented to one of the first few, so each transform needs an entity fixup
+        constexpr size_t ROOT_COUNT = 64;
+
+        void LogTime(const char* p_name, const double p_time)
+        {
+            SV_LOG("%-24s %8.3f ms (%6.2f ns per entity)", p_name, p_time, p_time * 1e6 / SCENE_ENTITY_COUNT);
+        }
+    }
+
+    void RunSceneBenchmarks()
+    {
+        RegisterSerializedComponent<SceneTransform>("BenchmarkSceneTransform", {
+            SV_FIELD(SceneTransform, m_x, FLOAT), SV_FIELD(SceneTransform, m_y, FLOAT),
+            SV_FIELD(SceneTransform, m_z, FLOAT), SV_FIELD(SceneTransform, m_parent, ENTITY)
+        });
+
+        RegisterSerializedComponent<SceneRenderer>("BenchmarkSceneRenderer", {
+            SV_FIELD(SceneRenderer, m_mesh, UINT32), SV_FIELD(SceneRenderer, m_material, UINT32)
+        });
+
+        World               world;
+        std::vector<Entity> roots;
+
+        for (size_t i = 0; i < SCENE_ENTITY_COUNT; ++i)
+        {
+            const float  offset = static_cast<float>(i);
+            const Entity parent = i < ROOT_COUNT ? Entity() : roots[i % ROOT_COUNT];
+            Entity       entity;
+
+            if (i % 2 == 0)
+                entity = world.CreateEntity(SceneTransform{ offset, 0.f, -offset, parent }, SceneRenderer{ 1, 2 });
+            else
+                entity = world.CreateEntity(SceneTransform{ offset, 0.f, -offset, parent });
+
+            if (i < ROOT_COUNT)
+                roots.push_back(entity);
+        }
+
+        const std::string path = (std::filesystem::temp_directory_path() / "SvBenchmarkScene.svscene").string();
+
+        LogTime("Scene save", MeasureBest([&]
+        {
+            SaveScene(world, path);
+        }));
+
+        SceneFile scene;
+
+        LogTime("Scene open", MeasureBest([&]
+        {
+            scene.Open(path);
+        }));
+
+        std::unique_ptr<World> loadedWorld;
+
+        LogTime("Scene instantiate", MeasureBest([&]
+        {
+            scene.Instantiate(*loadedWorld);
+        }, [&]
+        {
+            loadedWorld = std::make_unique<World>();
+        }));
+
+        scene.Close();
+
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+}
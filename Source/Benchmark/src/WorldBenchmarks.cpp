@@ -0,0 +1,121 @@
+#include "SurvivantBenchmark/Measure.h"
+#include "SurvivantBenchmark/Suites.h"
+
+#include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/ECS/World.h>
+
+#include <memory>
+#include <vector>
+
+using namespace SvCore::ECS;
+
+namespace SvBenchmark
+{
+    namespace
+    {
+        struct Position
+        {
+            float m_x, m_y, m_z;
+        };
+
+        struct Velocity
+        {
+            float m_x, m_y, m_z;
+        };
+
+        struct Frozen
+        {
+        };
+
+        constexpr size_t ENTITY_COUNT = 1 << 20;
+
+        void LogTime(const char* p_name, const double p_time)
+        {
+            SV_LOG("%-24s %8.3f ms (%6.2f ns per entity)", p_name, p_time, p_time * 1e6 / ENTITY_COUNT);
+        }
+    }
+
+    void RunWorldBenchmarks()
+    {
+        std::unique_ptr<World> world;
+        std::vector<Entity>    entities;
+
+        auto resetWorld = [&]
+        {
+            entities.clear();
+            world = std::make_unique<World>();
+        };
+
+        LogTime("World create", MeasureBest([&]
+        {
+            entities = world->CreateEntities(ENTITY_COUNT, Position{ 0.f, 0.f, 0.f }, Velocity{ 1.f, 2.f, 3.f });
+        }, resetWorld));
+
+        Query<Position, const Velocity> query = world->GetQuery<Position, const Velocity>();
+
+        LogTime("World ForEach", MeasureBest([&]
+        {
+            query.ForEach([](Position& p_position, const Velocity& p_velocity)
+            {
+                p_position.m_x += p_velocity.m_x;
+                p_position.m_y += p_velocity.m_y;
+                p_position.m_z += p_velocity.m_z;
+            });
+        }));
+
+        LogTime("World ForEachChunk", MeasureBest([&]
+        {
+            query.ForEachChunk([](const size_t p_count, const Entity*, Position* p_positions,
+                                  const Velocity* p_velocities)
+            {
+                for (size_t i = 0; i < p_count; ++i)
+                {
+                    p_positions[i].m_x += p_velocities[i].m_x;
+                    p_positions[i].m_y += p_velocities[i].m_y;
+                    p_positions[i].m_z += p_velocities[i].m_z;
+                }
+            });
+        }));
+
+        LogTime("World ParallelForEach", MeasureBest([&]
+        {
+            query.ParallelForEach([](Position& p_position, const Velocity& p_velocity)
+            {
+                p_position.m_x += p_velocity.m_x;
+                p_position.m_y += p_velocity.m_y;
+                p_position.m_z += p_velocity.m_z;
+            });
+        }));
+
+        // Each structural change moves the entity to another archetype
+        LogTime("World add component", MeasureBest([&]
+        {
+            for (const Entity entity : entities)
+                world->AddComponent<Frozen>(entity);
+        }, [&]
+        {
+            for (const Entity entity : entities)
+                world->RemoveComponent<Frozen>(entity);
+        }));
+
+        LogTime("World remove component", MeasureBest([&]
+        {
+            for (const Entity entity : entities)
+                world->RemoveComponent<Frozen>(entity);
+        }, [&]
+        {
+            for (const Entity entity : entities)
+                world->AddComponent<Frozen>(entity);
+        }));
+
+        LogTime("World destroy", MeasureBest([&]
+        {
+            for (const Entity entity : entities)
+                world->DestroyEntity(entity);
+        }, [&]
+        {
+            resetWorld();
+            entities = world->CreateEntities(ENTITY_COUNT, Position{ 0.f, 0.f, 0.f }, Velocity{ 1.f, 2.f, 3.f });
+        }));
+    }
+}
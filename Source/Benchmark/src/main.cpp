@@ -0,0 +1,197 @@
+#include "SurvivantBenchmark/Measure.h"
+#include "SurvivantBenchmark/Regressions.h"
+#include "SurvivantBenchmark/Suites.h"
+
+#include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/Threading/JobSystem.h>
+
+#include <SurvivantRendering/Geometry/BoundingSphere.h>
+#include <SurvivantRendering/Geometry/Frustum.h>
+#include <SurvivantRendering/Utility/BlockCompression.h>
+
+#include <Transform.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace LibMath;
+using namespace SvBenchmark;
+using namespace SvCore::Threading;
+using namespace SvRendering::Geometry;
+using namespace SvRendering::Utility;
+
+constexpr const char* REGRESSIONS_ARG = "--regressions";
+
+constexpr size_t   TRANSFORM_COUNT = 1 << 18;
+constexpr size_t   SPHERE_COUNT    = 1 << 20;
+constexpr int      IMAGE_SIZE      = 1024;
+constexpr size_t   SMALL_JOB_COUNT = 1 << 16;
+constexpr uint32_t BC1_BLOCK_BYTES = 8;
+
+// Runs the workload on the given job system, or serially on the calling thread when there is none
+using Workload = std::function<void(JobSystem*)>;
+
+struct Benchmark
+{
+    const char* m_name;
+    Workload    m_run;
+};
+
+template <class Func>
+void ForEach(JobSystem* p_jobSystem, const size_t p_count, Func&& p_func)
+{
+    if (!p_jobSystem)
+    {
+        for (size_t i = 0; i < p_count; ++i)
+            p_func(i);
+
+        return;
+    }
+
+    p_jobSystem->ParallelFor(0, p_count, std::forward<Func>(p_func));
+}
+
+double Measure(const Workload& p_workload, JobSystem* p_jobSystem)
+{
+    return MeasureBest([&]
+    {
+        p_workload(p_jobSystem);
+    });
+}
+
+int main(const int p_argc, char** p_argv)
+{
+    if (!SvBenchmark::RunRegressions())
+        return EXIT_FAILURE;
+
+    // Only run the checks, e.g. from ctest
+    if (p_argc > 1 && std::strcmp(p_argv[1], REGRESSIONS_ARG) == 0)
+        return EXIT_SUCCESS;
+
+    std::vector<Transform> transforms;
+    std::vector<Matrix4>   matrices(TRANSFORM_COUNT);
+
+    transforms.reserve(TRANSFORM_COUNT);
+
+    for (size_t i = 0; i < TRANSFORM_COUNT; ++i)
+    {
+        const float offset = static_cast<float>(i);
+        transforms.emplace_back(Vector3(offset, offset * .5f, -offset), Quaternion(Radian(offset), Vector3::up()),
+                                Vector3::one());
+    }
+
+    std::vector<BoundingSphere> spheres(SPHERE_COUNT);
+    std::vector<uint8_t>        visibility(SPHERE_COUNT);
+
+    for (size_t i = 0; i < SPHERE_COUNT; ++i)
+    {
+        const float offset = static_cast<float>(i % 1024) - 512.f;
+        spheres[i]         = { Vector3(offset, static_cast<float>(i / 1024 % 64), -offset), 1.f };
+    }
+
+    const Frustum frustum(perspectiveProjection(90_deg, 16.f / 9.f, .01f, 500.f));
+
+    constexpr int blocksPerRow = IMAGE_SIZE / 4;
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(IMAGE_SIZE) * IMAGE_SIZE * 4);
+    std::vector<uint8_t> blocks(static_cast<size_t>(blocksPerRow) * blocksPerRow * BC1_BLOCK_BYTES);
+
+    for (size_t i = 0; i < pixels.size(); ++i)
+        pixels[i] = static_cast<uint8_t>(i * 7 + i / 4096);
+
+    std::atomic<size_t> smallJobSum = 0;
+
+    const std::array<Benchmark, 4> benchmarks
+    {
+        Benchmark{ "Transform matrices", [&](JobSystem* p_jobSystem)
+        {
+            ForEach(p_jobSystem, TRANSFORM_COUNT, [&](const size_t p_index)
+            {
+                matrices[p_index] = transforms[p_index].getMatrix();
+            });
+        } },
+        Benchmark{ "Frustum culling", [&](JobSystem* p_jobSystem)
+        {
+            ForEach(p_jobSystem, SPHERE_COUNT, [&](const size_t p_index)
+            {
+                visibility[p_index] = frustum.Intersects(spheres[p_index]);
+            });
+        } },
+        Benchmark{ "BC1 compression", [&](JobSystem* p_jobSystem)
+        {
+            ForEach(p_jobSystem, static_cast<size_t>(blocksPerRow) * blocksPerRow, [&](const size_t p_index)
+            {
+                const size_t blockX = p_index % blocksPerRow * 4;
+                const size_t blockY = p_index / blocksPerRow * 4;
+
+                std::array<uint8_t, 64> block;
+
+                for (size_t row = 0; row < 4; ++row)
+                    std::memcpy(&block[row * 16], &pixels[((blockY + row) * IMAGE_SIZE + blockX) * 4], 16);
+
+                EncodeBC1Block(block.data(), &blocks[p_index * BC1_BLOCK_BYTES]);
+            });
+        } },
+        Benchmark{ "Small jobs", [&](JobSystem* p_jobSystem)
+        {
+            if (!p_jobSystem)
+            {
+                for (size_t i = 0; i < SMALL_JOB_COUNT; ++i)
+                    smallJobSum.fetch_add(i, std::memory_order_relaxed);
+
+                return;
+            }
+
+            // One scheduled job per item measures the scheduling overhead rather than the work
+            JobCounter counter;
+
+            for (size_t i = 0; i < SMALL_JOB_COUNT; ++i)
+            {
+                p_jobSystem->Schedule([&smallJobSum, i]
+                {
+                    smallJobSum.fetch_add(i, std::memory_order_relaxed);
+                }, &counter);
+            }
+
+            p_jobSystem->Wait(counter);
+        } }
+    };
+
+    // The thread count can be overridden from the command line, e.g. to check oversubscription
+    const uint32_t threadCount = p_argc > 1
+        ? static_cast<uint32_t>(std::max(std::strtoul(p_argv[1], nullptr, 10), 1ul))
+        : std::max(std::thread::hardware_concurrency(), 1u);
+
+    std::array<double, benchmarks.size()> serialTimes{};
+
+    for (size_t i = 0; i < benchmarks.size(); ++i)
+    {
+        serialTimes[i] = Measure(benchmarks[i].m_run, nullptr);
+        SV_LOG("%-20s %2u thread(s): %8.3f ms", benchmarks[i].m_name, 1u, serialTimes[i]);
+    }
+
+    // The main thread takes part in the work, so N threads means N - 1 workers
+    for (uint32_t threads = 2; threads <= threadCount; ++threads)
+    {
+        JobSystem jobSystem(threads - 1);
+
+        for (size_t i = 0; i < benchmarks.size(); ++i)
+        {
+            const double time = Measure(benchmarks[i].m_run, &jobSystem);
+            SV_LOG("%-20s %2u thread(s): %8.3f ms (x%.2f)", benchmarks[i].m_name, threads, time, serialTimes[i] / time);
+        }
+    }
+
+    RunEventBenchmarks();
+    RunWorldBenchmarks();
+    RunSceneBenchmarks();
+    RunProfilerBenchmarks();
+
+    return 0;
+}
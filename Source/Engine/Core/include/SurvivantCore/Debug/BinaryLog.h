@@ -0,0 +1,148 @@
+#pragma once
+#include "SurvivantCore/Enums/ELogArgType.h"
+#include "SurvivantCore/Enums/ELogLevel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace SvCore::Debug
+{
+    /**
+     * \brief Raw copy of printf-style log arguments, formatted later from the format string.\n
+     * Numbers and pointers are widened to 64 bits and strings are copied, truncated to fit the fixed capacity
+     */
+    class LogArguments
+    {
+    public:
+        static constexpr size_t CAPACITY = 256;
+
+        /**
+         * \brief Copies the given arguments
+         * \tparam Args The arguments' types. Must be arithmetic, enum, pointer or C string types
+         * \param p_args The arguments to copy
+         */
+        template <typename... Args>
+        explicit LogArguments(const Args&... p_args);
+
+        /**
+         * \brief Gets the encoded arguments
+         * \return A pointer to the encoded arguments
+         */
+        const std::byte* GetData() const;
+
+        /**
+         * \brief Gets the encoded arguments' size
+         * \return The encoded arguments' size in bytes
+         */
+        size_t GetSize() const;
+
+        /**
+         * \brief Formats the given encoded arguments with the given printf-style format string
+         * \param p_format The format of the message
+         * \param p_data The encoded arguments
+         * \param p_size The encoded arguments' size in bytes
+         * \return The formatted message
+         */
+        static std::string Format(const char* p_format, const std::byte* p_data, size_t p_size);
+
+    private:
+        std::byte m_data[CAPACITY]{};
+        size_t    m_size = 0;
+
+        /**
+         * \brief Encodes the given argument
+         * \tparam T The argument's type
+         * \param p_arg The argument to encode
+         */
+        template <typename T>
+        void Add(const T& p_arg);
+
+        /**
+         * \brief Encodes the given string argument
+         * \param p_string The string to encode. Can be null
+         */
+        void AddString(const char* p_string);
+
+        /**
+         * \brief Appends the given argument's type and value, if they fit
+         * \param p_type The argument's type
+         * \param p_value The argument's value
+         * \param p_size The argument's value size in bytes
+         */
+        void Append(Enums::ELogArgType p_type, const void* p_value, size_t p_size);
+    };
+
+    /**
+     * \brief Log file holding unformatted records, to be formatted offline by DecodeBinaryLog.\n
+     * Format strings and file names are written once in a string table and referenced by id afterward.
+     * Values are stored in the writing machine's byte order
+     */
+    class BinaryLogFile
+    {
+    public:
+        /**
+         * \brief Opens the given file for writing, replacing its content
+         * \param p_filePath The binary log file's path
+         * \return True on success. False otherwise
+         */
+        bool Open(const std::filesystem::path& p_filePath);
+
+        /**
+         * \brief Checks whether the binary log file is open
+         * \return True if the file is open. False otherwise
+         */
+        bool IsOpen() const;
+
+        /**
+         * \brief Writes an unformatted record
+         * \param p_format The record's format string. Must have a static lifetime
+         * \param p_file The file which logged the record. Must have a static lifetime
+         * \param p_line The line which logged the record
+         * \param p_category The record's category name. Must have a static lifetime
+         * \param p_level The record's severity level
+         * \param p_data The record's encoded arguments
+         * \param p_size The encoded arguments' size in bytes
+         */
+        void WriteRecord(const char* p_format, const char* p_file, uint32_t p_line, const char* p_category,
+                         Enums::ELogLevel p_level, const std::byte* p_data, uint16_t p_size);
+
+        /**
+         * \brief Writes an already formatted message
+         * \param p_message The message to write
+         * \param p_level The message's severity level
+         */
+        void WriteText(std::string_view p_message, Enums::ELogLevel p_level);
+
+        /**
+         * \brief Flushes the written records to the file
+         */
+        void Flush();
+
+    private:
+        std::ofstream                             m_file;
+        std::unordered_map<const char*, uint32_t> m_stringIds;
+
+        /**
+         * \brief Gets the id of the given static string, writing it to the string table on first use
+         * \param p_string The string to look up
+         * \return The string's id
+         */
+        uint32_t GetStringId(const char* p_string);
+    };
+
+    /**
+     * \brief Formats the records of a binary log file
+     * \param p_input The binary log's content
+     * \param p_output The stream receiving the formatted messages
+     * \return True on success. False if the binary log is invalid or truncated
+     */
+    bool DecodeBinaryLog(std::istream& p_input, std::ostream& p_output);
+}
+
+#include "SurvivantCore/Debug/BinaryLog.inl"
@@ -0,0 +1,50 @@
+#pragma once
+#include "SurvivantCore/Debug/BinaryLog.h"
+
+#include <type_traits>
+
+namespace SvCore::Debug
+{
+    template <typename... Args>
+    LogArguments::LogArguments(const Args&... p_args)
+    {
+        (Add(p_args), ...);
+    }
+
+    template <typename T>
+    void LogArguments::Add(const T& p_arg)
+    {
+        if constexpr (std::is_same_v<T, const char*> || std::is_same_v<T, char*>)
+        {
+            AddString(p_arg);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            Add(static_cast<std::underlying_type_t<T>>(p_arg));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            const double value = static_cast<double>(p_arg);
+            Append(Enums::ELogArgType::FLOAT, &value, sizeof(value));
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            const int64_t value = static_cast<int64_t>(p_arg);
+            Append(Enums::ELogArgType::INT, &value, sizeof(value));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            const uint64_t value = static_cast<uint64_t>(p_arg);
+            Append(Enums::ELogArgType::UINT, &value, sizeof(value));
+        }
+        else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>)
+        {
+            const uint64_t value = reinterpret_cast<uintptr_t>(static_cast<const void*>(p_arg));
+            Append(Enums::ELogArgType::POINTER, &value, sizeof(value));
+        }
+        else
+        {
+            static_assert(sizeof(T) == 0, "Unsupported log argument type");
+        }
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include "SurvivantCore/Enums/ELogLevel.h"
+
+#include <atomic>
+#include <string_view>
+
+namespace SvCore::Debug
+{
+    /**
+     * \brief Named group of log messages with its own minimum level, checked before any formatting happens.\n
+     * Categories register themselves on construction so their level can be changed by name at runtime
+     */
+    class LogCategory
+    {
+    public:
+        /**
+         * \brief Creates and registers a log category
+         * \param p_name The category's name, shown in front of its messages. Must have a static lifetime
+         * \param p_level The minimum level of the category's logged messages
+         */
+        explicit LogCategory(const char* p_name, Enums::ELogLevel p_level = Enums::ELogLevel::TRACE);
+
+        /**
+         * \brief Disable log category copying
+         */
+        LogCategory(const LogCategory& p_other) = delete;
+
+        /**
+         * \brief Disable log category moving
+         */
+        LogCategory(LogCategory&& p_other) noexcept = delete;
+
+        /**
+         * \brief Unregisters the log category
+         */
+        ~LogCategory();
+
+        /**
+         * \brief Disable log category copying
+         */
+        LogCategory& operator=(const LogCategory& p_other) = delete;
+
+        /**
+         * \brief Disable log category moving
+         */
+        LogCategory& operator=(LogCategory&& p_other) noexcept = delete;
+
+        /**
+         * \brief Gets the category's name
+         * \return The category's name
+         */
+        const char* GetName() const;
+
+        /**
+         * \brief Gets the minimum level of the category's logged messages
+         * \return The category's minimum level
+         */
+        Enums::ELogLevel GetLevel() const;
+
+        /**
+         * \brief Sets the minimum level of the category's logged messages
+         * \param p_level The category's new minimum level
+         */
+        void SetLevel(Enums::ELogLevel p_level);
+
+        /**
+         * \brief Checks whether messages of the given level pass both the category's and the global minimum level
+         * \param p_level The message's level
+         * \return True if the message should be logged. False otherwise
+         */
+        inline bool IsEnabled(Enums::ELogLevel p_level) const;
+
+        /**
+         * \brief Sets the minimum level of the registered category with the given name
+         * \param p_name The category's name
+         * \param p_level The category's new minimum level
+         * \return True if the category was found. False otherwise
+         */
+        static bool SetLevel(std::string_view p_name, Enums::ELogLevel p_level);
+
+        /**
+         * \brief Sets the minimum level of every message, whatever its category
+         * \param p_level The new global minimum level
+         */
+        static void SetGlobalLevel(Enums::ELogLevel p_level);
+
+        /**
+         * \brief Gets the minimum level of every message, whatever its category
+         * \return The global minimum level
+         */
+        static Enums::ELogLevel GetGlobalLevel();
+
+        /**
+         * \brief Accessor to the category used by messages logged without one. It has no name
+         * \return A reference to the default log category
+         */
+        static LogCategory& GetDefault();
+
+    private:
+        static std::atomic<Enums::ELogLevel> s_globalLevel;
+
+        const char*                   m_name;
+        std::atomic<Enums::ELogLevel> m_level;
+    };
+}
+
+#include "SurvivantCore/Debug/LogCategory.inl"
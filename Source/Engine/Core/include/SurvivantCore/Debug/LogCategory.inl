@@ -0,0 +1,10 @@
+#pragma once
+#include "SurvivantCore/Debug/LogCategory.h"
+
+namespace SvCore::Debug
+{
+    inline bool LogCategory::IsEnabled(const Enums::ELogLevel p_level) const
+    {
+        return p_level >= m_level.load(std::memory_order_relaxed) && p_level >= s_globalLevel.load(std::memory_order_relaxed);
+    }
+}
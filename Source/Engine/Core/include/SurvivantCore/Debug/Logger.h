@@ -1,30 +1,188 @@
 #pragma once
+#include "SurvivantCore/Debug/BinaryLog.h"
+#include "SurvivantCore/Debug/LogCategory.h"
+#include "SurvivantCore/Enums/ELogLevel.h"
+#include "SurvivantCore/Enums/ELogOverflow.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+#define SV_LOG_LEVEL_TRACE   0
+#define SV_LOG_LEVEL_DEBUG   1
+#define SV_LOG_LEVEL_INFO    2
+#define SV_LOG_LEVEL_WARNING 3
+#define SV_LOG_LEVEL_SEVERE  4
+
+// Messages below this level are compiled out - their arguments aren't even evaluated
+#ifndef SV_LOG_MIN_LEVEL
+#if defined(_DEBUG) || defined(SV_VERBOSE_LOG)
+#define SV_LOG_MIN_LEVEL SV_LOG_LEVEL_TRACE
+#else
+#define SV_LOG_MIN_LEVEL SV_LOG_LEVEL_INFO
+#endif // _DEBUG || SV_VERBOSE_LOG
+#endif // !SV_LOG_MIN_LEVEL
 
 #ifndef SV_LOG
-#define SV_LOG(format, ...) SvCore::Debug::Logger::GetInstance().DebugLog(__FILE__, __LINE__, format, false, ##__VA_ARGS__)
-#define SV_LOG_ERROR(format, ...) SvCore::Debug::Logger::GetInstance().DebugLog(__FILE__, __LINE__, format, true, ##__VA_ARGS__)
+
+// The level is checked before the arguments are evaluated. The format must be a string literal - deferred formatting
+// keeps a pointer to it
+#define SV_LOG_MESSAGE(category, level, format, ...) ((category).IsEnabled(SvCore::Enums::ELogLevel::level)      \
+    ? SvCore::Debug::Logger::GetInstance().DebugLog(__FILE__, __LINE__, category, SvCore::Enums::ELogLevel::level, \
+        "" format, ##__VA_ARGS__)                                                                               \
+    : (void)0)
+
+#if SV_LOG_MIN_LEVEL <= SV_LOG_LEVEL_TRACE
+#define SV_LOG_CATEGORY_TRACE(category, format, ...) SV_LOG_MESSAGE(category, TRACE, format, ##__VA_ARGS__)
+#else
+#define SV_LOG_CATEGORY_TRACE(category, format, ...) ((void)0)
+#endif
+
+#if SV_LOG_MIN_LEVEL <= SV_LOG_LEVEL_DEBUG
+#define SV_LOG_CATEGORY_DEBUG(category, format, ...) SV_LOG_MESSAGE(category, DEBUG, format, ##__VA_ARGS__)
+#else
+#define SV_LOG_CATEGORY_DEBUG(category, format, ...) ((void)0)
+#endif
+
+#if SV_LOG_MIN_LEVEL <= SV_LOG_LEVEL_INFO
+#define SV_LOG_CATEGORY_INFO(category, format, ...) SV_LOG_MESSAGE(category, INFO, format, ##__VA_ARGS__)
+#else
+#define SV_LOG_CATEGORY_INFO(category, format, ...) ((void)0)
+#endif
+
+#if SV_LOG_MIN_LEVEL <= SV_LOG_LEVEL_WARNING
+#define SV_LOG_CATEGORY_WARNING(category, format, ...) SV_LOG_MESSAGE(category, WARNING, format, ##__VA_ARGS__)
+#else
+#define SV_LOG_CATEGORY_WARNING(category, format, ...) ((void)0)
+#endif
+
+#if SV_LOG_MIN_LEVEL <= SV_LOG_LEVEL_SEVERE
+#define SV_LOG_CATEGORY_ERROR(category, format, ...) SV_LOG_MESSAGE(category, SEVERE, format, ##__VA_ARGS__)
+#else
+#define SV_LOG_CATEGORY_ERROR(category, format, ...) ((void)0)
+#endif
+
+#define SV_LOG_TRACE(format, ...) SV_LOG_CATEGORY_TRACE(SvCore::Debug::LogCategory::GetDefault(), format, ##__VA_ARGS__)
+#define SV_LOG_DEBUG(format, ...) SV_LOG_CATEGORY_DEBUG(SvCore::Debug::LogCategory::GetDefault(), format, ##__VA_ARGS__)
+#define SV_LOG_INFO(format, ...) SV_LOG_CATEGORY_INFO(SvCore::Debug::LogCategory::GetDefault(), format, ##__VA_ARGS__)
+#define SV_LOG_WARNING(format, ...) SV_LOG_CATEGORY_WARNING(SvCore::Debug::LogCategory::GetDefault(), format, ##__VA_ARGS__)
+#define SV_LOG_ERROR(format, ...) SV_LOG_CATEGORY_ERROR(SvCore::Debug::LogCategory::GetDefault(), format, ##__VA_ARGS__)
+#define SV_LOG(format, ...) SV_LOG_INFO(format, ##__VA_ARGS__)
+
 #endif //SV_LOG
 
+namespace SvCore::Threading
+{
+    template <class T>
+    class MpscRingBuffer;
+}
+
 namespace SvCore::Debug
 {
+    /**
+     * \brief Writes log messages to the console and an optional log file.\n
+     * By default messages are written and flushed by the calling thread. In asynchronous mode, callers only copy the
+     * message into a lock-free ring buffer and a background thread writes them in batches to a file kept open.\n
+     * With deferred formatting, SV_LOG calls only copy the format pointer, source location and raw arguments, leaving the
+     * formatting to the background thread or to DecodeBinaryLog
+     */
     class Logger
     {
     public:
-        Logger()                          = default;
-        Logger(const Logger& p_other)     = default;
-        Logger(Logger&& p_other) noexcept = default;
-        ~Logger()                         = default;
+        static constexpr size_t DEFAULT_BUFFER_CAPACITY = 1024;
+
+        /**
+         * \brief Creates a synchronous logger with no log file
+         */
+        Logger();
+
+        /**
+         * \brief Disable logger copying
+         */
+        Logger(const Logger& p_other) = delete;
+
+        /**
+         * \brief Disable logger moving
+         */
+        Logger(Logger&& p_other) noexcept = delete;
+
+        /**
+         * \brief Writes the pending messages and closes the log file
+         */
+        ~Logger();
 
-        Logger& operator=(const Logger& p_other)     = default;
-        Logger& operator=(Logger&& p_other) noexcept = default;
+        /**
+         * \brief Disable logger copying
+         */
+        Logger& operator=(const Logger& p_other) = delete;
 
         /**
-         * \brief Sets the given file as the log output.
+         * \brief Disable logger moving
+         */
+        Logger& operator=(Logger&& p_other) noexcept = delete;
+
+        /**
+         * \brief Sets the given file as the log output. The file stays open until it is replaced or the logger is destroyed
          * \param p_filePath The log file's path
          */
-        inline void SetFile(const std::filesystem::path& p_filePath);
+        void SetFile(const std::filesystem::path& p_filePath);
+
+        /**
+         * \brief Also writes every message to the given binary log file. Records logged with deferred formatting are
+         * stored unformatted, to be read back with DecodeBinaryLog
+         * \param p_filePath The binary log file's path. Replaced if it exists
+         */
+        void SetBinaryFile(const std::filesystem::path& p_filePath);
+
+        /**
+         * \brief Sets whether SV_LOG calls defer formatting to the background writer. Only applies in asynchronous mode
+         * \param p_isDeferred Whether formatting should be deferred or not
+         */
+        void SetDeferredFormatting(bool p_isDeferred);
+
+        /**
+         * \brief Starts writing messages from a background thread. Pending messages are also written if the program
+         * aborts or crashes. Should be called once, before other threads start logging
+         * \param p_overflow What to do with new messages when the buffer is full
+         * \param p_capacity The maximum number of pending messages. Must be a power of two
+         */
+        void StartAsync(Enums::ELogOverflow p_overflow = Enums::ELogOverflow::DROP, size_t p_capacity = DEFAULT_BUFFER_CAPACITY);
+
+        /**
+         * \brief Writes the pending messages, stops the background thread and goes back to synchronous logging
+         */
+        void StopAsync();
+
+        /**
+         * \brief Waits until every message logged before the call is written and flushed
+         */
+        void Flush();
+
+        /**
+         * \brief Writes what it can of the pending messages without blocking, for crash handlers. Waits for the
+         * background thread with a timeout, then writes the messages it left straight to the standard error, unless
+         * another thread holds the output. Never blocks or allocates, but the output's try_lock and the steady clock
+         * aren't async-signal-safe, so it's meant for crash handlers rather than POSIX signal handlers
+         */
+        void FlushOnCrash();
+
+        /**
+         * \brief Checks whether messages are written from a background thread
+         * \return True if the logger is asynchronous. False otherwise
+         */
+        bool IsAsync() const;
+
+        /**
+         * \brief Gets the number of messages dropped because the buffer was full
+         * \return The number of dropped messages since the asynchronous mode was started
+         */
+        size_t GetDroppedCount() const;
 
         /**
          * \brief Logs a message with the given format following printf's syntax.
@@ -38,25 +196,114 @@ namespace SvCore::Debug
 
         /**
          * \brief Logs a message with the given format following printf's syntax.
-         * Appends the given file path and line at the beginning of the message
+         * Appends the given file path and line, and the category's name, at the beginning of the message.
+         * Doesn't filter the message - use the SV_LOG macros to skip disabled levels before evaluating the arguments
          * \tparam Args The arguments to insert into the format string
          * \param p_file The file for which the function was called
          * \param p_line The line for which the function was called
+         * \param p_category The message's category
+         * \param p_level The message's severity level
          * \param p_format The format of the message
-         * \param p_isError Whether the message is an error message or not
          * \param p_args Additional arguments to insert into the message
          */
         template <typename... Args>
-        void DebugLog(const char* p_file, size_t p_line, const char* p_format, bool p_isError, Args... p_args);
+        void DebugLog(const char* p_file, size_t p_line, const LogCategory& p_category, Enums::ELogLevel p_level,
+                      const char* p_format, Args... p_args);
 
         /**
         * \brief Accessor to the Logger singleton
         * \return A reference to the current Logger instance
         */
-        inline static Logger& GetInstance();
+        static Logger& GetInstance();
 
     private:
-        std::filesystem::path m_filePath;
+        struct Record;
+
+        static constexpr std::chrono::milliseconds WRITE_INTERVAL{ 10 };
+        static constexpr std::chrono::milliseconds FLUSH_TIMEOUT{ 500 };
+
+        std::ofstream                                      m_file;
+        BinaryLogFile                                      m_binaryFile;
+        std::mutex                                         m_outputMutex;
+        std::unique_ptr<Threading::MpscRingBuffer<Record>> m_records;
+        std::thread                                        m_writer;
+        std::mutex                                         m_writerMutex;
+        std::condition_variable                            m_writerCondition;
+        std::atomic<bool>                                  m_isAsync       = false;
+        std::atomic<bool>                                  m_isDeferred    = false;
+        std::atomic<bool>                                  m_isRunning     = false;
+        std::atomic<bool>                                  m_isWakeQueued  = false;
+        std::atomic<size_t>                                m_writtenCount  = 0;
+        std::atomic<size_t>                                m_droppedCount  = 0;
+        size_t                                             m_reportedDrops = 0;
+        Enums::ELogOverflow                                m_overflow      = Enums::ELogOverflow::DROP;
+
+        /**
+         * \brief Adds the source location and category in front of the given formatted message
+         * \param p_file The file for which the message was logged
+         * \param p_line The line for which the message was logged
+         * \param p_category The message's category name. Empty for the default category
+         * \param p_message The formatted message
+         * \return The decorated message
+         */
+        static std::string Decorate(const char* p_file, size_t p_line, const char* p_category, const std::string& p_message);
+
+        /**
+         * \brief Writes the given message, or queues it in asynchronous mode
+         * \param p_message The message to log
+         * \param p_level The message's severity level
+         */
+        void Write(std::string_view p_message, Enums::ELogLevel p_level);
+
+        /**
+         * \brief Queues an unformatted message
+         * \param p_file The file for which the message was logged
+         * \param p_line The line for which the message was logged
+         * \param p_category The message's category name. Must have a static lifetime
+         * \param p_level The message's severity level
+         * \param p_format The format of the message. Must have a static lifetime
+         * \param p_arguments The message's raw arguments
+         */
+        void WriteDeferred(const char* p_file, size_t p_line, const char* p_category, Enums::ELogLevel p_level,
+                           const char* p_format, const LogArguments& p_arguments);
+
+        /**
+         * \brief Pushes a record filled by the given function, applying the overflow policy if the buffer is full
+         * \tparam Func The filling function's type. Must be callable as `void(Record&)`
+         * \param p_fill The function writing the record
+         * \param p_level The record's severity level
+         */
+        template <class Func>
+        void Push(const Func& p_fill, Enums::ELogLevel p_level);
+
+        /**
+         * \brief Formats the given queued record if needed and writes it to every output. Background writer only
+         * \param p_record The record to write
+         */
+        void WriteRecord(const Record& p_record);
+
+        /**
+         * \brief Writes the given message to the console and the log file. Warnings and errors go to the error stream
+         * \param p_message The message to write
+         * \param p_level The message's severity level
+         */
+        void Output(std::string_view p_message, Enums::ELogLevel p_level);
+
+        /**
+         * \brief Wakes the background writer up
+         */
+        void Wake();
+
+        /**
+         * \brief Writes every queued message until the logger leaves asynchronous mode
+         */
+        void WriterLoop();
+
+        /**
+         * \brief Writes the queued messages and flushes the outputs. Background writer only
+         * \return The number of written messages
+         */
+        size_t WritePending();
     };
 }
 
@@ -0,0 +1,283 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define SV_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SV_PROFILE_CONCAT(a, b) SV_PROFILE_CONCAT_IMPL(a, b)
+
+#ifndef SV_DISABLE_PROFILER
+// The zone's name must be a string literal - events keep a pointer to it
+#define SV_PROFILE_SCOPE(name) const SvCore::Debug::ProfileZone SV_PROFILE_CONCAT(svProfileZone, __LINE__)("" name)
+#define SV_PROFILE_FUNCTION() const SvCore::Debug::ProfileZone SV_PROFILE_CONCAT(svProfileZone, __LINE__)(__func__)
+#else
+#define SV_PROFILE_SCOPE(name) ((void)0)
+#define SV_PROFILE_FUNCTION() ((void)0)
+#endif // !SV_DISABLE_PROFILER
+
+namespace SvCore::Debug
+{
+    /**
+     * \brief A finished profiling zone
+     */
+    struct ProfileEvent
+    {
+        const char* m_name;
+        uint64_t    m_start;
+        uint64_t    m_end;
+        uint32_t    m_depth;
+        uint32_t    m_thread;
+    };
+
+    /**
+     * \brief The timings of a zone over a frame, aggregated by call path
+     */
+    struct ProfileZoneStats
+    {
+        const char* m_name;
+        uint32_t    m_thread;
+        uint32_t    m_depth;
+        uint32_t    m_callCount;
+        double      m_totalMs;
+        double      m_selfMs;
+    };
+
+    /**
+     * \brief Times the scope it lives in. Use the SV_PROFILE_SCOPE and SV_PROFILE_FUNCTION macros.\n
+     * A zone must end on the thread it started on - don't keep one alive across a co_await
+     */
+    class ProfileZone
+    {
+    public:
+        /**
+         * \brief Starts a profiling zone
+         * \param p_name The zone's name. Must have a static lifetime
+         */
+        explicit ProfileZone(const char* p_name);
+
+        /**
+         * \brief Disable profile zone copying
+         */
+        ProfileZone(const ProfileZone& p_other) = delete;
+
+        /**
+         * \brief Disable profile zone moving
+         */
+        ProfileZone(ProfileZone&& p_other) noexcept = delete;
+
+        /**
+         * \brief Ends the profiling zone and records it in the calling thread's event buffer
+         */
+        ~ProfileZone();
+
+        /**
+         * \brief Disable profile zone copying
+         */
+        ProfileZone& operator=(const ProfileZone& p_other) = delete;
+
+        /**
+         * \brief Disable profile zone moving
+         */
+        ProfileZone& operator=(ProfileZone&& p_other) noexcept = delete;
+
+    private:
+        const char* m_name;
+        uint64_t    m_start;
+    };
+
+    /**
+     * \brief Hierarchical CPU profiler.\n
+     * Zones are timestamped with the CPU's time stamp counter when available and recorded in per-thread ring buffers
+     * without locking. Once per frame, the main thread drains the buffers to aggregate the frame's zones by call path
+     * and, during a capture, to keep the raw events for a Chrome trace export (viewable in Perfetto)
+     */
+    class Profiler
+    {
+    public:
+        static constexpr size_t THREAD_BUFFER_CAPACITY = 8192;
+        static constexpr size_t MAX_CAPTURE_EVENTS     = 1 << 20;
+
+        /**
+         * \brief Disable profiler copying
+         */
+        Profiler(const Profiler& p_other) = delete;
+
+        /**
+         * \brief Disable profiler moving
+         */
+        Profiler(Profiler&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the profiler
+         */
+        ~Profiler();
+
+        /**
+         * \brief Disable profiler copying
+         */
+        Profiler& operator=(const Profiler& p_other) = delete;
+
+        /**
+         * \brief Disable profiler moving
+         */
+        Profiler& operator=(Profiler&& p_other) noexcept = delete;
+
+        /**
+         * \brief Gets the current profiler timestamp
+         * \return The current timestamp in profiler ticks
+         */
+        static uint64_t GetTimestamp();
+
+        /**
+         * \brief Converts the given profiler tick count to milliseconds
+         * \param p_ticks The tick count to convert
+         * \return The given duration in milliseconds
+         */
+        double ToMilliseconds(uint64_t p_ticks) const;
+
+        /**
+         * \brief Converts the given duration in milliseconds to profiler ticks
+         * \param p_milliseconds The duration to convert
+         * \return The given duration in profiler ticks
+         */
+        int64_t ToTicks(double p_milliseconds) const;
+
+        /**
+         * \brief Sets whether zones are recorded or not
+         * \param p_isEnabled Whether the profiler should be enabled or not
+         */
+        static void SetEnabled(bool p_isEnabled);
+
+        /**
+         * \brief Checks whether zones are recorded
+         * \return True if the profiler is enabled. False otherwise
+         */
+        static bool IsEnabled();
+
+        /**
+         * \brief Sets the name the calling thread is shown with in exported traces
+         * \param p_name The calling thread's name
+         */
+        void SetThreadName(const std::string& p_name);
+
+        /**
+         * \brief Adds a track for zones that aren't timed by a CPU thread (e.g. GPU zones)
+         * \param p_name The name the track is shown with in exported traces
+         * \return The new track's index
+         */
+        uint32_t AddTrack(const std::string& p_name);
+
+        /**
+         * \brief Records an externally timed zone in the given track.\n
+         * A track's events must all be recorded from the same thread
+         * \param p_track The index of the track to record the zone in
+         * \param p_name The zone's name. Must have a static lifetime
+         * \param p_start The zone's start timestamp in profiler ticks
+         * \param p_end The zone's end timestamp in profiler ticks
+         * \param p_depth The zone's depth in its track
+         */
+        void RecordEvent(uint32_t p_track, const char* p_name, uint64_t p_start, uint64_t p_end, uint32_t p_depth);
+
+        /**
+         * \brief Closes the current frame: drains every thread's events and aggregates the frame's zones. Main thread only
+         */
+        void EndFrame();
+
+        /**
+         * \brief Gets the zones of the last ended frame, in call order
+         * \return The last frame's aggregated zones
+         */
+        const std::vector<ProfileZoneStats>& GetFrameZones() const;
+
+        /**
+         * \brief Gets the duration of the last ended frame
+         * \return The last frame's duration in milliseconds
+         */
+        double GetFrameTime() const;
+
+        /**
+         * \brief Gets the number of events lost because a thread's buffer wasn't drained in time
+         * \return The number of lost events
+         */
+        size_t GetLostEventCount() const;
+
+        /**
+         * \brief Starts keeping every recorded event for a trace export
+         */
+        void BeginCapture();
+
+        /**
+         * \brief Stops the current capture and writes it to the given file in the Chrome Trace Event format
+         * \param p_filePath The trace file's path
+         * \return True on success. False otherwise
+         */
+        bool EndCapture(const std::filesystem::path& p_filePath);
+
+        /**
+         * \brief Checks whether events are being captured
+         * \return True if a capture is in progress. False otherwise
+         */
+        bool IsCapturing() const;
+
+        /**
+         * \brief Accessor to the Profiler singleton
+         * \return A reference to the current Profiler instance
+         */
+        static Profiler& GetInstance();
+
+    private:
+        friend class ProfileZone;
+
+        struct ThreadBuffer;
+
+        static std::atomic<bool> s_isEnabled;
+
+        std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers;
+        std::mutex                                 m_bufferMutex;
+        std::mutex                                 m_drainMutex;
+        std::vector<ProfileEvent>                  m_frameEvents;
+        std::vector<ProfileZoneStats>              m_frameZones;
+        std::vector<ProfileEvent>                  m_captureEvents;
+        std::vector<uint64_t>                      m_captureFrames;
+        std::atomic<bool>                          m_isCapturing    = false;
+        size_t                                     m_lostEventCount = 0;
+        uint64_t                                   m_startTicks;
+        uint64_t                                   m_frameStart;
+        double                                     m_frameTime      = 0;
+        double                                     m_ticksPerMs     = 1;
+        std::chrono::steady_clock::time_point      m_startTime;
+
+        /**
+         * \brief Creates the profiler and calibrates its clock
+         */
+        Profiler();
+
+        /**
+         * \brief Gets the calling thread's event buffer, creating it on first use
+         * \return The calling thread's event buffer
+         */
+        ThreadBuffer& GetThreadBuffer();
+
+        /**
+         * \brief Moves every thread's new events to the given list
+         * \param p_out The list receiving the events
+         */
+        void Drain(std::vector<ProfileEvent>& p_out);
+
+        /**
+         * \brief Aggregates the given events by thread and call path into the frame's zones
+         * \param p_events The frame's events
+         */
+        void Aggregate(std::vector<ProfileEvent>& p_events);
+
+        /**
+         * \brief Refines the tick duration using the whole time elapsed since the profiler's creation
+         */
+        void Calibrate();
+    };
+}
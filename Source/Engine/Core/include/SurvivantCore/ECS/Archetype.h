@@ -0,0 +1,242 @@
+#pragma once
+#include "SurvivantCore/ECS/Component.h"
+#include "SurvivantCore/ECS/Entity.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Storage of every entity with a given set of components.\n
+     * Entities are packed in fixed-size chunks laid out as structures of arrays: each chunk holds an array of entities
+     * followed by one array per component type. Removed rows are filled with the archetype's last row, so rows stay
+     * packed at the start of the archetype
+     */
+    class Archetype
+    {
+    public:
+        static constexpr size_t   CHUNK_SIZE     = 16 * 1024;
+        static constexpr size_t   CHUNK_ALIGN    = 64;
+        static constexpr uint32_t INVALID_COLUMN = UINT32_MAX;
+
+        struct Chunk
+        {
+            std::byte* m_data  = nullptr;
+            uint32_t   m_count = 0;
+        };
+
+        /**
+         * \brief Creates an empty archetype for the given component types
+         * \param p_mask The archetype's component types
+         */
+        explicit Archetype(const ComponentMask& p_mask);
+
+        /**
+         * \brief Disable archetype copying
+         */
+        Archetype(const Archetype& p_other) = delete;
+
+        /**
+         * \brief Disable archetype moving
+         */
+        Archetype(Archetype&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the archetype's components and frees its chunks
+         */
+        ~Archetype();
+
+        /**
+         * \brief Disable archetype copying
+         */
+        Archetype& operator=(const Archetype& p_other) = delete;
+
+        /**
+         * \brief Disable archetype moving
+         */
+        Archetype& operator=(Archetype&& p_other) noexcept = delete;
+
+        /**
+         * \brief Adds a row for the given entity, adding a chunk if needed. The row's components are left uninitialized
+         * \param p_entity The row's entity
+         * \return The new row's index
+         */
+        uint32_t AddRow(Entity p_entity);
+
+        /**
+         * \brief Destroys the given row's components and moves the last row in its place
+         * \param p_row The row to remove
+         * \return The entity moved to the removed row. Invalid if the removed row was the last one
+         */
+        Entity RemoveRow(uint32_t p_row);
+
+        /**
+         * \brief Moves the given row's components to a new row of another archetype, then removes the row.\n
+         * The destination's components missing from this archetype are left uninitialized
+         * \param p_row The row to move
+         * \param p_destination The archetype to move the row to
+         * \param p_movedEntity Output for the entity moved to the removed row. Invalid if the row was the last one
+         * \return The row's index in the destination archetype
+         */
+        uint32_t MoveRow(uint32_t p_row, Archetype& p_destination, Entity& p_movedEntity);
+
+        /**
+         * \brief Gets the archetype's component types
+         * \return The archetype's component mask
+         */
+        const ComponentMask& GetMask() const;
+
+        /**
+         * \brief Gets the column holding the given component type
+         * \param p_id The component type's id
+         * \return The component's column. INVALID_COLUMN if the archetype doesn't have the component
+         */
+        uint32_t GetColumn(ComponentId p_id) const;
+
+        /**
+         * \brief Gets the info of the component type stored in the given column
+         * \param p_column The column's index
+         * \return The column's component info
+         */
+        const ComponentInfo& GetColumnInfo(uint32_t p_column) const;
+
+        /**
+         * \brief Gets the number of component columns
+         * \return The number of component types in the archetype
+         */
+        uint32_t GetColumnCount() const;
+
+        /**
+         * \brief Gets the given row's component
+         * \param p_row The row's index
+         * \param p_column The component's column
+         * \return A pointer to the component
+         */
+        void* GetComponent(uint32_t p_row, uint32_t p_column) const;
+
+        /**
+         * \brief Gets the given row's entity
+         * \param p_row The row's index
+         * \return The row's entity
+         */
+        Entity GetEntity(uint32_t p_row) const;
+
+        /**
+         * \brief Gets the archetype's chunks
+         * \return The archetype's chunks. Only the last non-empty chunk can be partially filled, and it can be
+         * followed by an empty one
+         */
+        const std::vector<Chunk>& GetChunks() const;
+
+        /**
+         * \brief Gets the given chunk's entity array
+         * \param p_chunk The chunk
+         * \return The chunk's entities
+         */
+        const Entity* GetEntities(const Chunk& p_chunk) const;
+
+        /**
+         * \brief Gets the given chunk's array of components for the given column
+         * \param p_chunk The chunk
+         * \param p_column The component's column
+         * \return The chunk's components
+         */
+        void* GetComponents(const Chunk& p_chunk, uint32_t p_column) const;
+
+        /**
+         * \brief Gets the number of rows per chunk
+         * \return The archetype's chunk capacity
+         */
+        uint32_t GetChunkCapacity() const;
+
+        /**
+         * \brief Gets the number of rows in the archetype
+         * \return The archetype's entity count
+         */
+        size_t GetEntityCount() const;
+
+        /**
+         * \brief Gets the archetype reached by adding the given component type. Cached by the world
+         * \param p_id The added component type's id
+         * \return The cached archetype. Nullptr if not cached yet
+         */
+        Archetype* GetAddEdge(ComponentId p_id) const;
+
+        /**
+         * \brief Gets the archetype reached by removing the given component type. Cached by the world
+         * \param p_id The removed component type's id
+         * \return The cached archetype. Nullptr if not cached yet
+         */
+        Archetype* GetRemoveEdge(ComponentId p_id) const;
+
+        /**
+         * \brief Caches the archetype reached by adding the given component type
+         * \param p_id The added component type's id
+         * \param p_archetype The archetype with the added component
+         */
+        void SetAddEdge(ComponentId p_id, Archetype* p_archetype);
+
+        /**
+         * \brief Caches the archetype reached by removing the given component type
+         * \param p_id The removed component type's id
+         * \param p_archetype The archetype without the removed component
+         */
+        void SetRemoveEdge(ComponentId p_id, Archetype* p_archetype);
+
+    private:
+        struct RowLocation
+        {
+            std::byte* m_data;
+            uint32_t   m_index;
+        };
+
+        ComponentMask                               m_mask;
+        std::vector<const ComponentInfo*>           m_infos;
+        std::vector<size_t>                         m_offsets;
+        std::array<uint32_t, MAX_COMPONENT_COUNT>   m_columns;
+        std::array<Archetype*, MAX_COMPONENT_COUNT> m_addEdges{};
+        std::array<Archetype*, MAX_COMPONENT_COUNT> m_removeEdges{};
+        std::vector<Chunk>                          m_chunks;
+        size_t                                      m_chunkSize     = CHUNK_SIZE;
+        uint32_t                                    m_chunkCapacity = 0;
+        size_t                                      m_entityCount   = 0;
+
+        /**
+         * \brief Finds the chunk holding the given row
+         * \param p_row The row's index
+         * \return The row's chunk data and index in the chunk
+         */
+        RowLocation Locate(uint32_t p_row) const;
+
+        /**
+         * \brief Gets the component of the row at the given location
+         * \param p_location The row's location
+         * \param p_column The component's column
+         * \return A pointer to the component
+         */
+        void* GetComponent(const RowLocation& p_location, uint32_t p_column) const;
+
+        /**
+         * \brief Computes the offset of each component array for the given chunk capacity
+         * \param p_capacity The number of rows per chunk
+         * \return The chunk's size in bytes
+         */
+        size_t ComputeLayout(uint32_t p_capacity);
+
+        /**
+         * \brief Destroys the components of the given row
+         * \param p_row The row's index
+         */
+        void DestroyRow(uint32_t p_row);
+
+        /**
+         * \brief Moves the last row to the given one, then frees the last chunk if it got empty
+         * \param p_row The row to fill
+         * \return The moved entity. Invalid if the given row was the last one
+         */
+        Entity FillRow(uint32_t p_row);
+    };
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/**
+ * \brief Stores the given component type in sparse sets instead of archetypes. Must be used in the global namespace
+ */
+#define SV_SPARSE_COMPONENT(type) template <> struct SvCore::ECS::IsSparseComponent<type> : std::true_type {}
+
+namespace SvCore::ECS
+{
+    class ISparseSet;
+
+    using ComponentId = uint32_t;
+
+    constexpr size_t MAX_COMPONENT_COUNT = 64;
+
+    using ComponentMask = std::bitset<MAX_COMPONENT_COUNT>;
+
+    /**
+     * \brief Type-erased description of a component type, used by the archetypes to move and destroy components and
+     * by the world to create sparse sets
+     */
+    struct ComponentInfo
+    {
+        ComponentId m_id        = 0;
+        size_t      m_size      = 0;
+        size_t      m_alignment = 0;
+
+        // Trivial components are moved with memcpy and never destroyed
+        bool m_isTrivial = false;
+        bool m_isSparse  = false;
+
+        void (*m_move)(void* p_destination, void* p_source)       = nullptr;
+        void (*m_copy)(void* p_destination, const void* p_source) = nullptr;
+        void (*m_destroy)(void* p_object)                         = nullptr;
+
+        // Only set for sparse components
+        std::unique_ptr<ISparseSet> (*m_createSparseSet)() = nullptr;
+    };
+
+    /**
+     * \brief Whether a component type is stored in sparse sets instead of archetypes. Sparse components can be added
+     * and removed without moving the entity's other components, which suits short-lived tags and flags
+     * \tparam T The component's type
+     */
+    template <class T>
+    struct IsSparseComponent : std::false_type
+    {
+    };
+
+    template <class T>
+    constexpr bool IS_SPARSE_COMPONENT = IsSparseComponent<std::remove_cvref_t<T>>::value;
+
+    /**
+     * \brief Gets the given component type's info, registering the type on first use.\n
+     * Components must be move constructible, and their moves must not throw. Copying is only supported for copy
+     * constructible components
+     * \tparam T The component's type
+     * \return The component type's info
+     */
+    template <class T>
+    const ComponentInfo& GetComponentInfo();
+
+    /**
+     * \brief Gets the given component type's id, registering the type on first use
+     * \tparam T The component's type
+     * \return The component type's id
+     */
+    template <class T>
+    ComponentId GetComponentId();
+
+    /**
+     * \brief Gets the info of the component type with the given id
+     * \param p_id The component type's id
+     * \return The component type's info. Nullptr if no type has the given id
+     */
+    const ComponentInfo* GetComponentInfo(ComponentId p_id);
+
+    /**
+     * \brief Registers a component type, giving it the next free id. Use GetComponentInfo<T> instead
+     * \param p_info The component type's info. Its id is ignored
+     * \return The registered info
+     */
+    const ComponentInfo& RegisterComponent(const ComponentInfo& p_info);
+}
+
+#include "SurvivantCore/ECS/Component.inl"
@@ -0,0 +1,61 @@
+#pragma once
+#include "SurvivantCore/ECS/Component.h"
+#include "SurvivantCore/ECS/SparseSet.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class T>
+    const ComponentInfo& GetComponentInfo()
+    {
+        static_assert(std::is_move_constructible_v<T>, "Components must be move constructible");
+
+        static const ComponentInfo& s_info = []() -> const ComponentInfo&
+        {
+            ComponentInfo info;
+            info.m_size      = sizeof(T);
+            info.m_alignment = alignof(T);
+            info.m_isTrivial = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+            info.m_isSparse  = IS_SPARSE_COMPONENT<T>;
+
+            info.m_move = [](void* p_destination, void* p_source)
+            {
+                new(p_destination) T(std::move(*static_cast<T*>(p_source)));
+            };
+
+            if constexpr (std::is_copy_constructible_v<T>)
+            {
+                info.m_copy = [](void* p_destination, const void* p_source)
+                {
+                    new(p_destination) T(*static_cast<const T*>(p_source));
+                };
+            }
+
+            info.m_destroy = [](void* p_object)
+            {
+                static_cast<T*>(p_object)->~T();
+            };
+
+            if constexpr (IS_SPARSE_COMPONENT<T>)
+            {
+                info.m_createSparseSet = []() -> std::unique_ptr<ISparseSet>
+                {
+                    return std::make_unique<SparseSet<T>>();
+                };
+            }
+
+            return RegisterComponent(info);
+        }();
+
+        return s_info;
+    }
+
+    template <class T>
+    ComponentId GetComponentId()
+    {
+        return GetComponentInfo<std::decay_t<T>>().m_id;
+    }
+}
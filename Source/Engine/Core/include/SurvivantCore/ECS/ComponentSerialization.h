@@ -0,0 +1,119 @@
+#pragma once
+#include "SurvivantCore/ECS/Component.h"
+#include "SurvivantCore/Enums/EFieldType.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Describes the given member of a component type as a serialized field of the given EFieldType
+ */
+#define SV_FIELD(type, member, fieldType)                                                           \
+    SvCore::ECS::MakeFieldInfo<decltype(type::member), SvCore::Enums::EFieldType::fieldType>(#member, \
+        offsetof(type, member))
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Functions saving and loading a resource handle field without knowing the resource's type
+     */
+    struct ResourceFieldInfo
+    {
+        std::string (*m_getPath)(const void* p_handle)            = nullptr;
+        void (*m_load)(const std::string& p_path, void* p_handle) = nullptr;
+    };
+
+    /**
+     * \brief Description of a serialized field of a component
+     */
+    struct FieldInfo
+    {
+        const char*       m_name   = nullptr;
+        uint32_t          m_offset = 0;
+        uint32_t          m_count  = 0;
+        Enums::EFieldType m_type   = Enums::EFieldType::BOOL;
+
+        // Only set for resource fields
+        const ResourceFieldInfo* m_resource = nullptr;
+    };
+
+    /**
+     * \brief Description of a component type saved in scene files
+     */
+    struct SerializedComponentInfo
+    {
+        ComponentId            m_id = 0;
+        std::string            m_name;
+        std::vector<FieldInfo> m_fields;
+        uint32_t               m_size = 0;
+
+        // Stable identifier of the type, hashed from its name
+        uint64_t m_typeHash = 0;
+
+        // Hashed from the size and fields, to detect files saved with another layout
+        uint64_t m_layoutHash = 0;
+    };
+
+    /**
+     * \brief Gets the functions saving and loading handles to the given resource type through the resource manager
+     * \tparam R The resource's type
+     * \return The resource type's field functions
+     */
+    template <class R>
+    const ResourceFieldInfo& GetResourceFieldInfo();
+
+    /**
+     * \brief Describes a serialized field. Use SV_FIELD instead
+     * \tparam M The member's type
+     * \tparam Type The field's type. Entity fields must be an Entity, and resource fields a ResourceHandle
+     * \param p_name The member's name
+     * \param p_offset The member's offset in the component
+     * \return The field's description
+     */
+    template <class M, Enums::EFieldType Type>
+    FieldInfo MakeFieldInfo(const char* p_name, size_t p_offset);
+
+    /**
+     * \brief Registers the given component type for scene files, under the given name.\n
+     * Serialized components are saved as raw bytes, so they must be trivially copyable and every member that matters
+     * must be described by a field. Entity and resource fields are remapped when a scene is loaded
+     * \tparam T The component's type
+     * \param p_name The component's name in scene files. Renaming the type breaks existing files
+     * \param p_fields The component's serialized fields
+     * \return The registered description
+     */
+    template <class T>
+    const SerializedComponentInfo& RegisterSerializedComponent(const std::string& p_name,
+                                                               std::vector<FieldInfo> p_fields);
+
+    /**
+     * \brief Registers a component type for scene files. Use RegisterSerializedComponent<T> instead
+     * \param p_info The component's description. Its hashes are computed from its other members
+     * \return The registered description
+     */
+    const SerializedComponentInfo& RegisterSerializedComponent(SerializedComponentInfo p_info);
+
+    /**
+     * \brief Gets the description of the serialized component with the given type id
+     * \param p_id The component's type id
+     * \return The component's description. Nullptr if the type isn't serialized
+     */
+    const SerializedComponentInfo* GetSerializedComponentInfo(ComponentId p_id);
+
+    /**
+     * \brief Finds the description of the serialized component with the given type hash
+     * \param p_typeHash The component's type hash, as saved in scene files
+     * \return The component's description. Nullptr if no registered type has this hash
+     */
+    const SerializedComponentInfo* FindSerializedComponentInfo(uint64_t p_typeHash);
+
+    /**
+     * \brief Gets the descriptions of every serialized component, by increasing type id
+     * \return The registered descriptions
+     */
+    std::vector<const SerializedComponentInfo*> GetSerializedComponentInfos();
+}
+
+#include "SurvivantCore/ECS/ComponentSerialization.inl"
@@ -0,0 +1,72 @@
+#pragma once
+#include "SurvivantCore/ECS/ComponentSerialization.h"
+#include "SurvivantCore/ECS/Entity.h"
+#include "SurvivantCore/Resources/ResourceHandle.h"
+#include "SurvivantCore/Resources/ResourceManager.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class R>
+    const ResourceFieldInfo& GetResourceFieldInfo()
+    {
+        static const ResourceFieldInfo s_info =
+        {
+            [](const void* p_handle)
+            {
+                const auto& handle = *static_cast<const Resources::ResourceHandle<R>*>(p_handle);
+                return Resources::ResourceManager::GetInstance().GetPath(handle);
+            },
+            [](const std::string& p_path, void* p_handle)
+            {
+                auto& handle = *static_cast<Resources::ResourceHandle<R>*>(p_handle);
+                handle       = Resources::ResourceManager::GetInstance().Load<R>(p_path);
+            }
+        };
+
+        return s_info;
+    }
+
+    template <class M, Enums::EFieldType Type>
+    FieldInfo MakeFieldInfo(const char* p_name, const size_t p_offset)
+    {
+        constexpr size_t VALUE_SIZE = Enums::GetFieldTypeSize(Type);
+        static_assert(sizeof(M) % VALUE_SIZE == 0, "The member's size must be a multiple of the field type's size");
+
+        FieldInfo info;
+        info.m_name   = p_name;
+        info.m_offset = static_cast<uint32_t>(p_offset);
+        info.m_count  = static_cast<uint32_t>(sizeof(M) / VALUE_SIZE);
+        info.m_type   = Type;
+
+        if constexpr (Type == Enums::EFieldType::ENTITY)
+        {
+            static_assert(std::is_same_v<M, Entity>, "Entity fields must be an Entity");
+        }
+        else if constexpr (Type == Enums::EFieldType::RESOURCE)
+        {
+            static_assert(Resources::ResourceHandleTraits<M>::value, "Resource fields must be a ResourceHandle");
+            info.m_resource = &GetResourceFieldInfo<typename Resources::ResourceHandleTraits<M>::ResourceType>();
+        }
+
+        return info;
+    }
+
+    template <class T>
+    const SerializedComponentInfo& RegisterSerializedComponent(const std::string& p_name,
+                                                               std::vector<FieldInfo> p_fields)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Serialized components must be trivially copyable");
+        static_assert(std::is_standard_layout_v<T>, "Serialized components must have a standard layout");
+
+        SerializedComponentInfo info;
+        info.m_id     = GetComponentId<T>();
+        info.m_name   = p_name;
+        info.m_fields = std::move(p_fields);
+        info.m_size   = static_cast<uint32_t>(sizeof(T));
+
+        return RegisterSerializedComponent(std::move(info));
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Identifier of an entity in a world.\n
+     * Destroyed entities' indices are reused with a new generation, so stale entities are never mistaken for
+     * the entities that took their place
+     */
+    struct Entity
+    {
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        uint32_t m_index      = INVALID_INDEX;
+        uint32_t m_generation = 0;
+
+        /**
+         * \brief Checks whether the entity was created by a world
+         * \return True if the entity has an index. False otherwise
+         */
+        bool IsValid() const
+        {
+            return m_index != INVALID_INDEX;
+        }
+
+        bool operator==(const Entity& p_other) const = default;
+    };
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "SurvivantCore/ECS/Component.h"
+#include "SurvivantCore/ECS/Entity.h"
+#include "SurvivantCore/ECS/Shared.h"
+
+#include <memory>
+#include <vector>
+
+namespace SvCore::ECS
+{
+    class World;
+
+    /**
+     * \brief Immutable set of components instantiated as new entities.\n
+     * Instances get a copy of every component. Components which are expensive to copy, or unsafe to copy from the job
+     * system's workers (e.g. anything creating GPU resources), should be wrapped in Shared so instances only share
+     * them until they write to them. Copies of a prefab share its components
+     */
+    class Prefab
+    {
+    public:
+        /**
+         * \brief Creates a prefab without components
+         */
+        Prefab() = default;
+
+        /**
+         * \brief Creates a prefab with a copy of the given entity's components
+         * \param p_world The entity's world
+         * \param p_entity The entity to copy. Its components must be copy constructible
+         */
+        Prefab(const World& p_world, Entity p_entity);
+
+        /**
+         * \brief Adds a component to the prefab, replacing the prefab's component of the same type if any
+         * \tparam T The component's type. Must be copy constructible
+         * \param p_component The component to add
+         * \return A reference to the prefab
+         */
+        template <class T>
+        Prefab& Add(T&& p_component);
+
+        /**
+         * \brief Removes a component from the prefab. Existing instances keep theirs
+         * \tparam T The component's type
+         * \return True if the component was removed. False if the prefab doesn't have one of this type
+         */
+        template <class T>
+        bool Remove();
+
+        /**
+         * \brief Gets the prefab's component of the given type
+         * \tparam T The component's type
+         * \return A pointer to the component. Nullptr if the prefab doesn't have one of this type
+         */
+        template <class T>
+        const T* Get() const;
+
+        /**
+         * \brief Gets the number of components given to each instance
+         * \return The prefab's component count
+         */
+        size_t GetComponentCount() const;
+
+        /**
+         * \brief Creates an instance of the prefab in the given world
+         * \param p_world The world to create the instance in
+         * \return The created entity
+         */
+        Entity Instantiate(World& p_world) const;
+
+        /**
+         * \brief Creates the given number of instances of the prefab in the given world at once. Archetype components
+         * are copied in parallel on the job system
+         * \param p_world The world to create the instances in
+         * \param p_count The number of instances to create
+         * \return The created entities
+         */
+        std::vector<Entity> Instantiate(World& p_world, size_t p_count) const;
+
+    private:
+        std::vector<ComponentId>           m_ids;
+        std::vector<std::shared_ptr<void>> m_components;
+
+        /**
+         * \brief Sets the prefab's component of the given type
+         * \param p_id The component's type id
+         * \param p_component The component
+         */
+        void SetComponent(ComponentId p_id, std::shared_ptr<void> p_component);
+
+        /**
+         * \brief Removes the prefab's component of the given type
+         * \param p_id The component's type id
+         * \return True if the component was removed. False if the prefab doesn't have one of this type
+         */
+        bool RemoveComponent(ComponentId p_id);
+
+        /**
+         * \brief Finds the prefab's component of the given type
+         * \param p_id The component's type id
+         * \return A pointer to the component. Nullptr if the prefab doesn't have one of this type
+         */
+        const void* FindComponent(ComponentId p_id) const;
+    };
+}
+
+#include "SurvivantCore/ECS/Prefab.inl"
@@ -0,0 +1,30 @@
+#pragma once
+#include "SurvivantCore/ECS/Prefab.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class T>
+    Prefab& Prefab::Add(T&& p_component)
+    {
+        using Component = std::decay_t<T>;
+        static_assert(std::is_copy_constructible_v<Component>, "Prefab components must be copy constructible");
+
+        SetComponent(GetComponentId<Component>(), std::make_shared<Component>(std::forward<T>(p_component)));
+        return *this;
+    }
+
+    template <class T>
+    bool Prefab::Remove()
+    {
+        return RemoveComponent(GetComponentId<T>());
+    }
+
+    template <class T>
+    const T* Prefab::Get() const
+    {
+        return static_cast<const T*>(FindComponent(GetComponentId<T>()));
+    }
+}
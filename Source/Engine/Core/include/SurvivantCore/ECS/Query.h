@@ -0,0 +1,92 @@
+#pragma once
+#include "SurvivantCore/ECS/Archetype.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief The archetypes matching a set of component types. Kept up to date by the world as archetypes are created
+     */
+    struct QueryCache
+    {
+        ComponentMask           m_mask;
+        std::vector<Archetype*> m_archetypes;
+    };
+
+    /**
+     * \brief Iterates over every entity having the given component types, chunk by chunk.\n
+     * Entities must not be created or destroyed, and components must not be added or removed, during an iteration.
+     * Components can be requested as const to document read-only access
+     * \tparam T The required components' types
+     */
+    template <class... T>
+    class Query
+    {
+    public:
+        /**
+         * \brief Creates a query over the given cache's archetypes. Use World::GetQuery instead
+         * \param p_cache The query's cached archetypes
+         */
+        explicit Query(const QueryCache& p_cache);
+
+        /**
+         * \brief Calls the given function for every matching entity
+         * \tparam Func The function's type. Must be callable as `void(T&...)` or `void(Entity, T&...)`
+         * \param p_func The function to call for each entity
+         */
+        template <class Func>
+        void ForEach(Func&& p_func) const;
+
+        /**
+         * \brief Calls the given function for every non-empty chunk of a matching archetype
+         * \tparam Func The function's type. Must be callable as `void(size_t count, const Entity*, T*...)`
+         * \param p_func The function to call with each chunk's arrays
+         */
+        template <class Func>
+        void ForEachChunk(Func&& p_func) const;
+
+        /**
+         * \brief Calls the given function for every matching entity, splitting the chunks across the job system's
+         * threads, and waits for all of them. The calling thread takes part in the work
+         * \tparam Func The function's type. Must be callable as `void(T&...)` or `void(Entity, T&...)`
+         * \param p_func The function to call for each entity. Called concurrently on different entities
+         * \param p_grainSize The minimum number of chunks per job. 0 to pick one from the worker count
+         */
+        template <class Func>
+        void ParallelForEach(Func&& p_func, size_t p_grainSize = 0) const;
+
+        /**
+         * \brief Gets the number of matching entities
+         * \return The number of entities the query iterates over
+         */
+        size_t GetEntityCount() const;
+
+    private:
+        using Columns = std::array<uint32_t, sizeof...(T)>;
+
+        const QueryCache* m_cache;
+
+        /**
+         * \brief Gets the columns holding the query's components in the given archetype
+         * \param p_archetype A matching archetype
+         * \return The components' columns, in the query's order
+         */
+        static Columns GetColumns(const Archetype& p_archetype);
+
+        /**
+         * \brief Calls the given function for every entity of the given chunk
+         * \param p_func The function to call for each entity
+         * \param p_archetype The chunk's archetype
+         * \param p_chunk The chunk to iterate over
+         * \param p_columns The components' columns in the archetype
+         */
+        template <class Func>
+        static void ForEachInChunk(Func& p_func, const Archetype& p_archetype, const Archetype::Chunk& p_chunk,
+                                   const Columns& p_columns);
+    };
+}
+
+#include "SurvivantCore/ECS/Query.inl"
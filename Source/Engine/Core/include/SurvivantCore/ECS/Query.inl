@@ -0,0 +1,121 @@
+#pragma once
+#include "SurvivantCore/ECS/Query.h"
+#include "SurvivantCore/Threading/JobSystem.h"
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class... T>
+    Query<T...>::Query(const QueryCache& p_cache)
+        : m_cache(&p_cache)
+    {
+    }
+
+    template <class... T>
+    template <class Func>
+    void Query<T...>::ForEach(Func&& p_func) const
+    {
+        for (const Archetype* archetype : m_cache->m_archetypes)
+        {
+            const Columns columns = GetColumns(*archetype);
+
+            for (const Archetype::Chunk& chunk : archetype->GetChunks())
+                ForEachInChunk(p_func, *archetype, chunk, columns);
+        }
+    }
+
+    template <class... T>
+    template <class Func>
+    void Query<T...>::ForEachChunk(Func&& p_func) const
+    {
+        for (const Archetype* archetype : m_cache->m_archetypes)
+        {
+            const Columns columns = GetColumns(*archetype);
+
+            for (const Archetype::Chunk& chunk : archetype->GetChunks())
+            {
+                if (chunk.m_count == 0)
+                    continue;
+
+                [&]<size_t... I>(std::index_sequence<I...>)
+                {
+                    p_func(static_cast<size_t>(chunk.m_count), archetype->GetEntities(chunk),
+                        static_cast<T*>(archetype->GetComponents(chunk, columns[I]))...);
+                }(std::index_sequence_for<T...>());
+            }
+        }
+    }
+
+    template <class... T>
+    template <class Func>
+    void Query<T...>::ParallelForEach(Func&& p_func, const size_t p_grainSize) const
+    {
+        struct ChunkJob
+        {
+            const Archetype*        m_archetype;
+            const Archetype::Chunk* m_chunk;
+            Columns                 m_columns;
+        };
+
+        std::vector<ChunkJob> jobs;
+
+        for (const Archetype* archetype : m_cache->m_archetypes)
+        {
+            const Columns columns = GetColumns(*archetype);
+
+            for (const Archetype::Chunk& chunk : archetype->GetChunks())
+            {
+                if (chunk.m_count > 0)
+                    jobs.push_back({ archetype, &chunk, columns });
+            }
+        }
+
+        Threading::JobSystem::GetInstance().ParallelFor(0, jobs.size(), [&p_func, &jobs](const size_t p_index)
+        {
+            const ChunkJob& job = jobs[p_index];
+            ForEachInChunk(p_func, *job.m_archetype, *job.m_chunk, job.m_columns);
+        }, p_grainSize);
+    }
+
+    template <class... T>
+    size_t Query<T...>::GetEntityCount() const
+    {
+        size_t count = 0;
+
+        for (const Archetype* archetype : m_cache->m_archetypes)
+            count += archetype->GetEntityCount();
+
+        return count;
+    }
+
+    template <class... T>
+    typename Query<T...>::Columns Query<T...>::GetColumns(const Archetype& p_archetype)
+    {
+        return { p_archetype.GetColumn(GetComponentId<T>())... };
+    }
+
+    template <class... T>
+    template <class Func>
+    void Query<T...>::ForEachInChunk(Func& p_func, const Archetype& p_archetype, const Archetype::Chunk& p_chunk,
+                                     const Columns& p_columns)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            const Entity*           entities   = p_archetype.GetEntities(p_chunk);
+            const std::tuple<T*...> components = {
+                static_cast<T*>(p_archetype.GetComponents(p_chunk, p_columns[I]))...
+            };
+
+            for (uint32_t i = 0; i < p_chunk.m_count; ++i)
+            {
+                if constexpr (std::is_invocable_v<Func&, Entity, T&...>)
+                    p_func(entities[i], std::get<I>(components)[i]...);
+                else
+                    p_func(std::get<I>(components)[i]...);
+            }
+        }(std::index_sequence_for<T...>());
+    }
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "SurvivantCore/ECS/ComponentSerialization.h"
+#include "SurvivantCore/ECS/SceneFormat.h"
+#include "SurvivantCore/ECS/World.h"
+#include "SurvivantCore/Utility/MappedFile.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Binary scene file saved by SaveScene, mapped in memory and used without parsing.\n
+     * Opening the file only checks that every offset stays in bounds. Instantiating it patches the entity and
+     * resource fields in the mapped pages, then copies each block's component columns into the world
+     */
+    class SceneFile
+    {
+    public:
+        /**
+         * \brief Creates a closed scene file
+         */
+        SceneFile() = default;
+
+        /**
+         * \brief Disable scene file copying
+         */
+        SceneFile(const SceneFile& p_other) = delete;
+
+        /**
+         * \brief Disable scene file moving
+         */
+        SceneFile(SceneFile&& p_other) noexcept = delete;
+
+        /**
+         * \brief Unmaps the scene file
+         */
+        ~SceneFile() = default;
+
+        /**
+         * \brief Disable scene file copying
+         */
+        SceneFile& operator=(const SceneFile& p_other) = delete;
+
+        /**
+         * \brief Disable scene file moving
+         */
+        SceneFile& operator=(SceneFile&& p_other) noexcept = delete;
+
+        /**
+         * \brief Maps and validates the given scene file, closing the current one
+         * \param p_path The scene file's path
+         * \return True on success. False if the file couldn't be mapped or is invalid
+         */
+        bool Open(const std::string& p_path);
+
+        /**
+         * \brief Unmaps the scene file
+         */
+        void Close();
+
+        /**
+         * \brief Checks whether a valid scene file is open
+         * \return True if a scene file is open. False otherwise
+         */
+        bool IsOpen() const;
+
+        /**
+         * \brief Gets the number of entities in the scene
+         * \return The scene's entity count
+         */
+        uint32_t GetEntityCount() const;
+
+        /**
+         * \brief Creates the scene's entities and components in the given world. Can be called several times.\n
+         * Referenced resources are loaded through the resource manager, and keep one reference per instantiation.
+         * Components of unknown types or saved with another layout are skipped
+         * \param p_world The world to create the entities in
+         * \return The created entities, indexed by scene entity index. Empty if no scene is open
+         */
+        std::vector<Entity> Instantiate(World& p_world);
+
+        /**
+         * \brief Converts the scene to JSON text, with one entity per line, to compare scene files
+         * \return The scene's JSON text. Empty if no scene is open
+         */
+        std::string ExportJson() const;
+
+    private:
+        Utility::MappedFile        m_file;
+        const SceneFormat::Header* m_header = nullptr;
+
+        /**
+         * \brief Gets the structures of the given range
+         * \tparam T The structures' type
+         * \param p_range The structures' range. Must have been validated
+         * \return A pointer to the first structure
+         */
+        template <class T>
+        T* GetArray(const SceneFormat::Range<T>& p_range) const;
+
+        /**
+         * \brief Gets the string at the given offset in the string table
+         * \param p_offset The string's offset. Must have been validated
+         * \return The null-terminated string
+         */
+        const char* GetString(uint32_t p_offset) const;
+
+        /**
+         * \brief Appends the given component's fields to the given JSON text, as an object
+         * \param p_json The JSON text
+         * \param p_info The component's registered description. Nullptr to append its raw bytes
+         * \param p_type The component's type in the scene
+         * \param p_offset The component's offset from the start of the file
+         */
+        void AppendComponentJson(std::string& p_json, const SerializedComponentInfo* p_info,
+                                 const SceneFormat::ComponentType& p_type, uint64_t p_offset) const;
+
+        /**
+         * \brief Checks that every range, index and fixup of the mapped file stays in bounds
+         * \return True if the file is a valid scene. False otherwise
+         */
+        bool Validate() const;
+
+        /**
+         * \brief Checks that the given range stays in the mapped file and is aligned for its structures
+         * \tparam T The structures' type
+         * \param p_range The range to check
+         * \return True if the range is valid. False otherwise
+         */
+        template <class T>
+        bool IsValidRange(const SceneFormat::Range<T>& p_range) const;
+
+        /**
+         * \brief Gets the bytes spanned by the given range
+         * \tparam T The structures' type
+         * \param p_range The range. Must have been validated
+         * \return The range's first byte offset and end offset
+         */
+        template <class T>
+        static std::pair<uint64_t, uint64_t> GetByteRange(const SceneFormat::Range<T>& p_range);
+
+        /**
+         * \brief Gets the registered description of each of the scene's component types
+         * \return The descriptions, indexed by scene component type. Nullptr for unknown or changed types
+         */
+        std::vector<const SerializedComponentInfo*> GetComponentInfos() const;
+    };
+}
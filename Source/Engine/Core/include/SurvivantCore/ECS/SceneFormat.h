@@ -0,0 +1,139 @@
+#pragma once
+#include "SurvivantCore/Enums/EFieldType.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Identifier of a resource referenced by a scene, hashed from its path relative to the working directory
+     */
+    using ResourceGuid = uint64_t;
+
+    /**
+     * \brief Binary scene file layout.\n
+     * Every structure has a fixed size and alignment, and refers to others through byte offsets from the start of the
+     * file, so a mapped file is used as is. Values are stored in the saving machine's byte order.
+     *
+     * Entities are numbered from 0 in file order and grouped in blocks of entities sharing the same components. Each
+     * block stores one packed column per component type, matching the in-memory layout of the components.
+     * Entity and resource fields hold a scene entity index and a resource guid on disk. Each of them is listed in
+     * the fixup table, which loaders use to replace them in place with runtime entities and resource handles.
+     * Transform hierarchies are saved this way, as entity fields referencing each node's parent
+     */
+    namespace SceneFormat
+    {
+        constexpr uint32_t MAGIC         = 0x43535653; // "SVSC"
+        constexpr uint32_t VERSION       = 1;
+        constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        // Component columns are aligned as strictly as archetype chunks
+        constexpr uint64_t DATA_ALIGNMENT = 64;
+
+        /**
+         * \brief Array of structures stored at the given offset from the start of the file
+         * \tparam T The structures' type
+         */
+        template <class T>
+        struct Range
+        {
+            uint64_t m_offset = 0;
+            uint64_t m_count  = 0;
+        };
+
+        /**
+         * \brief A component type used by the scene
+         */
+        struct ComponentType
+        {
+            uint64_t m_typeHash   = 0;
+            uint64_t m_layoutHash = 0;
+            uint32_t m_size       = 0;
+
+            // Offset of the type's name in the string table
+            uint32_t m_name = 0;
+        };
+
+        /**
+         * \brief The components of one type of every entity in a block
+         */
+        struct Column
+        {
+            uint32_t m_componentType = 0;
+            uint32_t m_padding       = 0;
+
+            // Offset of the block's packed components, aligned to DATA_ALIGNMENT
+            uint64_t m_data = 0;
+        };
+
+        /**
+         * \brief Consecutive entities having the same components
+         */
+        struct Block
+        {
+            uint32_t      m_firstEntity = 0;
+            uint32_t      m_entityCount = 0;
+            Range<Column> m_columns;
+        };
+
+        /**
+         * \brief A resource referenced by the scene's components
+         */
+        struct Resource
+        {
+            ResourceGuid m_guid = 0;
+
+            // Offset of the resource's path in the string table
+            uint32_t m_path    = 0;
+            uint32_t m_padding = 0;
+        };
+
+        /**
+         * \brief An entity or resource field to replace in place when loading the scene
+         */
+        struct Fixup
+        {
+            // Offset of the field's 8 bytes from the start of the file
+            uint64_t m_offset = 0;
+
+            // The field's saved value: a scene entity index or a resource guid
+            uint64_t m_value = 0;
+
+            uint32_t          m_componentType = 0;
+            uint16_t          m_field         = 0;
+            Enums::EFieldType m_type          = Enums::EFieldType::ENTITY;
+            uint8_t           m_padding       = 0;
+
+            // For resource fields, the index of the resource in the resource table
+            uint32_t m_resource  = INVALID_INDEX;
+            uint32_t m_padding2 = 0;
+        };
+
+        /**
+         * \brief The file's first bytes
+         */
+        struct Header
+        {
+            uint32_t m_magic       = MAGIC;
+            uint32_t m_version     = VERSION;
+            uint64_t m_fileSize    = 0;
+            uint32_t m_entityCount = 0;
+            uint32_t m_padding     = 0;
+
+            Range<ComponentType> m_componentTypes;
+            Range<Block>         m_blocks;
+            Range<Resource>      m_resources;
+
+            // Sorted by offset
+            Range<Fixup> m_fixups;
+
+            // Null-terminated strings referenced by offset
+            Range<char> m_strings;
+        };
+
+        static_assert(sizeof(ComponentType) == 24 && sizeof(Column) == 16 && sizeof(Block) == 24);
+        static_assert(sizeof(Resource) == 16 && sizeof(Fixup) == 32 && sizeof(Header) == 104);
+        static_assert(std::is_trivially_copyable_v<Header>);
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "SurvivantCore/ECS/World.h"
+
+#include <string>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Saves every alive entity of the given world and their serialized components to a binary scene file.\n
+     * Components which weren't registered with RegisterSerializedComponent are skipped. Entity fields referencing
+     * dead entities are saved as invalid entities
+     * \param p_world The world to save
+     * \param p_path The scene file's path
+     * \return True on success. False if the file couldn't be written
+     */
+    bool SaveScene(const World& p_world, const std::string& p_path);
+}
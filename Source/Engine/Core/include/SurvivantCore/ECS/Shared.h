@@ -0,0 +1,78 @@
+#pragma once
+#include <memory>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Copy-on-write component data.\n
+     * Copies only share the data, so large or expensive components (e.g. meshes) can be given to many entities
+     * without being duplicated. The data is cloned the first time a sharing copy writes to it. Reading is safe from
+     * several threads, writing follows the usual component rules
+     * \tparam T The shared data's type. Must be copy constructible to be written to
+     */
+    template <class T>
+    class Shared
+    {
+    public:
+        /**
+         * \brief Creates an empty shared component
+         */
+        Shared() = default;
+
+        /**
+         * \brief Creates a shared component holding the given data
+         * \param p_data The component's data
+         */
+        explicit Shared(std::shared_ptr<T> p_data);
+
+        /**
+         * \brief Creates a shared component holding new data built from the given parameters
+         * \tparam Args The data's constructor parameters' types
+         * \param p_args The data's constructor parameters
+         * \return The created shared component
+         */
+        template <class... Args>
+        static Shared Make(Args&&... p_args);
+
+        /**
+         * \brief Gets the component's data for reading
+         * \return A reference to the data. Must not be empty
+         */
+        const T& Get() const;
+
+        /**
+         * \brief Gets the component's data for writing, first cloning it if other copies share it
+         * \return A reference to the data, owned by this copy only. Must not be empty
+         */
+        T& Write();
+
+        /**
+         * \brief Checks whether the component's data is shared with other copies
+         * \return True if writing would clone the data. False otherwise
+         */
+        bool IsShared() const;
+
+        /**
+         * \brief Checks whether the component holds data
+         * \return True if the component isn't empty. False otherwise
+         */
+        bool IsValid() const;
+
+        /**
+         * \brief Gets the component's data for reading
+         * \return A reference to the data. Must not be empty
+         */
+        const T& operator*() const;
+
+        /**
+         * \brief Gets the component's data for reading
+         * \return A pointer to the data. Must not be empty
+         */
+        const T* operator->() const;
+
+    private:
+        std::shared_ptr<T> m_data;
+    };
+}
+
+#include "SurvivantCore/ECS/Shared.inl"
@@ -0,0 +1,63 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/ECS/Shared.h"
+
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class T>
+    Shared<T>::Shared(std::shared_ptr<T> p_data)
+        : m_data(std::move(p_data))
+    {
+    }
+
+    template <class T>
+    template <class... Args>
+    Shared<T> Shared<T>::Make(Args&&... p_args)
+    {
+        return Shared(std::make_shared<T>(std::forward<Args>(p_args)...));
+    }
+
+    template <class T>
+    const T& Shared<T>::Get() const
+    {
+        ASSERT(m_data, "Unable to read empty shared component");
+        return *m_data;
+    }
+
+    template <class T>
+    T& Shared<T>::Write()
+    {
+        ASSERT(m_data, "Unable to write empty shared component");
+
+        if (m_data.use_count() > 1)
+            m_data = std::make_shared<T>(std::as_const(*m_data));
+
+        return *m_data;
+    }
+
+    template <class T>
+    bool Shared<T>::IsShared() const
+    {
+        return m_data.use_count() > 1;
+    }
+
+    template <class T>
+    bool Shared<T>::IsValid() const
+    {
+        return m_data != nullptr;
+    }
+
+    template <class T>
+    const T& Shared<T>::operator*() const
+    {
+        return Get();
+    }
+
+    template <class T>
+    const T* Shared<T>::operator->() const
+    {
+        return &Get();
+    }
+}
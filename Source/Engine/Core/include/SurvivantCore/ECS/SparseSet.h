@@ -0,0 +1,242 @@
+#pragma once
+#include "SurvivantCore/ECS/Entity.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Type-erased part of a sparse set: maps entities to indices in a packed array.\n
+     * The sparse array is split in pages allocated on first use, so sets of a few entities with high indices stay small
+     */
+    class ISparseSet
+    {
+    public:
+        static constexpr uint32_t PAGE_SIZE     = 4096;
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        /**
+         * \brief Creates an empty sparse set
+         */
+        ISparseSet() = default;
+
+        /**
+         * \brief Disable sparse set copying
+         */
+        ISparseSet(const ISparseSet& p_other) = delete;
+
+        /**
+         * \brief Disable sparse set moving
+         */
+        ISparseSet(ISparseSet&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the sparse set
+         */
+        virtual ~ISparseSet() = default;
+
+        /**
+         * \brief Disable sparse set copying
+         */
+        ISparseSet& operator=(const ISparseSet& p_other) = delete;
+
+        /**
+         * \brief Disable sparse set moving
+         */
+        ISparseSet& operator=(ISparseSet&& p_other) noexcept = delete;
+
+        /**
+         * \brief Removes the given entity's component, moving the last one in its place
+         * \param p_entity The entity to remove
+         * \return True if the entity was in the set. False otherwise
+         */
+        virtual bool Remove(Entity p_entity) = 0;
+
+        /**
+         * \brief Removes every entity from the set
+         */
+        virtual void Clear() = 0;
+
+        /**
+         * \brief Swaps two entities and their components in the packed arrays
+         * \param p_first The first entity's packed index
+         * \param p_second The second entity's packed index
+         */
+        virtual void Swap(uint32_t p_first, uint32_t p_second) = 0;
+
+        /**
+         * \brief Copies the given component to the given entity, replacing its current one if any
+         * \param p_entity The component's entity
+         * \param p_source The component to copy. Must be of the set's type, which must be copy constructible
+         * \return A pointer to the entity's component
+         */
+        virtual void* CopyComponent(Entity p_entity, const void* p_source) = 0;
+
+        /**
+         * \brief Gets the given entity's component without knowing its type
+         * \param p_entity The component's entity
+         * \return A pointer to the component. Nullptr if the entity isn't in the set
+         */
+        virtual void* FindComponent(Entity p_entity) = 0;
+
+        /**
+         * \brief Checks whether the given entity is in the set
+         * \param p_entity The entity to check
+         * \return True if the set holds a component for this exact entity and generation. False otherwise
+         */
+        bool Contains(Entity p_entity) const;
+
+        /**
+         * \brief Gets the given entity's index in the packed arrays
+         * \param p_entity The entity to find
+         * \return The entity's packed index. INVALID_INDEX if the entity isn't in the set
+         */
+        uint32_t GetIndex(Entity p_entity) const;
+
+        /**
+         * \brief Gets the number of entities in the set
+         * \return The set's size
+         */
+        size_t GetSize() const;
+
+        /**
+         * \brief Gets the packed array of entities
+         * \return The set's entities, in the same order as their components
+         */
+        const Entity* GetEntities() const;
+
+        /**
+         * \brief Gets a counter increased by every change to the set's order or content
+         * \return The set's version
+         */
+        uint64_t GetVersion() const;
+
+    protected:
+        using Page = std::array<uint32_t, PAGE_SIZE>;
+
+        std::vector<std::unique_ptr<Page>> m_pages;
+        std::vector<Entity>                m_entities;
+        uint64_t                           m_version = 0;
+
+        /**
+         * \brief Adds the given entity at the end of the packed array
+         * \param p_entity The entity to add. Must not be in the set
+         * \return The entity's packed index
+         */
+        uint32_t AddEntity(Entity p_entity);
+
+        /**
+         * \brief Moves the last entity to the given packed index and shrinks the packed array
+         * \param p_index The packed index of the entity to remove
+         */
+        void RemoveEntity(uint32_t p_index);
+
+        /**
+         * \brief Swaps two entities in the packed array
+         * \param p_first The first entity's packed index
+         * \param p_second The second entity's packed index
+         */
+        void SwapEntities(uint32_t p_first, uint32_t p_second);
+
+        /**
+         * \brief Removes every entity from the packed array and resets their sparse entries
+         */
+        void ClearEntities();
+
+        /**
+         * \brief Gets the sparse entry of the given entity index, allocating its page if needed
+         * \param p_index The entity's index
+         * \return The entity's sparse entry
+         */
+        uint32_t& GetSparseEntry(uint32_t p_index);
+    };
+
+    /**
+     * \brief Component storage giving O(1) add and remove and packed iteration, at the cost of a lookup per access.\n
+     * Suited to components added and removed often, like per-frame tags. Empty components store no data
+     * \tparam T The component's type
+     */
+    template <class T>
+    class SparseSet final : public ISparseSet
+    {
+    public:
+        /**
+         * \brief Constructs the given entity's component, replacing its current one if any
+         * \tparam Args The component's constructor parameters' types
+         * \param p_entity The component's entity
+         * \param p_args The component's constructor parameters
+         * \return A reference to the component, valid until the next change to the set
+         */
+        template <class... Args>
+        T& Emplace(Entity p_entity, Args&&... p_args);
+
+        /**
+         * \brief Removes the given entity's component, moving the last one in its place
+         * \param p_entity The entity to remove
+         * \return True if the entity was in the set. False otherwise
+         */
+        bool Remove(Entity p_entity) override;
+
+        /**
+         * \brief Removes every entity from the set
+         */
+        void Clear() override;
+
+        /**
+         * \brief Swaps two entities and their components in the packed arrays
+         * \param p_first The first entity's packed index
+         * \param p_second The second entity's packed index
+         */
+        void Swap(uint32_t p_first, uint32_t p_second) override;
+
+        /**
+         * \brief Copies the given component to the given entity, replacing its current one if any
+         * \param p_entity The component's entity
+         * \param p_source The component to copy. Must point to a T
+         * \return A pointer to the entity's component. Nullptr if T isn't copy constructible
+         */
+        void* CopyComponent(Entity p_entity, const void* p_source) override;
+
+        /**
+         * \brief Gets the given entity's component without knowing its type
+         * \param p_entity The component's entity
+         * \return A pointer to the component. Nullptr if the entity isn't in the set
+         */
+        void* FindComponent(Entity p_entity) override;
+
+        /**
+         * \brief Gets the given entity's component
+         * \param p_entity The component's entity
+         * \return A pointer to the component. Nullptr if the entity isn't in the set
+         */
+        T* Get(Entity p_entity);
+
+        /**
+         * \brief Gets the component at the given packed index
+         * \param p_index The component's packed index
+         * \return A reference to the component
+         */
+        T& GetAt(uint32_t p_index);
+
+        /**
+         * \brief Gets the packed array of components
+         * \return The set's components, in the same order as their entities. Nullptr for empty components
+         */
+        T* GetComponents();
+
+    private:
+        static constexpr bool IS_EMPTY = std::is_empty_v<T>;
+
+        std::vector<T> m_components;
+
+        // Shared instance returned for empty components
+        static T s_empty;
+    };
+}
+
+#include "SurvivantCore/ECS/SparseSet.inl"
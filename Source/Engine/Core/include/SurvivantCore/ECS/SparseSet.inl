@@ -0,0 +1,124 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/ECS/SparseSet.h"
+
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class T>
+    T SparseSet<T>::s_empty;
+
+    template <class T>
+    template <class... Args>
+    T& SparseSet<T>::Emplace(const Entity p_entity, Args&&... p_args)
+    {
+        if (const uint32_t index = GetIndex(p_entity); index != INVALID_INDEX)
+        {
+            if constexpr (IS_EMPTY)
+                return s_empty;
+            else
+                return m_components[index] = T(std::forward<Args>(p_args)...);
+        }
+
+        if constexpr (IS_EMPTY)
+        {
+            AddEntity(p_entity);
+            return s_empty;
+        }
+        else
+        {
+            // Built before adding the entity so a throwing constructor leaves the set untouched
+            T& component = m_components.emplace_back(std::forward<Args>(p_args)...);
+            AddEntity(p_entity);
+            return component;
+        }
+    }
+
+    template <class T>
+    bool SparseSet<T>::Remove(const Entity p_entity)
+    {
+        const uint32_t index = GetIndex(p_entity);
+
+        if (index == INVALID_INDEX)
+            return false;
+
+        if constexpr (!IS_EMPTY)
+        {
+            if (index + 1 != m_components.size())
+                m_components[index] = std::move(m_components.back());
+
+            m_components.pop_back();
+        }
+
+        RemoveEntity(index);
+        return true;
+    }
+
+    template <class T>
+    void SparseSet<T>::Clear()
+    {
+        m_components.clear();
+        ClearEntities();
+    }
+
+    template <class T>
+    void SparseSet<T>::Swap(const uint32_t p_first, const uint32_t p_second)
+    {
+        if (p_first == p_second)
+            return;
+
+        if constexpr (!IS_EMPTY)
+        {
+            using std::swap;
+            swap(m_components[p_first], m_components[p_second]);
+        }
+
+        SwapEntities(p_first, p_second);
+    }
+
+    template <class T>
+    void* SparseSet<T>::CopyComponent(const Entity p_entity, const void* p_source)
+    {
+        if constexpr (std::is_copy_constructible_v<T>)
+        {
+            return &Emplace(p_entity, *static_cast<const T*>(p_source));
+        }
+        else
+        {
+            ASSERT(false, "Unable to copy a component which isn't copy constructible");
+            return nullptr;
+        }
+    }
+
+    template <class T>
+    void* SparseSet<T>::FindComponent(const Entity p_entity)
+    {
+        return Get(p_entity);
+    }
+
+    template <class T>
+    T* SparseSet<T>::Get(const Entity p_entity)
+    {
+        const uint32_t index = GetIndex(p_entity);
+        return index != INVALID_INDEX ? &GetAt(index) : nullptr;
+    }
+
+    template <class T>
+    T& SparseSet<T>::GetAt(const uint32_t p_index)
+    {
+        if constexpr (IS_EMPTY)
+            return s_empty;
+        else
+            return m_components[p_index];
+    }
+
+    template <class T>
+    T* SparseSet<T>::GetComponents()
+    {
+        if constexpr (IS_EMPTY)
+            return nullptr;
+        else
+            return m_components.data();
+    }
+}
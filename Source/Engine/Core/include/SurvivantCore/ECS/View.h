@@ -0,0 +1,91 @@
+#pragma once
+#include "SurvivantCore/ECS/SparseSet.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Iterates over every entity having the given sparse components, walking the smallest pool and looking the
+     * entity up in the others.\n
+     * The view can also pack its pools so the matching entities sit at the front of each pool, in the same order,
+     * letting systems read their components as parallel contiguous arrays until one of the pools changes.
+     * The view's pools must not be changed during an iteration. Components can be requested as const to document
+     * read-only access
+     * \tparam T The required components' types
+     */
+    template <class... T>
+    class View
+    {
+    public:
+        /**
+         * \brief Creates a view over the given pools. Use World::GetView instead
+         * \param p_sets The components' pools
+         */
+        explicit View(SparseSet<std::remove_const_t<T>>&... p_sets);
+
+        /**
+         * \brief Calls the given function for every matching entity
+         * \tparam Func The function's type. Must be callable as `void(T&...)` or `void(Entity, T&...)`
+         * \param p_func The function to call for each entity
+         */
+        template <class Func>
+        void ForEach(Func&& p_func) const;
+
+        /**
+         * \brief Reorders the view's pools so the matching entities occupy the first packed indices of each pool,
+         * in the same order. Cheap when the pools haven't changed since the last pack
+         * \return The number of matching entities
+         */
+        size_t Pack();
+
+        /**
+         * \brief Checks whether the pools are still packed for this view
+         * \return True if the view was packed and none of its pools changed since. False otherwise
+         */
+        bool IsPacked() const;
+
+        /**
+         * \brief Calls the given function once with the packed arrays of every matching entity. The view must be packed
+         * \tparam Func The function's type. Must be callable as `void(size_t count, const Entity*, T*...)`.
+         * Empty components are passed as nullptr
+         * \param p_func The function to call with the packed arrays
+         */
+        template <class Func>
+        void ForEachPacked(Func&& p_func) const;
+
+        /**
+         * \brief Gets the number of entities in the view's smallest pool, an upper bound of the matching entities
+         * \return The smallest pool's size
+         */
+        size_t GetSizeHint() const;
+
+    private:
+        using Indices = std::array<uint32_t, sizeof...(T)>;
+
+        std::tuple<SparseSet<std::remove_const_t<T>>*...> m_sets;
+        std::array<uint64_t, sizeof...(T)>                m_packedVersions{};
+        size_t                                            m_packedCount = 0;
+        bool                                              m_isPacked    = false;
+
+        /**
+         * \brief Gets the view's smallest pool
+         * \return The pool to iterate over
+         */
+        const ISparseSet& GetSmallest() const;
+
+        /**
+         * \brief Gets the packed index of the given entity in each of the view's pools
+         * \param p_entity The entity to find
+         * \param p_indices The output indices
+         * \return True if the entity is in every pool. False otherwise
+         */
+        bool FindIndices(Entity p_entity, Indices& p_indices) const;
+    };
+}
+
+#include "SurvivantCore/ECS/View.inl"
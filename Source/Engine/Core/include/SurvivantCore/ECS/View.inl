@@ -0,0 +1,133 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/ECS/View.h"
+
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class... T>
+    View<T...>::View(SparseSet<std::remove_const_t<T>>&... p_sets)
+        : m_sets(&p_sets...)
+    {
+    }
+
+    template <class... T>
+    template <class Func>
+    void View<T...>::ForEach(Func&& p_func) const
+    {
+        const ISparseSet& smallest = GetSmallest();
+        const Entity*     entities = smallest.GetEntities();
+
+        for (size_t i = 0, count = smallest.GetSize(); i < count; ++i)
+        {
+            Indices indices;
+
+            if (!FindIndices(entities[i], indices))
+                continue;
+
+            [&]<size_t... I>(std::index_sequence<I...>)
+            {
+                if constexpr (std::is_invocable_v<Func&, Entity, T&...>)
+                    p_func(entities[i], static_cast<T&>(std::get<I>(m_sets)->GetAt(indices[I]))...);
+                else
+                    p_func(static_cast<T&>(std::get<I>(m_sets)->GetAt(indices[I]))...);
+            }(std::index_sequence_for<T...>());
+        }
+    }
+
+    template <class... T>
+    size_t View<T...>::Pack()
+    {
+        if (IsPacked())
+            return m_packedCount;
+
+        const ISparseSet& smallest = GetSmallest();
+
+        // Swaps never reallocate the packed arrays, and only move entities already visited to the current index
+        const Entity* entities = smallest.GetEntities();
+        size_t        packed   = 0;
+
+        for (size_t i = 0, count = smallest.GetSize(); i < count; ++i)
+        {
+            Indices indices;
+
+            if (!FindIndices(entities[i], indices))
+                continue;
+
+            [&]<size_t... I>(std::index_sequence<I...>)
+            {
+                (std::get<I>(m_sets)->Swap(indices[I], static_cast<uint32_t>(packed)), ...);
+            }(std::index_sequence_for<T...>());
+
+            ++packed;
+        }
+
+        m_packedCount = packed;
+        m_isPacked    = true;
+
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            m_packedVersions = { std::get<I>(m_sets)->GetVersion()... };
+        }(std::index_sequence_for<T...>());
+
+        return m_packedCount;
+    }
+
+    template <class... T>
+    bool View<T...>::IsPacked() const
+    {
+        if (!m_isPacked)
+            return false;
+
+        return [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            return ((std::get<I>(m_sets)->GetVersion() == m_packedVersions[I]) && ...);
+        }(std::index_sequence_for<T...>());
+    }
+
+    template <class... T>
+    template <class Func>
+    void View<T...>::ForEachPacked(Func&& p_func) const
+    {
+        ASSERT(IsPacked(), "The view's pools changed since it was packed");
+
+        if (m_packedCount == 0)
+            return;
+
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            p_func(m_packedCount, std::get<0>(m_sets)->GetEntities(),
+                static_cast<T*>(std::get<I>(m_sets)->GetComponents())...);
+        }(std::index_sequence_for<T...>());
+    }
+
+    template <class... T>
+    size_t View<T...>::GetSizeHint() const
+    {
+        return GetSmallest().GetSize();
+    }
+
+    template <class... T>
+    const ISparseSet& View<T...>::GetSmallest() const
+    {
+        const ISparseSet* smallest = std::get<0>(m_sets);
+
+        std::apply([&smallest](const auto*... p_sets)
+        {
+            ((smallest = p_sets->GetSize() < smallest->GetSize() ? p_sets : smallest), ...);
+        }, m_sets);
+
+        return *smallest;
+    }
+
+    template <class... T>
+    bool View<T...>::FindIndices(const Entity p_entity, Indices& p_indices) const
+    {
+        return [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            // Stops at the first pool missing the entity
+            return (((p_indices[I] = std::get<I>(m_sets)->GetIndex(p_entity)) != ISparseSet::INVALID_INDEX) && ...);
+        }(std::index_sequence_for<T...>());
+    }
+}
@@ -0,0 +1,324 @@
+#pragma once
+#include "SurvivantCore/ECS/Archetype.h"
+#include "SurvivantCore/ECS/Component.h"
+#include "SurvivantCore/ECS/Entity.h"
+#include "SurvivantCore/ECS/Query.h"
+#include "SurvivantCore/ECS/SparseSet.h"
+#include "SurvivantCore/ECS/View.h"
+
+#include <array>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace SvCore::ECS
+{
+    /**
+     * \brief Archetype-based entity component system.\n
+     * Entities with the same set of components share an archetype, which stores their components in contiguous
+     * chunks. Adding or removing a component moves the entity to another archetype, found through the archetypes'
+     * cached edges. Components marked with SV_SPARSE_COMPONENT are kept in per-type sparse sets instead, so adding
+     * and removing them never moves the entity. Not thread-safe - structural changes must be made from a single
+     * thread, outside of iterations
+     */
+    class World
+    {
+    public:
+        /**
+         * \brief Creates an empty world
+         */
+        World();
+
+        /**
+         * \brief Disable world copying
+         */
+        World(const World& p_other) = delete;
+
+        /**
+         * \brief Disable world moving
+         */
+        World(World&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the world's entities
+         */
+        ~World();
+
+        /**
+         * \brief Disable world copying
+         */
+        World& operator=(const World& p_other) = delete;
+
+        /**
+         * \brief Disable world moving
+         */
+        World& operator=(World&& p_other) noexcept = delete;
+
+        /**
+         * \brief Creates an entity without components
+         * \return The created entity
+         */
+        Entity CreateEntity();
+
+        /**
+         * \brief Creates an entity with the given components
+         * \tparam T The components' types. Must all be different
+         * \param p_components The entity's components
+         * \return The created entity
+         */
+        template <class... T>
+        Entity CreateEntity(T&&... p_components);
+
+        /**
+         * \brief Creates the given number of entities, each with a copy of the given components
+         * \tparam T The components' types. Must all be different
+         * \param p_count The number of entities to create
+         * \param p_components The components to copy to each entity
+         * \return The created entities
+         */
+        template <class... T>
+        std::vector<Entity> CreateEntities(size_t p_count, const T&... p_components);
+
+        /**
+         * \brief Creates the given number of entities, each with a copy of the given components, when the component
+         * types are only known at runtime. Archetype components are copied in parallel on the job system
+         * \param p_count The number of entities to create
+         * \param p_ids The components' type ids. Must all be different
+         * \param p_components For each component type, the component to copy to each entity. The components must be
+         * copy constructible, and safe to copy from several threads at once
+         * \return The created entities
+         */
+        std::vector<Entity> CreateEntitiesFrom(size_t p_count, std::span<const ComponentId> p_ids,
+                                               std::span<const void* const> p_components);
+
+        /**
+         * \brief Destroys the given entity and its components. Does nothing if the entity isn't alive
+         * \param p_entity The entity to destroy
+         */
+        void DestroyEntity(Entity p_entity);
+
+        /**
+         * \brief Checks whether the given entity exists in the world
+         * \param p_entity The entity to check
+         * \return True if the entity is alive. False if it was destroyed or created by another world
+         */
+        bool IsAlive(Entity p_entity) const;
+
+        /**
+         * \brief Adds a component to the given entity, moving it to the matching archetype for archetype components.\n
+         * Replaces the component if the entity already has one of the given type
+         * \tparam T The component's type
+         * \tparam Args The component's constructor parameters' types
+         * \param p_entity The entity to add the component to
+         * \param p_args The component's constructor parameters
+         * \return A pointer to the added component, valid until the next structural change. Nullptr if the entity
+         * isn't alive
+         */
+        template <class T, class... Args>
+        T* AddComponent(Entity p_entity, Args&&... p_args);
+
+        /**
+         * \brief Removes a component from the given entity, moving it to the matching archetype for archetype
+         * components
+         * \tparam T The component's type
+         * \param p_entity The entity to remove the component from
+         * \return True if the component was removed. False if the entity isn't alive or doesn't have the component
+         */
+        template <class T>
+        bool RemoveComponent(Entity p_entity);
+
+        /**
+         * \brief Copies components of the given types to each of the given entities. Meant for bulk loading, where
+         * the component types are only known at runtime
+         * \param p_entities The entities to add the components to. Dead entities are skipped. Must not already have
+         * any of the components
+         * \param p_ids The added components' type ids. Must all be different
+         * \param p_sources For each component type, a packed array of one component per entity to copy from. The
+         * components must be copy constructible
+         */
+        void AddComponents(std::span<const Entity> p_entities, std::span<const ComponentId> p_ids,
+                           std::span<const void* const> p_sources);
+
+        /**
+         * \brief Gets the given entity's component
+         * \tparam T The component's type
+         * \param p_entity The component's entity
+         * \return A pointer to the component, valid until the next structural change. Nullptr if the entity isn't
+         * alive or doesn't have the component
+         */
+        template <class T>
+        T* GetComponent(Entity p_entity) const;
+
+        /**
+         * \brief Gets the given entity's component of the given type, when the type is only known at runtime
+         * \param p_entity The component's entity
+         * \param p_id The component's type id
+         * \return A pointer to the component, valid until the next structural change. Nullptr if the entity isn't
+         * alive or doesn't have the component
+         */
+        void* GetComponent(Entity p_entity, ComponentId p_id) const;
+
+        /**
+         * \brief Checks whether the given entity has a component of the given type
+         * \tparam T The component's type
+         * \param p_entity The entity to check
+         * \return True if the entity is alive and has the component. False otherwise
+         */
+        template <class T>
+        bool HasComponent(Entity p_entity) const;
+
+        /**
+         * \brief Gets a query over the entities having the given components. The matching archetypes are cached,
+         * so getting the same query again is cheap
+         * \tparam T The required components' types
+         * \return The query
+         */
+        template <class... T>
+        Query<T...> GetQuery();
+
+        /**
+         * \brief Gets a view over the entities having the given sparse components
+         * \tparam T The required components' types. Must all be sparse components
+         * \return The view
+         */
+        template <class... T>
+        View<T...> GetView();
+
+        /**
+         * \brief Removes the given sparse component from every entity at once
+         * \tparam T The component's type. Must be a sparse component
+         */
+        template <class T>
+        void ClearComponents();
+
+        /**
+         * \brief Gets every alive entity, by increasing index
+         * \return The world's entities
+         */
+        std::vector<Entity> GetEntities() const;
+
+        /**
+         * \brief Gets the number of alive entities
+         * \return The world's entity count
+         */
+        size_t GetEntityCount() const;
+
+        /**
+         * \brief Gets the number of archetypes created so far
+         * \return The world's archetype count
+         */
+        size_t GetArchetypeCount() const;
+
+    private:
+        struct EntityRecord
+        {
+            Archetype* m_archetype  = nullptr;
+            uint32_t   m_row        = 0;
+            uint32_t   m_generation = 0;
+            uint32_t   m_nextFree   = Entity::INVALID_INDEX;
+        };
+
+        std::unordered_map<ComponentMask, std::unique_ptr<Archetype>>  m_archetypes;
+        std::unordered_map<ComponentMask, std::unique_ptr<QueryCache>> m_queries;
+        std::array<std::unique_ptr<ISparseSet>, MAX_COMPONENT_COUNT>   m_sparseSets;
+        std::vector<EntityRecord>                                      m_records;
+        Archetype*                                                     m_emptyArchetype = nullptr;
+        uint32_t                                                       m_freeHead       = Entity::INVALID_INDEX;
+        size_t                                                         m_entityCount    = 0;
+
+        /**
+         * \brief Gets the record of the given entity
+         * \param p_entity The entity
+         * \return The entity's record. Nullptr if the entity isn't alive
+         */
+        EntityRecord* GetRecord(Entity p_entity) const;
+
+        /**
+         * \brief Takes a free entity index, or adds one
+         * \return The new entity. Its record must be placed in an archetype
+         */
+        Entity AllocateEntity();
+
+        /**
+         * \brief Gets the mask of the given archetype components, ignoring sparse components
+         * \tparam T The components' types. Must all be different
+         * \return The components' mask
+         */
+        template <class... T>
+        static ComponentMask GetArchetypeMask();
+
+        /**
+         * \brief Gets the sparse set storing the given component type, creating it if needed
+         * \tparam T The component's type
+         * \return The component's sparse set
+         */
+        template <class T>
+        SparseSet<T>& GetSparseSet();
+
+        /**
+         * \brief Gets the sparse set storing the given component type
+         * \tparam T The component's type
+         * \return The component's sparse set. Nullptr if no component of this type was added yet
+         */
+        template <class T>
+        SparseSet<T>* FindSparseSet() const;
+
+        /**
+         * \brief Gets the sparse set storing the component type with the given id, creating it if needed
+         * \param p_id The sparse component's type id
+         * \return The component's sparse set
+         */
+        ISparseSet& GetSparseSet(ComponentId p_id);
+
+        /**
+         * \brief Constructs a component of a new entity, in its archetype row or its sparse set
+         * \tparam T The component's type
+         * \param p_archetype The entity's archetype
+         * \param p_row The entity's row
+         * \param p_entity The entity
+         * \param p_component The component's value
+         */
+        template <class T, class U>
+        void PlaceComponent(Archetype& p_archetype, uint32_t p_row, Entity p_entity, U&& p_component);
+
+        /**
+         * \brief Gets the archetype with the given components, creating it if needed
+         * \param p_mask The archetype's components
+         * \return The archetype
+         */
+        Archetype& GetArchetype(const ComponentMask& p_mask);
+
+        /**
+         * \brief Gets the archetype reached by adding the given component to the given archetype
+         * \param p_source The archetype to add the component to
+         * \param p_id The added component's id
+         * \return The archetype with the added component
+         */
+        Archetype& GetAddTarget(Archetype& p_source, ComponentId p_id);
+
+        /**
+         * \brief Gets the archetype reached by removing the given component from the given archetype
+         * \param p_source The archetype to remove the component from
+         * \param p_id The removed component's id
+         * \return The archetype without the removed component
+         */
+        Archetype& GetRemoveTarget(Archetype& p_source, ComponentId p_id);
+
+        /**
+         * \brief Moves the given entity's components to another archetype
+         * \param p_record The entity's record
+         * \param p_destination The archetype to move the entity to
+         */
+        void MoveEntity(EntityRecord& p_record, Archetype& p_destination);
+
+        /**
+         * \brief Points the record of an entity moved by a row removal to its new row
+         * \param p_movedEntity The moved entity. Ignored if invalid
+         * \param p_row The entity's new row
+         */
+        void OnRowMoved(Entity p_movedEntity, uint32_t p_row);
+    };
+}
+
+#include "SurvivantCore/ECS/World.inl"
@@ -0,0 +1,222 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/ECS/World.h"
+
+#include <array>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace SvCore::ECS
+{
+    template <class... T>
+    Entity World::CreateEntity(T&&... p_components)
+    {
+        Archetype&     archetype = GetArchetype(GetArchetypeMask<T...>());
+        const Entity   entity    = AllocateEntity();
+        const uint32_t row       = archetype.AddRow(entity);
+
+        m_records[entity.m_index].m_archetype = &archetype;
+        m_records[entity.m_index].m_row       = row;
+
+        (PlaceComponent<std::decay_t<T>>(archetype, row, entity, std::forward<T>(p_components)), ...);
+
+        return entity;
+    }
+
+    template <class... T>
+    std::vector<Entity> World::CreateEntities(const size_t p_count, const T&... p_components)
+    {
+        Archetype& archetype = GetArchetype(GetArchetypeMask<T...>());
+
+        std::vector<Entity> entities;
+        entities.reserve(p_count);
+
+        for (size_t i = 0; i < p_count; ++i)
+        {
+            const Entity   entity = AllocateEntity();
+            const uint32_t row    = archetype.AddRow(entity);
+
+            m_records[entity.m_index].m_archetype = &archetype;
+            m_records[entity.m_index].m_row       = row;
+
+            (PlaceComponent<T>(archetype, row, entity, p_components), ...);
+            entities.push_back(entity);
+        }
+
+        return entities;
+    }
+
+    template <class T, class... Args>
+    T* World::AddComponent(const Entity p_entity, Args&&... p_args)
+    {
+        static_assert(std::is_same_v<T, std::decay_t<T>>, "Component types can't be const or references");
+
+        EntityRecord* record = GetRecord(p_entity);
+
+        if (!record)
+            return nullptr;
+
+        if constexpr (IS_SPARSE_COMPONENT<T>)
+        {
+            return &GetSparseSet<T>().Emplace(p_entity, std::forward<Args>(p_args)...);
+        }
+        else
+        {
+            const ComponentId id     = GetComponentId<T>();
+            Archetype&        source = *record->m_archetype;
+
+            if (const uint32_t column = source.GetColumn(id); column != Archetype::INVALID_COLUMN)
+            {
+                T* component = static_cast<T*>(source.GetComponent(record->m_row, column));
+                *component   = T(std::forward<Args>(p_args)...);
+                return component;
+            }
+
+            // Built before moving the entity so a throwing constructor leaves it untouched
+            T component(std::forward<Args>(p_args)...);
+
+            Archetype& destination = GetAddTarget(source, id);
+            MoveEntity(*record, destination);
+
+            return new(destination.GetComponent(record->m_row, destination.GetColumn(id))) T(std::move(component));
+        }
+    }
+
+    template <class T>
+    bool World::RemoveComponent(const Entity p_entity)
+    {
+        if constexpr (IS_SPARSE_COMPONENT<T>)
+        {
+            SparseSet<std::decay_t<T>>* set = FindSparseSet<std::decay_t<T>>();
+            return set && set->Remove(p_entity);
+        }
+        else
+        {
+            EntityRecord* record = GetRecord(p_entity);
+            const ComponentId id = GetComponentId<T>();
+
+            if (!record || record->m_archetype->GetColumn(id) == Archetype::INVALID_COLUMN)
+                return false;
+
+            MoveEntity(*record, GetRemoveTarget(*record->m_archetype, id));
+            return true;
+        }
+    }
+
+    template <class T>
+    T* World::GetComponent(const Entity p_entity) const
+    {
+        if constexpr (IS_SPARSE_COMPONENT<T>)
+        {
+            // Entities are removed from the sparse sets when destroyed, so no alive check is needed
+            SparseSet<std::remove_const_t<T>>* set = FindSparseSet<std::remove_const_t<T>>();
+            return set ? set->Get(p_entity) : nullptr;
+        }
+        else
+        {
+            const EntityRecord* record = GetRecord(p_entity);
+
+            if (!record)
+                return nullptr;
+
+            const uint32_t column = record->m_archetype->GetColumn(GetComponentId<T>());
+            return column != Archetype::INVALID_COLUMN ?
+                static_cast<T*>(record->m_archetype->GetComponent(record->m_row, column)) : nullptr;
+        }
+    }
+
+    template <class T>
+    bool World::HasComponent(const Entity p_entity) const
+    {
+        if constexpr (IS_SPARSE_COMPONENT<T>)
+        {
+            const ISparseSet* set = FindSparseSet<std::decay_t<T>>();
+            return set && set->Contains(p_entity);
+        }
+        else
+        {
+            const EntityRecord* record = GetRecord(p_entity);
+            return record && record->m_archetype->GetColumn(GetComponentId<T>()) != Archetype::INVALID_COLUMN;
+        }
+    }
+
+    template <class... T>
+    Query<T...> World::GetQuery()
+    {
+        static_assert(!(IS_SPARSE_COMPONENT<T> || ...), "Queries can't match sparse components, use GetView instead");
+
+        ComponentMask mask;
+        (mask.set(GetComponentId<T>()), ...);
+
+        std::unique_ptr<QueryCache>& cache = m_queries[mask];
+
+        if (!cache)
+        {
+            cache         = std::make_unique<QueryCache>();
+            cache->m_mask = mask;
+
+            for (const auto& [archetypeMask, archetype] : m_archetypes)
+            {
+                if ((archetypeMask & mask) == mask)
+                    cache->m_archetypes.push_back(archetype.get());
+            }
+        }
+
+        return Query<T...>(*cache);
+    }
+
+    template <class... T>
+    View<T...> World::GetView()
+    {
+        static_assert((IS_SPARSE_COMPONENT<T> && ...), "Views only match sparse components, use GetQuery instead");
+        ASSERT(GetArchetypeMask<T...>().none(), "A view can't have several components of the same type");
+
+        return View<T...>(GetSparseSet<std::remove_const_t<T>>()...);
+    }
+
+    template <class T>
+    void World::ClearComponents()
+    {
+        static_assert(IS_SPARSE_COMPONENT<T>, "Only sparse components can be cleared at once");
+
+        if (SparseSet<T>* set = FindSparseSet<T>())
+            set->Clear();
+    }
+
+    template <class... T>
+    ComponentMask World::GetArchetypeMask()
+    {
+        ComponentMask mask;
+        ComponentMask sparseMask;
+        ((IS_SPARSE_COMPONENT<T> ? sparseMask : mask).set(GetComponentId<T>()), ...);
+        ASSERT(mask.count() + sparseMask.count() == sizeof...(T),
+            "An entity can't have several components of the same type");
+
+        return mask;
+    }
+
+    template <class T>
+    SparseSet<T>& World::GetSparseSet()
+    {
+        static_assert(std::is_same_v<T, std::decay_t<T>>, "Component types can't be const or references");
+
+        return static_cast<SparseSet<T>&>(GetSparseSet(GetComponentId<T>()));
+    }
+
+    template <class T>
+    SparseSet<T>* World::FindSparseSet() const
+    {
+        return static_cast<SparseSet<T>*>(m_sparseSets[GetComponentId<T>()].get());
+    }
+
+    template <class T, class U>
+    void World::PlaceComponent(Archetype& p_archetype, const uint32_t p_row, const Entity p_entity, U&& p_component)
+    {
+        if constexpr (IS_SPARSE_COMPONENT<T>)
+            GetSparseSet<T>().Emplace(p_entity, std::forward<U>(p_component));
+        else
+            new(p_archetype.GetComponent(p_row, p_archetype.GetColumn(GetComponentId<T>())))
+                T(std::forward<U>(p_component));
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace SvCore::Enums
+{
+    /**
+     * \brief The types of the serialized fields of a component
+     */
+    enum class EFieldType : uint8_t
+    {
+        BOOL,
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT,
+        DOUBLE,
+        ENTITY,
+        RESOURCE
+    };
+
+    /**
+     * \brief Gets the size of a single value of the given field type
+     * \param p_type The field's type
+     * \return The value's size in bytes
+     */
+    constexpr size_t GetFieldTypeSize(const EFieldType p_type)
+    {
+        switch (p_type)
+        {
+        case EFieldType::BOOL:
+            return 1;
+        case EFieldType::INT32:
+        case EFieldType::UINT32:
+        case EFieldType::FLOAT:
+            return 4;
+        case EFieldType::INT64:
+        case EFieldType::UINT64:
+        case EFieldType::DOUBLE:
+        case EFieldType::ENTITY:
+        case EFieldType::RESOURCE:
+        default:
+            return 8;
+        }
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::Enums
+{
+    /**
+     * \brief The states of an asynchronous resource load
+     */
+    enum class ELoadState : uint8_t
+    {
+        INVALID,
+        QUEUED,
+        LOADING,
+        LOADED,
+        READY,
+        FAILED
+    };
+}
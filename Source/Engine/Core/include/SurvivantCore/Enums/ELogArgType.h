@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::Enums
+{
+    /**
+     * \brief The types a log argument can be stored as in a binary log record
+     */
+    enum class ELogArgType : uint8_t
+    {
+        INT,
+        UINT,
+        FLOAT,
+        STRING,
+        POINTER
+    };
+}
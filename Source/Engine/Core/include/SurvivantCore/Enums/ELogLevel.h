@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::Enums
+{
+    /**
+     * \brief The severity levels of a log message, from least to most severe.\n
+     * The highest level isn't called ERROR since windows.h defines it as a macro
+     */
+    enum class ELogLevel : uint8_t
+    {
+        TRACE,
+        DEBUG,
+        INFO,
+        WARNING,
+        SEVERE
+    };
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::Enums
+{
+    /**
+     * \brief What an asynchronous logger does with a message when its buffer is full
+     */
+    enum class ELogOverflow : uint8_t
+    {
+        DROP,
+        BLOCK
+    };
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace SvCore::Enums
+{
+    /**
+     * \brief The subsystems heap allocations are attributed to
+     */
+    enum class EMemoryTag : uint8_t
+    {
+        UNTAGGED,
+        CORE,
+        RESOURCES,
+        TEXTURES,
+        MESHES,
+        SHADERS,
+        RENDERING,
+        PROFILING,
+        LOGGING,
+        SCENE
+    };
+
+    constexpr size_t MEMORY_TAG_COUNT = static_cast<size_t>(EMemoryTag::SCENE) + 1;
+}
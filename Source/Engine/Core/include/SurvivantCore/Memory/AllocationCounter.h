@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Counts the calls to the global operator new and delete, which go through the MemoryTracker.\n
+     * The counting operators replace the default ones in any program that uses this class
+     */
+    class AllocationCounter
+    {
+    public:
+        /**
+         * \brief Gets the number of global heap allocations since the program's start
+         * \return The number of heap allocations
+         */
+        static size_t GetAllocationCount();
+
+        /**
+         * \brief Gets the number of global heap deallocations since the program's start
+         * \return The number of heap deallocations
+         */
+        static size_t GetFreeCount();
+
+        /**
+         * \brief Gets the number of bytes requested from the global heap since the program's start
+         * \return The number of allocated bytes
+         */
+        static size_t GetAllocatedBytes();
+    };
+}
@@ -0,0 +1,197 @@
+#pragma once
+#include "SurvivantCore/Memory/IObjectPool.h"
+#include "SurvivantCore/Memory/PoolChunks.h"
+#include "SurvivantCore/Memory/PoolHandle.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Thread-safe fixed-size object pool.\n
+     * Each thread takes and returns slots through its own thread-local cache without locking. Caches only lock the
+     * shared free list to exchange batches of free slots with it, and give their slots back when their thread exits.
+     * Objects freed after that (e.g. by static destructors) go straight to the shared free list
+     * \tparam T The pooled objects' type
+     */
+    template <class T>
+    class ConcurrentObjectPool final : public IObjectPool
+    {
+    public:
+        static constexpr size_t BATCH_SIZE = 32;
+
+        struct Deleter
+        {
+            ConcurrentObjectPool* m_pool = nullptr;
+
+            void operator()(T* p_object) const;
+        };
+
+        using Ptr = std::unique_ptr<T, Deleter>;
+
+        /**
+         * \brief Creates an empty object pool
+         * \param p_name The pool's name in memory reports
+         */
+        explicit ConcurrentObjectPool(std::string p_name);
+
+        /**
+         * \brief Destroys the pool and the objects it still holds
+         */
+        ~ConcurrentObjectPool() override;
+
+        /**
+         * \brief Constructs an object in the pool
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A handle to the created object
+         */
+        template <class... Args>
+        PoolHandle<T> Create(Args&&... p_args);
+
+        /**
+         * \brief Destroys the object referenced by the given handle. Does nothing if the handle is stale
+         * \param p_handle The object's handle
+         */
+        void Destroy(PoolHandle<T> p_handle);
+
+        /**
+         * \brief Gets the object referenced by the given handle
+         * \param p_handle The object's handle
+         * \return A pointer to the object. Nullptr if the handle is invalid or stale
+         */
+        T* Get(PoolHandle<T> p_handle) const;
+
+        /**
+         * \brief Constructs an object in the pool
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A pointer to the created object
+         */
+        template <class... Args>
+        T* New(Args&&... p_args);
+
+        /**
+         * \brief Destroys the given object
+         * \param p_object The object to destroy. Must have been created by this pool
+         */
+        void Delete(T* p_object);
+
+        /**
+         * \brief Constructs an object in the pool, destroyed with its owning pointer
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return An owning pointer to the created object
+         */
+        template <class... Args>
+        Ptr MakeUnique(Args&&... p_args);
+
+        /**
+         * \brief Gets a handle to the given object
+         * \param p_object The object to reference. Must have been created by this pool
+         * \return A handle to the object
+         */
+        PoolHandle<T> GetHandle(T* p_object) const;
+
+        /**
+         * \brief Gets the pool's current memory usage
+         * \return The pool's stats
+         */
+        PoolStats GetStats() const override;
+
+    private:
+        using Slot = typename PoolChunks<T>::Slot;
+
+        struct Cache
+        {
+            uint64_t              m_poolId;
+            std::vector<uint32_t> m_freeSlots;
+        };
+
+        /**
+         * \brief A thread's caches, one per pool of this type it used
+         */
+        struct ThreadCaches
+        {
+            std::vector<Cache> m_caches;
+        };
+
+        /**
+         * \brief Frees the calling thread's caches when the thread exits
+         */
+        struct ThreadCachesOwner
+        {
+            /**
+             * \brief Gives the cached slots back to their pools, if they are still alive, then frees the caches
+             */
+            ~ThreadCachesOwner();
+        };
+
+        /**
+         * \brief The live pools of this type, for exiting threads to find the owners of their cached slots
+         */
+        struct PoolRegistry
+        {
+            std::unordered_map<uint64_t, ConcurrentObjectPool*> m_pools;
+            uint64_t                                            m_nextId = 0;
+            std::mutex                                          m_mutex;
+        };
+
+        PoolChunks<T>         m_chunks;
+        std::string           m_name;
+        uint64_t              m_id;
+        std::vector<uint32_t> m_freeSlots;
+        std::mutex            m_mutex;
+        std::atomic<size_t>   m_liveCount    = 0;
+        std::atomic<size_t>   m_peakCount    = 0;
+        std::atomic<size_t>   m_createdCount = 0;
+
+        // Trivially destructible so they stay usable while the thread's statics are destroyed, after its caches
+        static thread_local ThreadCaches* s_threadCaches;
+        static thread_local bool          s_areThreadCachesGone;
+
+        /**
+         * \brief Gets the registry of the live pools of this type
+         * \return The pool registry
+         */
+        static PoolRegistry& GetRegistry();
+
+        /**
+         * \brief Gets the calling thread's cache for this pool, creating it on first use
+         * \return The calling thread's cache. Nullptr if the thread's caches were already freed
+         */
+        Cache* GetCache();
+
+        /**
+         * \brief Grows the pool if the shared free list is empty. m_mutex must be held
+         */
+        void ReserveFreeSlots();
+
+        /**
+         * \brief Moves the given free slots to the shared free list
+         * \param p_freeSlots The slots to give back
+         * \param p_count The number of slots to move, from the end of the list
+         */
+        void Spill(std::vector<uint32_t>& p_freeSlots, size_t p_count);
+
+        /**
+         * \brief Takes a free slot, refilling the calling thread's cache if needed
+         * \return The free slot
+         */
+        Slot& AcquireSlot();
+
+        /**
+         * \brief Returns the given slot to the calling thread's cache, or to the shared free list once the thread's
+         * caches are freed
+         * \param p_slot The freed slot
+         */
+        void ReleaseSlot(Slot& p_slot);
+    };
+}
+
+#include "SurvivantCore/Memory/ConcurrentObjectPool.inl"
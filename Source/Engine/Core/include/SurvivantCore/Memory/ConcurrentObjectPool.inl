@@ -0,0 +1,289 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/Memory/ConcurrentObjectPool.h"
+
+#include <algorithm>
+#include <new>
+
+namespace SvCore::Memory
+{
+    template <class T>
+    void ConcurrentObjectPool<T>::Deleter::operator()(T* p_object) const
+    {
+        m_pool->Delete(p_object);
+    }
+
+    template <class T>
+    thread_local typename ConcurrentObjectPool<T>::ThreadCaches* ConcurrentObjectPool<T>::s_threadCaches = nullptr;
+
+    template <class T>
+    thread_local bool ConcurrentObjectPool<T>::s_areThreadCachesGone = false;
+
+    template <class T>
+    ConcurrentObjectPool<T>::ThreadCachesOwner::~ThreadCachesOwner()
+    {
+        {
+            PoolRegistry& registry = GetRegistry();
+
+            std::scoped_lock lock(registry.m_mutex);
+
+            for (Cache& cache : s_threadCaches->m_caches)
+            {
+                // Pools unregister before being destroyed, so a registered pool stays alive while the lock is held
+                if (const auto it = registry.m_pools.find(cache.m_poolId); it != registry.m_pools.end())
+                    it->second->Spill(cache.m_freeSlots, cache.m_freeSlots.size());
+            }
+        }
+
+        delete s_threadCaches;
+        s_threadCaches        = nullptr;
+        s_areThreadCachesGone = true;
+    }
+
+    template <class T>
+    ConcurrentObjectPool<T>::ConcurrentObjectPool(std::string p_name)
+        : m_name(std::move(p_name))
+    {
+        PoolRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        m_id = registry.m_nextId++;
+        registry.m_pools.emplace(m_id, this);
+    }
+
+    template <class T>
+    ConcurrentObjectPool<T>::~ConcurrentObjectPool()
+    {
+        {
+            PoolRegistry& registry = GetRegistry();
+
+            std::scoped_lock lock(registry.m_mutex);
+            registry.m_pools.erase(m_id);
+        }
+
+        const size_t liveCount = m_liveCount.load(std::memory_order_relaxed);
+
+        if (liveCount == 0)
+            return;
+
+        SV_LOG_WARNING("Pool \"%s\" destroyed with %zu live objects", m_name.c_str(), liveCount);
+
+        for (uint32_t i = 0; i < m_chunks.GetCapacity(); ++i)
+        {
+            if (m_chunks[i].m_generation.load(std::memory_order_relaxed) & 1)
+                m_chunks[i].GetObject()->~T();
+        }
+    }
+
+    template <class T>
+    template <class... Args>
+    PoolHandle<T> ConcurrentObjectPool<T>::Create(Args&&... p_args)
+    {
+        return GetHandle(New(std::forward<Args>(p_args)...));
+    }
+
+    template <class T>
+    void ConcurrentObjectPool<T>::Destroy(const PoolHandle<T> p_handle)
+    {
+        if (T* object = Get(p_handle))
+            Delete(object);
+    }
+
+    template <class T>
+    T* ConcurrentObjectPool<T>::Get(const PoolHandle<T> p_handle) const
+    {
+        if (p_handle.m_index >= m_chunks.GetCapacity())
+            return nullptr;
+
+        Slot& slot = m_chunks[p_handle.m_index];
+        return slot.m_generation.load(std::memory_order_acquire) == p_handle.m_generation ? slot.GetObject() : nullptr;
+    }
+
+    template <class T>
+    template <class... Args>
+    T* ConcurrentObjectPool<T>::New(Args&&... p_args)
+    {
+        Slot& slot   = AcquireSlot();
+        T*    object = new(slot.m_storage) T(std::forward<Args>(p_args)...);
+
+        slot.m_generation.fetch_add(1, std::memory_order_release);
+
+        const size_t liveCount = m_liveCount.fetch_add(1, std::memory_order_relaxed) + 1;
+        size_t       peakCount = m_peakCount.load(std::memory_order_relaxed);
+
+        while (liveCount > peakCount && !m_peakCount.compare_exchange_weak(peakCount, liveCount, std::memory_order_relaxed))
+        {
+        }
+
+        m_createdCount.fetch_add(1, std::memory_order_relaxed);
+
+        return object;
+    }
+
+    template <class T>
+    void ConcurrentObjectPool<T>::Delete(T* p_object)
+    {
+        if (!p_object)
+            return;
+
+        Slot& slot = PoolChunks<T>::FromObject(p_object);
+        ASSERT(slot.m_generation.load(std::memory_order_relaxed) & 1, "Deleted pool object is not alive");
+
+        p_object->~T();
+        slot.m_generation.fetch_add(1, std::memory_order_release);
+
+        m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+        ReleaseSlot(slot);
+    }
+
+    template <class T>
+    template <class... Args>
+    typename ConcurrentObjectPool<T>::Ptr ConcurrentObjectPool<T>::MakeUnique(Args&&... p_args)
+    {
+        return Ptr(New(std::forward<Args>(p_args)...), Deleter{ this });
+    }
+
+    template <class T>
+    PoolHandle<T> ConcurrentObjectPool<T>::GetHandle(T* p_object) const
+    {
+        if (!p_object)
+            return {};
+
+        const Slot& slot = PoolChunks<T>::FromObject(p_object);
+        return { slot.m_index, slot.m_generation.load(std::memory_order_acquire) };
+    }
+
+    template <class T>
+    PoolStats ConcurrentObjectPool<T>::GetStats() const
+    {
+        const size_t capacity = m_chunks.GetCapacity();
+
+        return {
+            m_name, sizeof(T), capacity, m_liveCount.load(std::memory_order_relaxed),
+            m_peakCount.load(std::memory_order_relaxed), m_createdCount.load(std::memory_order_relaxed),
+            capacity * sizeof(Slot)
+        };
+    }
+
+    template <class T>
+    typename ConcurrentObjectPool<T>::PoolRegistry& ConcurrentObjectPool<T>::GetRegistry()
+    {
+        // Never destroyed - threads can exit after the static pools are destroyed
+        static PoolRegistry* registry = new PoolRegistry();
+        return *registry;
+    }
+
+    template <class T>
+    typename ConcurrentObjectPool<T>::Cache* ConcurrentObjectPool<T>::GetCache()
+    {
+        if (!s_threadCaches)
+        {
+            if (s_areThreadCachesGone)
+                return nullptr;
+
+            // Only the owner has a destructor, which runs before the thread's statics are destroyed
+            thread_local ThreadCachesOwner owner;
+            s_threadCaches = new ThreadCaches();
+        }
+
+        ThreadCaches& threadCaches = *s_threadCaches;
+
+        // Threads use few pools of a given type, so a linear search is enough
+        for (Cache& cache : threadCaches.m_caches)
+        {
+            if (cache.m_poolId == m_id)
+                return &cache;
+        }
+
+        // Caches of destroyed pools are dropped on first use of a new pool, which is rare
+        {
+            PoolRegistry& registry = GetRegistry();
+
+            std::scoped_lock lock(registry.m_mutex);
+
+            std::erase_if(threadCaches.m_caches, [&registry](const Cache& p_cache)
+            {
+                return !registry.m_pools.contains(p_cache.m_poolId);
+            });
+        }
+
+        return &threadCaches.m_caches.emplace_back(Cache{ m_id, {} });
+    }
+
+    template <class T>
+    void ConcurrentObjectPool<T>::Spill(std::vector<uint32_t>& p_freeSlots, const size_t p_count)
+    {
+        std::scoped_lock lock(m_mutex);
+
+        m_freeSlots.insert(m_freeSlots.end(), p_freeSlots.end() - static_cast<ptrdiff_t>(p_count), p_freeSlots.end());
+        p_freeSlots.resize(p_freeSlots.size() - p_count);
+    }
+
+    template <class T>
+    void ConcurrentObjectPool<T>::ReserveFreeSlots()
+    {
+        if (!m_freeSlots.empty())
+            return;
+
+        const uint32_t first = m_chunks.Grow();
+
+        if (first == UINT32_MAX)
+            throw std::bad_alloc();
+
+        for (uint32_t i = PoolChunks<T>::CHUNK_SIZE; i > 0; --i)
+            m_freeSlots.push_back(first + i - 1);
+    }
+
+    template <class T>
+    typename ConcurrentObjectPool<T>::Slot& ConcurrentObjectPool<T>::AcquireSlot()
+    {
+        Cache* cache = GetCache();
+
+        if (!cache)
+        {
+            std::scoped_lock lock(m_mutex);
+            ReserveFreeSlots();
+
+            const uint32_t index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+
+            return m_chunks[index];
+        }
+
+        if (cache->m_freeSlots.empty())
+        {
+            std::scoped_lock lock(m_mutex);
+            ReserveFreeSlots();
+
+            const size_t count = std::min(BATCH_SIZE, m_freeSlots.size());
+            cache->m_freeSlots.insert(cache->m_freeSlots.end(), m_freeSlots.end() - static_cast<ptrdiff_t>(count),
+                                      m_freeSlots.end());
+            m_freeSlots.resize(m_freeSlots.size() - count);
+        }
+
+        const uint32_t index = cache->m_freeSlots.back();
+        cache->m_freeSlots.pop_back();
+
+        return m_chunks[index];
+    }
+
+    template <class T>
+    void ConcurrentObjectPool<T>::ReleaseSlot(Slot& p_slot)
+    {
+        Cache* cache = GetCache();
+
+        if (!cache)
+        {
+            std::scoped_lock lock(m_mutex);
+            m_freeSlots.push_back(p_slot.m_index);
+            return;
+        }
+
+        cache->m_freeSlots.push_back(p_slot.m_index);
+
+        // Give a batch back so slots freed by one thread can be reused by the others
+        if (cache->m_freeSlots.size() >= 2 * BATCH_SIZE)
+            Spill(cache->m_freeSlots, BATCH_SIZE);
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "SurvivantCore/Memory/LinearAllocator.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief The memory usage of a frame
+     */
+    struct FrameMemoryStats
+    {
+        size_t m_frameBytes          = 0;
+        size_t m_frameOverflowCount  = 0;
+        size_t m_heapAllocationCount = 0;
+        size_t m_heapFreeCount       = 0;
+    };
+
+    /**
+     * \brief Per-frame bump allocator for data that doesn't outlive the frame it was created in.\n
+     * The allocator cycles through FRAME_COUNT buffers so a frame's data stays valid until FRAME_COUNT - 1 frames later,
+     * e.g. while a render thread consumes it. Allocations are lock-free and can be made from any thread
+     */
+    class FrameAllocator
+    {
+    public:
+        static constexpr size_t FRAME_COUNT      = 3;
+        static constexpr size_t DEFAULT_CAPACITY = 4 * 1024 * 1024;
+
+        /**
+         * \brief Disable frame allocator copying
+         */
+        FrameAllocator(const FrameAllocator& p_other) = delete;
+
+        /**
+         * \brief Disable frame allocator moving
+         */
+        FrameAllocator(FrameAllocator&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the frame allocator
+         */
+        ~FrameAllocator() = default;
+
+        /**
+         * \brief Disable frame allocator copying
+         */
+        FrameAllocator& operator=(const FrameAllocator& p_other) = delete;
+
+        /**
+         * \brief Disable frame allocator moving
+         */
+        FrameAllocator& operator=(FrameAllocator&& p_other) noexcept = delete;
+
+        /**
+         * \brief Allocates a block of the given size and alignment in the current frame
+         * \param p_size The block's size in bytes
+         * \param p_alignment The block's alignment. Must be a power of two
+         * \return A pointer to the allocated block
+         */
+        void* Allocate(size_t p_size, size_t p_alignment = alignof(std::max_align_t));
+
+        /**
+         * \brief Constructs an object in the current frame. Its destructor is never called
+         * \tparam T The object's type
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A pointer to the constructed object
+         */
+        template <class T, class... Args>
+        T* New(Args&&... p_args);
+
+        /**
+         * \brief Gets a memory resource allocating in the current frame, for pmr containers
+         * \return The current frame's memory resource
+         */
+        std::pmr::memory_resource* GetResource();
+
+        /**
+         * \brief Moves to the next frame and releases the allocations made FRAME_COUNT frames ago. Main thread only
+         */
+        void EndFrame();
+
+        /**
+         * \brief Gets the memory usage of the last ended frame
+         * \return The last frame's memory stats
+         */
+        const FrameMemoryStats& GetLastFrameStats() const;
+
+        /**
+         * \brief Accessor to the FrameAllocator singleton
+         * \return A reference to the current FrameAllocator instance
+         */
+        static FrameAllocator& GetInstance();
+
+    private:
+        std::array<std::unique_ptr<LinearAllocator>, FRAME_COUNT> m_allocators;
+        std::atomic<LinearAllocator*>                             m_current;
+        size_t                                                    m_frameIndex    = 0;
+        size_t                                                    m_overflowCount = 0;
+        size_t                                                    m_heapAllocationCount;
+        size_t                                                    m_heapFreeCount;
+        FrameMemoryStats                                          m_lastFrameStats;
+
+        /**
+         * \brief Creates a frame allocator with DEFAULT_CAPACITY bytes per frame
+         */
+        FrameAllocator();
+    };
+}
+
+#include "SurvivantCore/Memory/FrameAllocator.inl"
@@ -0,0 +1,11 @@
+#pragma once
+#include "SurvivantCore/Memory/FrameAllocator.h"
+
+namespace SvCore::Memory
+{
+    template <class T, class... Args>
+    T* FrameAllocator::New(Args&&... p_args)
+    {
+        return m_current.load(std::memory_order_acquire)->New<T>(std::forward<Args>(p_args)...);
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief The memory usage of an object pool
+     */
+    struct PoolStats
+    {
+        std::string m_name;
+        size_t      m_objectSize    = 0;
+        size_t      m_capacity      = 0;
+        size_t      m_liveCount     = 0;
+        size_t      m_peakCount     = 0;
+        size_t      m_createdCount  = 0;
+        size_t      m_reservedBytes = 0;
+    };
+
+    /**
+     * \brief Base class of the object pools. Every pool is registered for memory reports while it is alive
+     */
+    class IObjectPool
+    {
+    public:
+        /**
+         * \brief Disable object pool copying
+         */
+        IObjectPool(const IObjectPool& p_other) = delete;
+
+        /**
+         * \brief Disable object pool moving
+         */
+        IObjectPool(IObjectPool&& p_other) noexcept = delete;
+
+        /**
+         * \brief Unregisters and destroys the pool
+         */
+        virtual ~IObjectPool();
+
+        /**
+         * \brief Disable object pool copying
+         */
+        IObjectPool& operator=(const IObjectPool& p_other) = delete;
+
+        /**
+         * \brief Disable object pool moving
+         */
+        IObjectPool& operator=(IObjectPool&& p_other) noexcept = delete;
+
+        /**
+         * \brief Gets the pool's current memory usage
+         * \return The pool's stats
+         */
+        virtual PoolStats GetStats() const = 0;
+
+        /**
+         * \brief Gets the memory usage of every alive pool
+         * \return The stats of every registered pool
+         */
+        static std::vector<PoolStats> GetAllStats();
+
+        /**
+         * \brief Logs the memory usage of every alive pool
+         */
+        static void LogAllStats();
+
+    protected:
+        /**
+         * \brief Registers the pool
+         */
+        IObjectPool();
+    };
+}
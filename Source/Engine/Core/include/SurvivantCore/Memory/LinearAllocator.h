@@ -0,0 +1,164 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Bump allocator over a fixed buffer. Individual deallocations are no-ops - the memory is reclaimed all at once
+     * by rewinding or resetting the allocator.\n
+     * Allocations are lock-free and can be made from any thread. Requests that don't fit are forwarded to the upstream
+     * resource and released with the next reset
+     */
+    class LinearAllocator final : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         * \brief A position in the allocator to rewind to
+         */
+        struct Marker
+        {
+            size_t m_offset;
+            size_t m_overflowBlockCount;
+        };
+
+        /**
+         * \brief Creates a linear allocator with the given capacity
+         * \param p_capacity The allocator's buffer size in bytes
+         * \param p_upstream The resource used for allocations that don't fit in the buffer
+         */
+        explicit LinearAllocator(size_t p_capacity, std::pmr::memory_resource* p_upstream = std::pmr::new_delete_resource());
+
+        /**
+         * \brief Disable linear allocator copying
+         */
+        LinearAllocator(const LinearAllocator& p_other) = delete;
+
+        /**
+         * \brief Disable linear allocator moving
+         */
+        LinearAllocator(LinearAllocator&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the allocator and releases its overflow allocations
+         */
+        ~LinearAllocator() override;
+
+        /**
+         * \brief Disable linear allocator copying
+         */
+        LinearAllocator& operator=(const LinearAllocator& p_other) = delete;
+
+        /**
+         * \brief Disable linear allocator moving
+         */
+        LinearAllocator& operator=(LinearAllocator&& p_other) noexcept = delete;
+
+        /**
+         * \brief Allocates a block of the given size and alignment
+         * \param p_size The block's size in bytes
+         * \param p_alignment The block's alignment. Must be a power of two
+         * \return A pointer to the allocated block
+         */
+        void* Allocate(size_t p_size, size_t p_alignment = alignof(std::max_align_t));
+
+        /**
+         * \brief Constructs an object in the allocator. Its destructor is never called
+         * \tparam T The object's type
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A pointer to the constructed object
+         */
+        template <class T, class... Args>
+        T* New(Args&&... p_args);
+
+        /**
+         * \brief Allocates an array of default constructed elements. Their destructors are never called
+         * \tparam T The elements' type
+         * \param p_count The number of elements
+         * \return A pointer to the first element
+         */
+        template <class T>
+        T* NewArray(size_t p_count);
+
+        /**
+         * \brief Gets the allocator's current position
+         * \return A marker to the allocator's current position
+         */
+        Marker GetMarker() const;
+
+        /**
+         * \brief Releases every allocation made after the given marker. Must not run concurrently with allocations
+         * \param p_marker The position to rewind to
+         */
+        void Rewind(const Marker& p_marker);
+
+        /**
+         * \brief Releases every allocation. Must not run concurrently with allocations
+         */
+        void Reset();
+
+        /**
+         * \brief Gets the number of bytes used in the allocator's buffer
+         * \return The allocator's used size in bytes
+         */
+        size_t GetUsedSize() const;
+
+        /**
+         * \brief Gets the allocator's buffer size
+         * \return The allocator's capacity in bytes
+         */
+        size_t GetCapacity() const;
+
+        /**
+         * \brief Gets the number of allocations forwarded to the upstream resource since the allocator's creation
+         * \return The number of overflowing allocations
+         */
+        size_t GetOverflowCount() const;
+
+    private:
+        struct OverflowBlock
+        {
+            void*  m_pointer;
+            size_t m_size;
+            size_t m_alignment;
+        };
+
+        std::unique_ptr<std::byte[]> m_buffer;
+        size_t                       m_capacity;
+        std::atomic<size_t>          m_offset        = 0;
+        std::atomic<size_t>          m_overflowCount = 0;
+        std::pmr::memory_resource*   m_upstream;
+        std::vector<OverflowBlock>   m_overflowBlocks;
+        mutable std::mutex           m_overflowMutex;
+
+        /**
+         * \brief Allocates a block of the given size and alignment
+         * \param p_bytes The block's size in bytes
+         * \param p_alignment The block's alignment
+         * \return A pointer to the allocated block
+         */
+        void* do_allocate(size_t p_bytes, size_t p_alignment) override;
+
+        /**
+         * \brief Does nothing - the memory is released by rewinding or resetting the allocator
+         * \param p_pointer The block to release
+         * \param p_bytes The block's size in bytes
+         * \param p_alignment The block's alignment
+         */
+        void do_deallocate(void* p_pointer, size_t p_bytes, size_t p_alignment) override;
+
+        /**
+         * \brief Checks whether memory allocated by the given resource can be released by this one
+         * \param p_other The resource to compare with
+         * \return True if the given resource is this allocator. False otherwise
+         */
+        bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override;
+    };
+}
+
+#include "SurvivantCore/Memory/LinearAllocator.inl"
@@ -0,0 +1,28 @@
+#pragma once
+#include "SurvivantCore/Memory/LinearAllocator.h"
+
+#include <new>
+#include <type_traits>
+
+namespace SvCore::Memory
+{
+    template <class T, class... Args>
+    T* LinearAllocator::New(Args&&... p_args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Linear allocations are never destroyed");
+        return new(Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(p_args)...);
+    }
+
+    template <class T>
+    T* LinearAllocator::NewArray(const size_t p_count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Linear allocations are never destroyed");
+
+        T* elements = static_cast<T*>(Allocate(sizeof(T) * p_count, alignof(T)));
+
+        for (size_t i = 0; i < p_count; ++i)
+            new(elements + i) T();
+
+        return elements;
+    }
+}
@@ -0,0 +1,187 @@
+#pragma once
+#include "SurvivantCore/Enums/EMemoryTag.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define SV_MEMORY_TAG_CONCAT_IMPL(a, b) a##b
+#define SV_MEMORY_TAG_CONCAT(a, b) SV_MEMORY_TAG_CONCAT_IMPL(a, b)
+
+// Attributes the calling thread's heap allocations to the given tag until the end of the scope
+#define SV_MEMORY_TAG(tag) const SvCore::Memory::MemoryTagScope SV_MEMORY_TAG_CONCAT(svMemoryTag, __LINE__)(tag)
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief The heap usage of a memory tag
+     */
+    struct MemoryTagStats
+    {
+        size_t m_liveBytes       = 0;
+        size_t m_peakBytes       = 0;
+        size_t m_allocatedBytes  = 0;
+        size_t m_allocationCount = 0;
+        size_t m_freeCount       = 0;
+    };
+
+    /**
+     * \brief The heap usage of every memory tag at the end of a frame
+     */
+    struct MemorySnapshot
+    {
+        uint64_t                                            m_frame = 0;
+        std::array<MemoryTagStats, Enums::MEMORY_TAG_COUNT> m_tags;
+        MemoryTagStats                                      m_total;
+    };
+
+    /**
+     * \brief A call site holding heap memory. Only tracked with SV_TRACK_ALLOCATION_SITES (opt-in from CMake)
+     */
+    struct AllocationSite
+    {
+        static constexpr size_t MAX_DEPTH = 6;
+
+        std::array<void*, MAX_DEPTH> m_frames{};
+        size_t                       m_liveBytes       = 0;
+        size_t                       m_allocationCount = 0;
+    };
+
+    /**
+     * \brief Attributes the calling thread's heap allocations to a tag while it is alive. Use the SV_MEMORY_TAG macro
+     */
+    class MemoryTagScope
+    {
+    public:
+        /**
+         * \brief Sets the calling thread's memory tag
+         * \param p_tag The tag to attribute allocations to
+         */
+        explicit MemoryTagScope(Enums::EMemoryTag p_tag);
+
+        /**
+         * \brief Disable memory tag scope copying
+         */
+        MemoryTagScope(const MemoryTagScope& p_other) = delete;
+
+        /**
+         * \brief Disable memory tag scope moving
+         */
+        MemoryTagScope(MemoryTagScope&& p_other) noexcept = delete;
+
+        /**
+         * \brief Restores the calling thread's previous memory tag
+         */
+        ~MemoryTagScope();
+
+        /**
+         * \brief Disable memory tag scope copying
+         */
+        MemoryTagScope& operator=(const MemoryTagScope& p_other) = delete;
+
+        /**
+         * \brief Disable memory tag scope moving
+         */
+        MemoryTagScope& operator=(MemoryTagScope&& p_other) noexcept = delete;
+
+    private:
+        Enums::EMemoryTag m_previousTag;
+    };
+
+    /**
+     * \brief Tracks every heap allocation by tag.\n
+     * The global operator new and delete are replaced to go through the tracker in any program using it. Each block is
+     * prefixed with a small header holding its size and tag, so frees are attributed without any lookup
+     */
+    class MemoryTracker
+    {
+    public:
+        static constexpr size_t SNAPSHOT_COUNT = 300;
+
+        /**
+         * \brief Allocates a tracked block
+         * \param p_size The block's size in bytes
+         * \param p_alignment The block's alignment. Must be a power of two
+         * \param p_tag The tag to attribute the block to
+         * \return A pointer to the allocated block. Nullptr on failure
+         */
+        static void* Allocate(size_t p_size, size_t p_alignment = alignof(std::max_align_t),
+                              Enums::EMemoryTag p_tag = GetCurrentTag());
+
+        /**
+         * \brief Resizes a tracked block, keeping its tag and alignment
+         * \param p_pointer The block to resize. Allocates a new block if null
+         * \param p_size The block's new size in bytes
+         * \return A pointer to the resized block. Nullptr on failure, in which case the given block is left untouched
+         */
+        static void* Reallocate(void* p_pointer, size_t p_size);
+
+        /**
+         * \brief Frees a tracked block
+         * \param p_pointer The block to free. Does nothing if null
+         */
+        static void Free(void* p_pointer);
+
+        /**
+         * \brief Gets the calling thread's memory tag
+         * \return The tag the calling thread's allocations are attributed to
+         */
+        static Enums::EMemoryTag GetCurrentTag();
+
+        /**
+         * \brief Gets the given tag's current heap usage
+         * \param p_tag The tag to get the stats of
+         * \return The tag's stats
+         */
+        static MemoryTagStats GetTagStats(Enums::EMemoryTag p_tag);
+
+        /**
+         * \brief Gets the heap usage of every tag combined
+         * \return The total heap stats
+         */
+        static MemoryTagStats GetTotalStats();
+
+        /**
+         * \brief Sets the number of live bytes above which a tag triggers a warning
+         * \param p_tag The tag to set the budget of
+         * \param p_bytes The tag's budget in bytes. 0 disables the budget
+         */
+        static void SetBudget(Enums::EMemoryTag p_tag, size_t p_bytes);
+
+        /**
+         * \brief Records the frame's snapshot and warns about the tags exceeding their budget. Main thread only
+         */
+        static void EndFrame();
+
+        /**
+         * \brief Gets the recorded snapshots, oldest first
+         * \return Up to the last SNAPSHOT_COUNT frame snapshots
+         */
+        static std::vector<MemorySnapshot> GetSnapshots();
+
+        /**
+         * \brief Gets the call sites holding the most live memory
+         * \param p_count The maximum number of sites to return
+         * \return The top call sites, sorted by live bytes. Empty without SV_TRACK_ALLOCATION_SITES
+         */
+        static std::vector<AllocationSite> GetTopSites(size_t p_count);
+
+        /**
+         * \brief Logs every tag's heap usage and, when tracked, the top call sites
+         */
+        static void LogReport();
+
+        /**
+         * \brief Gets the given tag's display name
+         * \param p_tag The tag to get the name of
+         * \return The tag's name
+         */
+        static const char* GetTagName(Enums::EMemoryTag p_tag);
+
+    private:
+        friend class MemoryTagScope;
+
+        static thread_local Enums::EMemoryTag s_currentTag;
+    };
+}
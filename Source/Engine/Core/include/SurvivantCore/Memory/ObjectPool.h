@@ -0,0 +1,117 @@
+#pragma once
+#include "SurvivantCore/Memory/IObjectPool.h"
+#include "SurvivantCore/Memory/PoolChunks.h"
+#include "SurvivantCore/Memory/PoolHandle.h"
+
+#include <memory>
+#include <string>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Fixed-size object pool. Freed slots are kept in a free list and reused by the next objects.\n
+     * Not thread-safe - use a ConcurrentObjectPool for objects created or destroyed from several threads
+     * \tparam T The pooled objects' type
+     */
+    template <class T>
+    class ObjectPool final : public IObjectPool
+    {
+    public:
+        struct Deleter
+        {
+            ObjectPool* m_pool = nullptr;
+
+            void operator()(T* p_object) const;
+        };
+
+        using Ptr = std::unique_ptr<T, Deleter>;
+
+        /**
+         * \brief Creates an empty object pool
+         * \param p_name The pool's name in memory reports
+         */
+        explicit ObjectPool(std::string p_name);
+
+        /**
+         * \brief Destroys the pool and the objects it still holds
+         */
+        ~ObjectPool() override;
+
+        /**
+         * \brief Constructs an object in the pool
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A handle to the created object
+         */
+        template <class... Args>
+        PoolHandle<T> Create(Args&&... p_args);
+
+        /**
+         * \brief Destroys the object referenced by the given handle. Does nothing if the handle is stale
+         * \param p_handle The object's handle
+         */
+        void Destroy(PoolHandle<T> p_handle);
+
+        /**
+         * \brief Gets the object referenced by the given handle
+         * \param p_handle The object's handle
+         * \return A pointer to the object. Nullptr if the handle is invalid or stale
+         */
+        T* Get(PoolHandle<T> p_handle) const;
+
+        /**
+         * \brief Constructs an object in the pool
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A pointer to the created object
+         */
+        template <class... Args>
+        T* New(Args&&... p_args);
+
+        /**
+         * \brief Destroys the given object
+         * \param p_object The object to destroy. Must have been created by this pool
+         */
+        void Delete(T* p_object);
+
+        /**
+         * \brief Constructs an object in the pool, destroyed with its owning pointer
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return An owning pointer to the created object
+         */
+        template <class... Args>
+        Ptr MakeUnique(Args&&... p_args);
+
+        /**
+         * \brief Gets a handle to the given object
+         * \param p_object The object to reference. Must have been created by this pool
+         * \return A handle to the object
+         */
+        PoolHandle<T> GetHandle(T* p_object) const;
+
+        /**
+         * \brief Gets the pool's current memory usage
+         * \return The pool's stats
+         */
+        PoolStats GetStats() const override;
+
+    private:
+        using Slot = typename PoolChunks<T>::Slot;
+
+        PoolChunks<T> m_chunks;
+        std::string   m_name;
+        uint32_t      m_freeHead     = UINT32_MAX;
+        size_t        m_liveCount    = 0;
+        size_t        m_peakCount    = 0;
+        size_t        m_createdCount = 0;
+
+        /**
+         * \brief Takes a free slot, adding a chunk if needed
+         * \return The free slot
+         */
+        Slot& AcquireSlot();
+    };
+}
+
+#include "SurvivantCore/Memory/ObjectPool.inl"
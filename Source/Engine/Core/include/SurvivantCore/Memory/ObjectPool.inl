@@ -0,0 +1,140 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/Memory/ObjectPool.h"
+
+#include <algorithm>
+#include <new>
+
+namespace SvCore::Memory
+{
+    template <class T>
+    void ObjectPool<T>::Deleter::operator()(T* p_object) const
+    {
+        m_pool->Delete(p_object);
+    }
+
+    template <class T>
+    ObjectPool<T>::ObjectPool(std::string p_name)
+        : m_name(std::move(p_name))
+    {
+    }
+
+    template <class T>
+    ObjectPool<T>::~ObjectPool()
+    {
+        if (m_liveCount == 0)
+            return;
+
+        SV_LOG_WARNING("Pool \"%s\" destroyed with %zu live objects", m_name.c_str(), m_liveCount);
+
+        for (uint32_t i = 0; i < m_chunks.GetCapacity(); ++i)
+        {
+            if (m_chunks[i].m_generation.load(std::memory_order_relaxed) & 1)
+                m_chunks[i].GetObject()->~T();
+        }
+    }
+
+    template <class T>
+    template <class... Args>
+    PoolHandle<T> ObjectPool<T>::Create(Args&&... p_args)
+    {
+        return GetHandle(New(std::forward<Args>(p_args)...));
+    }
+
+    template <class T>
+    void ObjectPool<T>::Destroy(const PoolHandle<T> p_handle)
+    {
+        if (T* object = Get(p_handle))
+            Delete(object);
+    }
+
+    template <class T>
+    T* ObjectPool<T>::Get(const PoolHandle<T> p_handle) const
+    {
+        if (p_handle.m_index >= m_chunks.GetCapacity())
+            return nullptr;
+
+        Slot& slot = m_chunks[p_handle.m_index];
+        return slot.m_generation.load(std::memory_order_relaxed) == p_handle.m_generation ? slot.GetObject() : nullptr;
+    }
+
+    template <class T>
+    template <class... Args>
+    T* ObjectPool<T>::New(Args&&... p_args)
+    {
+        Slot& slot   = AcquireSlot();
+        T*    object = new(slot.m_storage) T(std::forward<Args>(p_args)...);
+
+        slot.m_generation.fetch_add(1, std::memory_order_relaxed);
+
+        m_peakCount = std::max(m_peakCount, ++m_liveCount);
+        ++m_createdCount;
+
+        return object;
+    }
+
+    template <class T>
+    void ObjectPool<T>::Delete(T* p_object)
+    {
+        if (!p_object)
+            return;
+
+        Slot& slot = PoolChunks<T>::FromObject(p_object);
+        ASSERT(slot.m_generation.load(std::memory_order_relaxed) & 1, "Deleted pool object is not alive");
+
+        p_object->~T();
+        slot.m_generation.fetch_add(1, std::memory_order_relaxed);
+
+        slot.m_nextFree = m_freeHead;
+        m_freeHead      = slot.m_index;
+        --m_liveCount;
+    }
+
+    template <class T>
+    template <class... Args>
+    typename ObjectPool<T>::Ptr ObjectPool<T>::MakeUnique(Args&&... p_args)
+    {
+        return Ptr(New(std::forward<Args>(p_args)...), Deleter{ this });
+    }
+
+    template <class T>
+    PoolHandle<T> ObjectPool<T>::GetHandle(T* p_object) const
+    {
+        if (!p_object)
+            return {};
+
+        const Slot& slot = PoolChunks<T>::FromObject(p_object);
+        return { slot.m_index, slot.m_generation.load(std::memory_order_relaxed) };
+    }
+
+    template <class T>
+    PoolStats ObjectPool<T>::GetStats() const
+    {
+        const size_t capacity = m_chunks.GetCapacity();
+        return { m_name, sizeof(T), capacity, m_liveCount, m_peakCount, m_createdCount, capacity * sizeof(Slot) };
+    }
+
+    template <class T>
+    typename ObjectPool<T>::Slot& ObjectPool<T>::AcquireSlot()
+    {
+        if (m_freeHead == UINT32_MAX)
+        {
+            const uint32_t first = m_chunks.Grow();
+
+            if (first == UINT32_MAX)
+                throw std::bad_alloc();
+
+            // Link the new chunk's slots in order
+            for (uint32_t i = PoolChunks<T>::CHUNK_SIZE; i > 0; --i)
+            {
+                m_chunks[first + i - 1].m_nextFree = m_freeHead;
+                m_freeHead                         = first + i - 1;
+            }
+        }
+
+        Slot& slot = m_chunks[m_freeHead];
+        m_freeHead = slot.m_nextFree;
+
+        return slot;
+    }
+}
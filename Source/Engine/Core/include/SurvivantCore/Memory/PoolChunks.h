@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Slot storage shared by the object pools. Slots are allocated in fixed-size chunks that never move, so a
+     * slot can be read without locking while other threads add chunks
+     * \tparam T The pooled objects' type
+     */
+    template <class T>
+    class PoolChunks
+    {
+    public:
+        static constexpr uint32_t CHUNK_SIZE      = 64;
+        static constexpr uint32_t MAX_CHUNK_COUNT = 4096;
+
+        struct Slot
+        {
+            alignas(T) std::byte m_storage[sizeof(T)];
+
+            // Odd while the slot holds an object
+            std::atomic<uint32_t> m_generation = 0;
+            uint32_t              m_index      = 0;
+            uint32_t              m_nextFree   = UINT32_MAX;
+
+            /**
+             * \brief Gets the object stored in the slot
+             * \return A pointer to the slot's object
+             */
+            T* GetObject();
+        };
+
+        /**
+         * \brief Creates an empty slot storage
+         */
+        PoolChunks();
+
+        /**
+         * \brief Disable pool chunks copying
+         */
+        PoolChunks(const PoolChunks& p_other) = delete;
+
+        /**
+         * \brief Disable pool chunks moving
+         */
+        PoolChunks(PoolChunks&& p_other) noexcept = delete;
+
+        /**
+         * \brief Frees every chunk. The objects must have been destroyed
+         */
+        ~PoolChunks();
+
+        /**
+         * \brief Disable pool chunks copying
+         */
+        PoolChunks& operator=(const PoolChunks& p_other) = delete;
+
+        /**
+         * \brief Disable pool chunks moving
+         */
+        PoolChunks& operator=(PoolChunks&& p_other) noexcept = delete;
+
+        /**
+         * \brief Gets the slot at the given index
+         * \param p_index The slot's index. Must be lower than the capacity
+         * \return The slot at the given index
+         */
+        Slot& operator[](uint32_t p_index) const;
+
+        /**
+         * \brief Finds the slot holding the given object
+         * \param p_object The object to find
+         * \return The object's slot
+         */
+        static Slot& FromObject(T* p_object);
+
+        /**
+         * \brief Adds a chunk of slots. Must not run concurrently with itself
+         * \return The index of the chunk's first slot. UINT32_MAX if the storage is full
+         */
+        uint32_t Grow();
+
+        /**
+         * \brief Gets the number of allocated slots
+         * \return The storage's slot count
+         */
+        uint32_t GetCapacity() const;
+
+    private:
+        std::unique_ptr<std::atomic<Slot*>[]> m_chunks;
+        std::atomic<uint32_t>                 m_chunkCount = 0;
+    };
+}
+
+#include "SurvivantCore/Memory/PoolChunks.inl"
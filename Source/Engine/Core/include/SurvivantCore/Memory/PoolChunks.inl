@@ -0,0 +1,68 @@
+#pragma once
+#include "SurvivantCore/Memory/PoolChunks.h"
+
+#include <new>
+
+namespace SvCore::Memory
+{
+    template <class T>
+    T* PoolChunks<T>::Slot::GetObject()
+    {
+        return std::launder(reinterpret_cast<T*>(m_storage));
+    }
+
+    template <class T>
+    PoolChunks<T>::PoolChunks()
+        : m_chunks(std::make_unique<std::atomic<Slot*>[]>(MAX_CHUNK_COUNT))
+    {
+    }
+
+    template <class T>
+    PoolChunks<T>::~PoolChunks()
+    {
+        const uint32_t chunkCount = m_chunkCount.load(std::memory_order_acquire);
+
+        for (uint32_t i = 0; i < chunkCount; ++i)
+            delete[] m_chunks[i].load(std::memory_order_relaxed);
+    }
+
+    template <class T>
+    typename PoolChunks<T>::Slot& PoolChunks<T>::operator[](const uint32_t p_index) const
+    {
+        return m_chunks[p_index / CHUNK_SIZE].load(std::memory_order_acquire)[p_index % CHUNK_SIZE];
+    }
+
+    template <class T>
+    typename PoolChunks<T>::Slot& PoolChunks<T>::FromObject(T* p_object)
+    {
+        // The storage is the slot's first member
+        static_assert(offsetof(Slot, m_storage) == 0);
+        return *reinterpret_cast<Slot*>(p_object);
+    }
+
+    template <class T>
+    uint32_t PoolChunks<T>::Grow()
+    {
+        const uint32_t chunkCount = m_chunkCount.load(std::memory_order_relaxed);
+
+        if (chunkCount == MAX_CHUNK_COUNT)
+            return UINT32_MAX;
+
+        Slot*          chunk = new Slot[CHUNK_SIZE];
+        const uint32_t first = chunkCount * CHUNK_SIZE;
+
+        for (uint32_t i = 0; i < CHUNK_SIZE; ++i)
+            chunk[i].m_index = first + i;
+
+        m_chunks[chunkCount].store(chunk, std::memory_order_release);
+        m_chunkCount.store(chunkCount + 1, std::memory_order_release);
+
+        return first;
+    }
+
+    template <class T>
+    uint32_t PoolChunks<T>::GetCapacity() const
+    {
+        return m_chunkCount.load(std::memory_order_acquire) * CHUNK_SIZE;
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Lightweight reference to an object owned by an object pool.\n
+     * Stays safe to use after the object is destroyed: lookups through a stale handle fail instead of
+     * returning a recycled slot's object
+     * \tparam T The referenced object's type
+     */
+    template <class T>
+    struct PoolHandle
+    {
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        uint32_t m_index      = INVALID_INDEX;
+        uint32_t m_generation = 0;
+
+        /**
+         * \brief Checks whether the handle was returned by an object pool
+         * \return True if the handle points to a slot. False otherwise
+         */
+        bool IsValid() const
+        {
+            return m_index != INVALID_INDEX;
+        }
+
+        bool operator==(const PoolHandle& p_other) const = default;
+    };
+}
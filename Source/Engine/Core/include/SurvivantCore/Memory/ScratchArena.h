@@ -0,0 +1,86 @@
+#pragma once
+#include "SurvivantCore/Memory/LinearAllocator.h"
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace SvCore::Memory
+{
+    /**
+     * \brief Scoped temporary allocations in the calling thread's scratch buffer.\n
+     * Everything allocated through the arena is released when it goes out of scope. Arenas can be nested but must be
+     * destroyed in reverse order of creation, and must not be shared with other threads
+     */
+    class ScratchArena
+    {
+    public:
+        static constexpr size_t THREAD_CAPACITY = 1024 * 1024;
+
+        /**
+         * \brief Opens a scratch arena at the calling thread's current scratch position
+         */
+        ScratchArena();
+
+        /**
+         * \brief Disable scratch arena copying
+         */
+        ScratchArena(const ScratchArena& p_other) = delete;
+
+        /**
+         * \brief Disable scratch arena moving
+         */
+        ScratchArena(ScratchArena&& p_other) noexcept = delete;
+
+        /**
+         * \brief Releases everything allocated since the arena's creation
+         */
+        ~ScratchArena();
+
+        /**
+         * \brief Disable scratch arena copying
+         */
+        ScratchArena& operator=(const ScratchArena& p_other) = delete;
+
+        /**
+         * \brief Disable scratch arena moving
+         */
+        ScratchArena& operator=(ScratchArena&& p_other) noexcept = delete;
+
+        /**
+         * \brief Allocates a block of the given size and alignment in the arena
+         * \param p_size The block's size in bytes
+         * \param p_alignment The block's alignment. Must be a power of two
+         * \return A pointer to the allocated block
+         */
+        void* Allocate(size_t p_size, size_t p_alignment = alignof(std::max_align_t));
+
+        /**
+         * \brief Constructs an object in the arena. Its destructor is never called
+         * \tparam T The object's type
+         * \tparam Args The object's constructor parameters' types
+         * \param p_args The object's constructor parameters
+         * \return A pointer to the constructed object
+         */
+        template <class T, class... Args>
+        T* New(Args&&... p_args);
+
+        /**
+         * \brief Gets a memory resource allocating in the arena, for pmr containers.
+         * The containers must be destroyed before the arena
+         * \return The arena's memory resource
+         */
+        std::pmr::memory_resource* GetResource() const;
+
+    private:
+        LinearAllocator&        m_allocator;
+        LinearAllocator::Marker m_marker;
+
+        /**
+         * \brief Gets the calling thread's scratch buffer, creating it on first use
+         * \return The calling thread's scratch allocator
+         */
+        static LinearAllocator& GetThreadAllocator();
+    };
+}
+
+#include "SurvivantCore/Memory/ScratchArena.inl"
@@ -0,0 +1,11 @@
+#pragma once
+#include "SurvivantCore/Memory/ScratchArena.h"
+
+namespace SvCore::Memory
+{
+    template <class T, class... Args>
+    T* ScratchArena::New(Args&&... p_args)
+    {
+        return m_allocator.New<T>(std::forward<Args>(p_args)...);
+    }
+}
@@ -1,9 +1,14 @@
 #pragma once
+#include "SurvivantCore/Resources/LoadTicket.h"
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace SvCore::Resources
 {
+    class ResourceLoader;
+
     class IResource
     {
     public:
@@ -19,10 +24,30 @@ namespace SvCore::Resources
          */
         virtual bool Load(const std::string& p_fileName) = 0;
 
+        /**
+         * \brief Requests the resources which must be ready before this one is initialized, e.g. a material's textures.
+         * Called by the resource loader on the thread using the resource manager, once Load succeeded
+         * \param p_loader The loader to request the dependencies from
+         * \return The dependencies' tickets
+         */
+        virtual std::vector<LoadTicket> LoadDependencies(ResourceLoader& /*p_loader*/)
+        {
+            return {};
+        }
+
         /**
          * \brief Initializes the resource
          * \return True on success. False otherwise.
          */
         virtual bool Init() = 0;
+
+        /**
+         * \brief Gets the approximate amount of CPU memory held by the resource
+         * \return The resource's memory footprint in bytes
+         */
+        virtual size_t GetMemorySize() const
+        {
+            return 0;
+        }
     };
 }
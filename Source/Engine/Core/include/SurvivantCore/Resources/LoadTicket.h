@@ -0,0 +1,9 @@
+#pragma once
+#include <cstdint>
+
+namespace SvCore::Resources
+{
+    using LoadTicket = uint32_t;
+
+    constexpr LoadTicket INVALID_LOAD_TICKET = 0;
+}
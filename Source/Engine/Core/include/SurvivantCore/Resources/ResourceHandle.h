@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+namespace SvCore::Resources
+{
+    /**
+     * \brief Lightweight reference to a resource owned by the resource manager.\n
+     * Stays safe to use after the resource is freed: lookups through a stale handle fail instead of
+     * returning a recycled slot's resource
+     * \tparam T The referenced resource's type
+     */
+    template <class T>
+    struct ResourceHandle
+    {
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        uint32_t m_index      = INVALID_INDEX;
+        uint32_t m_generation = 0;
+
+        /**
+         * \brief Checks whether the handle was returned by the resource manager
+         * \return True if the handle points to a slot. False otherwise
+         */
+        bool IsValid() const
+        {
+            return m_index != INVALID_INDEX;
+        }
+
+        bool operator==(const ResourceHandle& p_other) const = default;
+    };
+
+    /**
+     * \brief Tells whether a type is a resource handle, and which resource type it references
+     * \tparam T The type to check
+     */
+    template <class T>
+    struct ResourceHandleTraits : std::false_type
+    {
+    };
+
+    template <class T>
+    struct ResourceHandleTraits<ResourceHandle<T>> : std::true_type
+    {
+        using ResourceType = T;
+    };
+}
@@ -0,0 +1,204 @@
+#pragma once
+#include "SurvivantCore/Enums/ELoadState.h"
+#include "SurvivantCore/Resources/IResource.h"
+#include "SurvivantCore/Resources/LoadTicket.h"
+#include "SurvivantCore/Resources/ResourceHandle.h"
+#include "SurvivantCore/Resources/ResourceManager.h"
+#include "SurvivantCore/Threading/JobSystem.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace SvCore::Resources
+{
+    /**
+     * \brief Loads resources in two phases: `Load` runs as a job on the job system's workers, then `Init`, which may need the
+     * graphics context, runs on the thread calling Update under a per-frame time budget.\n
+     * A request's Init only runs once all of its dependencies are ready, both the ones given to LoadAsync and the ones
+     * the resource requests once loaded. Initialized resources are handed over to the resource manager
+     */
+    class ResourceLoader
+    {
+    public:
+        /**
+         * \brief Creates a resource loader feeding the given resource manager
+         * \param p_manager The resource manager that takes ownership of the loaded resources
+         * \param p_jobSystem The job system running the Load calls
+         */
+        explicit ResourceLoader(ResourceManager&      p_manager   = ResourceManager::GetInstance(),
+                                Threading::JobSystem& p_jobSystem = Threading::JobSystem::GetInstance());
+
+        /**
+         * \brief Disable resource loader copying
+         */
+        ResourceLoader(const ResourceLoader& p_other) = delete;
+
+        /**
+         * \brief Disable resource loader moving
+         */
+        ResourceLoader(ResourceLoader&& p_other) noexcept = delete;
+
+        /**
+         * \brief Waits for the running Load calls to finish. Requests that weren't initialized are dropped
+         */
+        ~ResourceLoader();
+
+        /**
+         * \brief Disable resource loader copying
+         */
+        ResourceLoader& operator=(const ResourceLoader& p_other) = delete;
+
+        /**
+         * \brief Disable resource loader moving
+         */
+        ResourceLoader& operator=(ResourceLoader&& p_other) noexcept = delete;
+
+        /**
+         * \brief Requests the resource at the given path to be loaded in the background.\n
+         * Resources already cached by the resource manager, or already requested, aren't loaded again.
+         * Every request holds one reference on the resource once it is ready.
+         * Joining a pending request adds the given dependencies to it. The request fails instead if that would make
+         * it depend on itself.
+         * Must be called from the thread using the resource manager
+         * \tparam T The resource's type
+         * \param p_path The resource file's path
+         * \param p_dependencies The requests which must be ready before this resource is initialized
+         * \return The request's ticket
+         */
+        template <class T>
+        LoadTicket LoadAsync(const std::string& p_path, const std::vector<LoadTicket>& p_dependencies = {});
+
+        /**
+         * \brief Initializes loaded resources whose dependencies are ready until the given time budget is spent.\n
+         * Must be called from the thread owning the graphics context. At least one resource is initialized per call
+         * when any is ready so loading always makes progress
+         * \param p_timeBudget The maximum time to spend initializing resources, in seconds
+         * \return The number of requests completed during the call
+         */
+        size_t Update(float p_timeBudget);
+
+        /**
+         * \brief Blocks until every pending request is either ready or failed
+         */
+        void Flush();
+
+        /**
+         * \brief Gets the state of the given request
+         * \param p_ticket The request's ticket
+         * \return The request's state
+         */
+        Enums::ELoadState GetState(LoadTicket p_ticket) const;
+
+        /**
+         * \brief Gets a handle to the resource loaded by the given request
+         * \tparam T The resource's type
+         * \param p_ticket The request's ticket
+         * \return A handle to the resource. An invalid handle if the request isn't ready or the type doesn't match
+         */
+        template <class T>
+        ResourceHandle<T> GetHandle(LoadTicket p_ticket) const;
+
+        /**
+         * \brief Gets the number of requests which are neither ready nor failed
+         * \return The number of pending requests
+         */
+        size_t GetPendingCount() const;
+
+        /**
+         * \brief Forgets the completed requests. Their tickets become invalid, but pending requests can still depend on
+         * them
+         */
+        void ClearCompleted();
+
+    private:
+        struct Request
+        {
+            std::unique_ptr<IResource> m_resource;
+            std::string                m_path;
+            std::string                m_normalizedPath;
+            const std::type_info*      m_type                  = nullptr;
+            std::vector<LoadTicket>    m_dependencies;
+            Enums::ELoadState          m_state                 = Enums::ELoadState::QUEUED;
+            uint32_t                   m_requestCount          = 1;
+            uint32_t                   m_index                 = ResourceHandle<IResource>::INVALID_INDEX;
+            uint32_t                   m_generation            = 0;
+            bool                       m_hasLoadedDependencies = false;
+        };
+
+        ResourceManager&                            m_manager;
+        Threading::JobSystem&                       m_jobSystem;
+        Threading::JobCounter                       m_loadJobs;
+        std::unordered_map<LoadTicket, Request>     m_requests;
+        std::unordered_map<std::string, LoadTicket> m_pendingPaths;
+        std::vector<LoadTicket>                     m_initQueue;
+        std::unordered_set<LoadTicket>              m_clearedFailures;
+        mutable std::mutex                          m_mutex;
+        std::condition_variable                     m_loadedCondition;
+        LoadTicket                                  m_nextTicket   = INVALID_LOAD_TICKET + 1;
+        size_t                                      m_pendingCount = 0;
+        uint64_t                                    m_loadedCount  = 0;
+
+        /**
+         * \brief Queues a request for the given resource or joins the pending request for the same path
+         * \param p_path The resource file's path
+         * \param p_type The resource's type
+         * \param p_resource The resource to load. Unused if the resource is cached or already requested
+         * \param p_dependencies The requests which must be ready before this resource is initialized
+         * \return The request's ticket
+         */
+        LoadTicket Enqueue(const std::string& p_path, const std::type_info& p_type, std::unique_ptr<IResource> p_resource,
+                           const std::vector<LoadTicket>& p_dependencies);
+
+        /**
+         * \brief Adds the given dependencies to the given request, unless one of them waits on the request
+         * \param p_ticket The request's ticket
+         * \param p_dependencies The dependencies to add
+         * \return True if the dependencies were added. False if the request would depend on itself
+         */
+        bool AddDependencies(LoadTicket p_ticket, const std::vector<LoadTicket>& p_dependencies);
+
+        /**
+         * \brief Checks whether the given request waits on the given ticket, directly or through its dependencies
+         * \param p_ticket The waiting request's ticket
+         * \param p_dependency The ticket to look for
+         * \return True if the request can't be initialized before the given ticket's request. False otherwise
+         */
+        bool DependsOn(LoadTicket p_ticket, LoadTicket p_dependency) const;
+
+        /**
+         * \brief Runs the given request's Load call. Called from a job
+         * \param p_ticket The request's ticket
+         */
+        void LoadRequest(LoadTicket p_ticket);
+
+        /**
+         * \brief Checks whether the given request can be initialized
+         * \param p_request The request to check
+         * \param p_hasFailedDependency Set to true if one of the request's dependencies failed
+         * \return True if every dependency is either ready or failed. False otherwise
+         */
+        bool AreDependenciesDone(const Request& p_request, bool& p_hasFailedDependency) const;
+
+        /**
+         * \brief Hands the given initialized request's resource over to the resource manager
+         * \param p_request The initialized request
+         */
+        void Register(Request& p_request);
+
+        /**
+         * \brief Marks the given request as completed and updates the pending counters
+         * \param p_request The completed request
+         * \param p_state The request's final state
+         */
+        void Complete(Request& p_request, Enums::ELoadState p_state);
+    };
+}
+
+#include "SurvivantCore/Resources/ResourceLoader.inl"
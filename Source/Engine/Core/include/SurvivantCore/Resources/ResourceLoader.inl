@@ -0,0 +1,27 @@
+#pragma once
+#include "SurvivantCore/Resources/ResourceLoader.h"
+
+#include <type_traits>
+
+namespace SvCore::Resources
+{
+    template <class T>
+    LoadTicket ResourceLoader::LoadAsync(const std::string& p_path, const std::vector<LoadTicket>& p_dependencies)
+    {
+        static_assert(std::is_base_of_v<IResource, T>, "Managed resources must inherit from IResource");
+        return Enqueue(p_path, typeid(T), std::make_unique<T>(), p_dependencies);
+    }
+
+    template <class T>
+    ResourceHandle<T> ResourceLoader::GetHandle(const LoadTicket p_ticket) const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        const auto it = m_requests.find(p_ticket);
+
+        if (it == m_requests.end() || it->second.m_state != Enums::ELoadState::READY || *it->second.m_type != typeid(T))
+            return {};
+
+        return { it->second.m_index, it->second.m_generation };
+    }
+}
@@ -0,0 +1,225 @@
+#pragma once
+#include "SurvivantCore/Resources/IResource.h"
+#include "SurvivantCore/Resources/ResourceHandle.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace SvCore::Resources
+{
+    /**
+     * \brief Owns loaded resources and hands out generational handles to them.\n
+     * Resources are deduplicated by normalized path and reference counted. Unreferenced resources stay cached
+     * until the memory budget is exceeded, at which point the least recently released ones are freed
+     */
+    class ResourceManager
+    {
+    public:
+        /**
+         * \brief Creates an empty resource manager without a memory budget
+         */
+        ResourceManager() = default;
+
+        /**
+         * \brief Disable resource manager copying
+         */
+        ResourceManager(const ResourceManager& p_other) = delete;
+
+        /**
+         * \brief Disable resource manager moving
+         */
+        ResourceManager(ResourceManager&& p_other) noexcept = delete;
+
+        /**
+         * \brief Frees all the managed resources
+         */
+        ~ResourceManager() = default;
+
+        /**
+         * \brief Disable resource manager copying
+         */
+        ResourceManager& operator=(const ResourceManager& p_other) = delete;
+
+        /**
+         * \brief Disable resource manager moving
+         */
+        ResourceManager& operator=(ResourceManager&& p_other) noexcept = delete;
+
+        /**
+         * \brief Gets a handle to the resource at the given path, loading and initializing it if it isn't cached.\n
+         * Increments the resource's reference count
+         * \tparam T The resource's type
+         * \param p_path The resource file's path
+         * \return A handle to the resource. An invalid handle on failure
+         */
+        template <class T>
+        ResourceHandle<T> Load(const std::string& p_path);
+
+        /**
+         * \brief Gets a handle to the cached resource at the given path without loading it or changing its reference count
+         * \tparam T The resource's type
+         * \param p_path The resource file's path
+         * \return A handle to the resource. An invalid handle if it isn't cached
+         */
+        template <class T>
+        ResourceHandle<T> Find(const std::string& p_path) const;
+
+        /**
+         * \brief Increments the reference count of the resource pointed to by the given handle
+         * \tparam T The resource's type
+         * \param p_handle The resource's handle
+         * \return True if the handle points to a live resource. False otherwise
+         */
+        template <class T>
+        bool Acquire(ResourceHandle<T> p_handle);
+
+        /**
+         * \brief Decrements the reference count of the resource pointed to by the given handle.\n
+         * Unreferenced resources stay cached until they are evicted
+         * \tparam T The resource's type
+         * \param p_handle The resource's handle
+         */
+        template <class T>
+        void Release(ResourceHandle<T> p_handle);
+
+        /**
+         * \brief Gets the resource pointed to by the given handle
+         * \tparam T The resource's type
+         * \param p_handle The resource's handle
+         * \return A pointer to the resource. nullptr if the handle is stale or invalid
+         */
+        template <class T>
+        T* Get(ResourceHandle<T> p_handle) const;
+
+        /**
+         * \brief Gets the normalized path of the resource pointed to by the given handle
+         * \tparam T The resource's type
+         * \param p_handle The resource's handle
+         * \return The resource's path. An empty string if the handle is stale or invalid
+         */
+        template <class T>
+        std::string GetPath(ResourceHandle<T> p_handle) const;
+
+        /**
+         * \brief Sets the maximum amount of memory the cached resources can use before unreferenced ones are evicted
+         * \param p_budget The memory budget in bytes
+         */
+        void SetMemoryBudget(size_t p_budget);
+
+        /**
+         * \brief Gets the maximum amount of memory the cached resources can use before unreferenced ones are evicted
+         * \return The memory budget in bytes
+         */
+        size_t GetMemoryBudget() const;
+
+        /**
+         * \brief Gets the memory used by the cached resources, as reported when they were loaded
+         * \return The memory usage in bytes
+         */
+        size_t GetMemoryUsage() const;
+
+        /**
+         * \brief Gets the number of cached resources
+         * \return The number of cached resources
+         */
+        size_t GetResourceCount() const;
+
+        /**
+         * \brief Frees every unreferenced resource regardless of the memory budget
+         * \return The number of freed resources
+         */
+        size_t UnloadUnused();
+
+        /**
+         * \brief Frees all the managed resources. Every handle becomes stale
+         */
+        void Clear();
+
+        /**
+         * \brief Accessor to the ResourceManager singleton
+         * \return A reference to the current ResourceManager instance
+         */
+        static ResourceManager& GetInstance();
+
+    private:
+        friend class ResourceLoader;
+
+        struct Slot
+        {
+            std::unique_ptr<IResource> m_resource;
+            std::string                m_path;
+            const std::type_info*      m_type        = nullptr;
+            size_t                     m_memorySize  = 0;
+            uint64_t                   m_lastRelease = 0;
+            uint32_t                   m_generation  = 0;
+            uint32_t                   m_refCount    = 0;
+        };
+
+        std::vector<Slot>                         m_slots;
+        std::vector<uint32_t>                     m_freeSlots;
+        std::unordered_map<std::string, uint32_t> m_lookup;
+        size_t                                    m_memoryBudget = SIZE_MAX;
+        size_t                                    m_memoryUsage  = 0;
+        uint64_t                                  m_releaseCount = 0;
+
+        /**
+         * \brief Finds the slot holding the resource at the given normalized path
+         * \param p_path The resource's normalized path
+         * \param p_type The expected resource type
+         * \return The slot's index. ResourceHandle<T>::INVALID_INDEX if it isn't cached or has a different type
+         */
+        uint32_t FindSlot(const std::string& p_path, const std::type_info& p_type) const;
+
+        /**
+         * \brief Gets the live slot matching the given handle values
+         * \param p_index The handle's slot index
+         * \param p_generation The handle's generation
+         * \param p_type The expected resource type
+         * \return A pointer to the slot. nullptr if the handle is stale or the type doesn't match
+         */
+        const Slot* GetSlot(uint32_t p_index, uint32_t p_generation, const std::type_info& p_type) const;
+
+        /**
+         * \brief Takes ownership of the given resource and stores it with a reference count of 1
+         * \param p_path The resource's normalized path
+         * \param p_type The resource's type
+         * \param p_resource The loaded and initialized resource
+         * \return The resource's slot index
+         */
+        uint32_t Register(const std::string& p_path, const std::type_info& p_type, std::unique_ptr<IResource> p_resource);
+
+        /**
+         * \brief Increments the reference count of the given live slot
+         * \param p_index The handle's slot index
+         * \param p_generation The handle's generation
+         * \param p_type The expected resource type
+         * \return True if the handle points to a live resource. False otherwise
+         */
+        bool AddRef(uint32_t p_index, uint32_t p_generation, const std::type_info& p_type);
+
+        /**
+         * \brief Decrements the reference count of the given live slot
+         * \param p_index The handle's slot index
+         * \param p_generation The handle's generation
+         * \param p_type The expected resource type
+         */
+        void RemoveRef(uint32_t p_index, uint32_t p_generation, const std::type_info& p_type);
+
+        /**
+         * \brief Frees the least recently released unreferenced resources until the usage fits in the budget
+         */
+        void Trim();
+
+        /**
+         * \brief Frees the resource in the given slot and makes its handles stale
+         * \param p_index The slot's index
+         */
+        void FreeSlot(uint32_t p_index);
+    };
+}
+
+#include "SurvivantCore/Resources/ResourceManager.inl"
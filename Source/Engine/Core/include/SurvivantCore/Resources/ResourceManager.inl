@@ -0,0 +1,78 @@
+#pragma once
+#include "SurvivantCore/Debug/Logger.h"
+#include "SurvivantCore/Resources/ResourceManager.h"
+#include "SurvivantCore/Utility/FileSystem.h"
+
+#include <type_traits>
+
+namespace SvCore::Resources
+{
+    template <class T>
+    ResourceHandle<T> ResourceManager::Load(const std::string& p_path)
+    {
+        static_assert(std::is_base_of_v<IResource, T>, "Managed resources must inherit from IResource");
+
+        const std::string path  = Utility::NormalizePath(p_path);
+        const uint32_t    index = FindSlot(path, typeid(T));
+
+        if (index != ResourceHandle<T>::INVALID_INDEX)
+        {
+            AddRef(index, m_slots[index].m_generation, typeid(T));
+            return { index, m_slots[index].m_generation };
+        }
+
+        if (m_lookup.contains(path))
+        {
+            SV_LOG_ERROR("Unable to load resource \"%s\" - already loaded with a different type", p_path.c_str());
+            return {};
+        }
+
+        std::unique_ptr<T> resource = std::make_unique<T>();
+
+        if (!resource->Load(p_path) || !resource->Init())
+        {
+            SV_LOG_ERROR("Unable to load resource \"%s\"", p_path.c_str());
+            return {};
+        }
+
+        const uint32_t newIndex = Register(path, typeid(T), std::move(resource));
+        return { newIndex, m_slots[newIndex].m_generation };
+    }
+
+    template <class T>
+    ResourceHandle<T> ResourceManager::Find(const std::string& p_path) const
+    {
+        const uint32_t index = FindSlot(Utility::NormalizePath(p_path), typeid(T));
+
+        if (index == ResourceHandle<T>::INVALID_INDEX)
+            return {};
+
+        return { index, m_slots[index].m_generation };
+    }
+
+    template <class T>
+    bool ResourceManager::Acquire(const ResourceHandle<T> p_handle)
+    {
+        return AddRef(p_handle.m_index, p_handle.m_generation, typeid(T));
+    }
+
+    template <class T>
+    void ResourceManager::Release(const ResourceHandle<T> p_handle)
+    {
+        RemoveRef(p_handle.m_index, p_handle.m_generation, typeid(T));
+    }
+
+    template <class T>
+    T* ResourceManager::Get(const ResourceHandle<T> p_handle) const
+    {
+        const Slot* slot = GetSlot(p_handle.m_index, p_handle.m_generation, typeid(T));
+        return slot ? static_cast<T*>(slot->m_resource.get()) : nullptr;
+    }
+
+    template <class T>
+    std::string ResourceManager::GetPath(const ResourceHandle<T> p_handle) const
+    {
+        const Slot* slot = GetSlot(p_handle.m_index, p_handle.m_generation, typeid(T));
+        return slot ? slot->m_path : std::string();
+    }
+}
@@ -0,0 +1,163 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <utility>
+
+namespace SvCore::Threading
+{
+    class JobCounter;
+    class JobSystem;
+
+    /**
+     * \brief Awaited from a coroutine job to continue its execution on the job system's main thread
+     */
+    struct ResumeOnMainThread
+    {
+    };
+
+    /**
+     * \brief Coroutine job run by the job system.\n
+     * Awaiting a JobCounter suspends the coroutine instead of blocking its worker, which picks up other jobs until the
+     * counter reaches zero. Frames are allocated from a fixed-size pool and reused between coroutines
+     */
+    class Coroutine
+    {
+    public:
+        class promise_type;
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        struct CounterAwaiter
+        {
+            JobCounter& m_counter;
+
+            bool await_ready() const noexcept;
+            void await_suspend(Handle p_handle) const;
+            void await_resume() const noexcept;
+        };
+
+        struct MainThreadAwaiter
+        {
+            bool await_ready() const noexcept;
+            void await_suspend(Handle p_handle) const;
+            void await_resume() const noexcept;
+        };
+
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept;
+            void await_suspend(Handle p_handle) const noexcept;
+            void await_resume() const noexcept;
+        };
+
+        class promise_type
+        {
+        public:
+            Coroutine get_return_object() noexcept;
+
+            /**
+             * \brief Keeps the coroutine suspended until the job system schedules it
+             */
+            std::suspend_always initial_suspend() const noexcept;
+
+            /**
+             * \brief Signals the coroutine's counter and frees its frame
+             */
+            FinalAwaiter final_suspend() const noexcept;
+
+            void return_void() const noexcept;
+            void unhandled_exception() const noexcept;
+
+            /**
+             * \brief Suspends the coroutine until the given counter reaches zero
+             * \param p_counter The counter to wait for
+             * \return The counter's awaiter
+             */
+            CounterAwaiter await_transform(JobCounter& p_counter) const noexcept;
+
+            /**
+             * \brief Moves the rest of the coroutine onto the main thread
+             * \return The main thread awaiter
+             */
+            MainThreadAwaiter await_transform(ResumeOnMainThread) const noexcept;
+
+            template <class Awaitable>
+            Awaitable&& await_transform(Awaitable&& p_awaitable) const noexcept
+            {
+                return std::forward<Awaitable>(p_awaitable);
+            }
+
+            /**
+             * \brief Allocates a coroutine frame from the frame pool, falling back to the heap for large frames
+             * \param p_size The frame's size in bytes
+             * \return The allocated frame
+             */
+            static void* operator new(size_t p_size);
+
+            /**
+             * \brief Releases the given coroutine frame
+             * \param p_frame The frame to release
+             * \param p_size The frame's size in bytes
+             */
+            static void operator delete(void* p_frame, size_t p_size) noexcept;
+
+        private:
+            friend class Coroutine;
+            friend class JobSystem;
+
+            JobSystem*  m_jobSystem = nullptr;
+            JobCounter* m_counter   = nullptr;
+        };
+
+        /**
+         * \brief Disable coroutine copying
+         */
+        Coroutine(const Coroutine& p_other) = delete;
+
+        /**
+         * \brief Creates a move copy of the given coroutine
+         * \param p_other The moved coroutine
+         */
+        Coroutine(Coroutine&& p_other) noexcept;
+
+        /**
+         * \brief Destroys the coroutine if it was never scheduled
+         */
+        ~Coroutine();
+
+        /**
+         * \brief Disable coroutine copying
+         */
+        Coroutine& operator=(const Coroutine& p_other) = delete;
+
+        /**
+         * \brief Moves the given coroutine into this one
+         * \param p_other The moved coroutine
+         * \return A reference to the modified coroutine
+         */
+        Coroutine& operator=(Coroutine&& p_other) noexcept;
+
+    private:
+        friend class JobSystem;
+
+        Handle m_handle;
+
+        /**
+         * \brief Creates a coroutine owning the given handle
+         * \param p_handle The coroutine's handle
+         */
+        explicit Coroutine(Handle p_handle);
+
+        /**
+         * \brief Gives up ownership of the coroutine's handle
+         * \return The coroutine's handle
+         */
+        Handle Release();
+
+        /**
+         * \brief Frees the finished coroutine's frame and signals its counter
+         * \param p_handle The finished coroutine's handle
+         */
+        static void Complete(Handle p_handle);
+    };
+}
@@ -0,0 +1,249 @@
+#pragma once
+#include "SurvivantCore/Threading/Coroutine.h"
+#include "SurvivantCore/Threading/WorkStealingQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SvCore::Threading
+{
+    class JobSystem;
+
+    /**
+     * \brief Tracks the number of unfinished jobs in a group.\n
+     * Jobs can be made to depend on a counter, in which case they are only queued once it reaches zero
+     */
+    class JobCounter
+    {
+    public:
+        /**
+         * \brief Creates a counter with no pending job
+         */
+        JobCounter() = default;
+
+        /**
+         * \brief Disable job counter copying
+         */
+        JobCounter(const JobCounter& p_other) = delete;
+
+        /**
+         * \brief Disable job counter moving
+         */
+        JobCounter(JobCounter&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the counter. Its jobs must be done
+         */
+        ~JobCounter() = default;
+
+        /**
+         * \brief Disable job counter copying
+         */
+        JobCounter& operator=(const JobCounter& p_other) = delete;
+
+        /**
+         * \brief Disable job counter moving
+         */
+        JobCounter& operator=(JobCounter&& p_other) noexcept = delete;
+
+        /**
+         * \brief Checks whether every job tracked by the counter is done
+         * \return True if no tracked job is pending. False otherwise
+         */
+        bool IsDone() const;
+
+        /**
+         * \brief Gets the number of unfinished tracked jobs
+         * \return The number of pending jobs
+         */
+        uint32_t GetPendingCount() const;
+
+    private:
+        friend class JobSystem;
+
+        struct Job;
+
+        std::atomic<uint32_t> m_pending = 0;
+        mutable std::mutex    m_mutex;
+        std::vector<Job*>     m_waitingJobs;
+    };
+
+    /**
+     * \brief Work stealing job system.\n
+     * Every worker, and the thread that created the system (the main thread), owns a Chase-Lev deque. Idle threads steal
+     * from the others. Jobs scheduled from other threads go through a shared queue. Jobs that must run on the main
+     * thread, like GL calls, are kept in a separate queue which only the main thread drains
+     */
+    class JobSystem
+    {
+    public:
+        using Task = std::function<void()>;
+
+        /**
+         * \brief Creates a job system and starts its workers. The calling thread becomes the main thread
+         * \param p_workerCount The number of worker threads. 0 to use one less than the number of hardware threads
+         */
+        explicit JobSystem(uint32_t p_workerCount = 0);
+
+        /**
+         * \brief Disable job system copying
+         */
+        JobSystem(const JobSystem& p_other) = delete;
+
+        /**
+         * \brief Disable job system moving
+         */
+        JobSystem(JobSystem&& p_other) noexcept = delete;
+
+        /**
+         * \brief Waits for the queued jobs to finish and stops the workers
+         */
+        ~JobSystem();
+
+        /**
+         * \brief Disable job system copying
+         */
+        JobSystem& operator=(const JobSystem& p_other) = delete;
+
+        /**
+         * \brief Disable job system moving
+         */
+        JobSystem& operator=(JobSystem&& p_other) noexcept = delete;
+
+        /**
+         * \brief Queues the given task on any thread
+         * \param p_task The task to run
+         * \param p_counter The counter tracking the job. Can be null
+         * \param p_dependency A counter which must reach zero before the job is queued. Can be null
+         */
+        void Schedule(Task p_task, JobCounter* p_counter = nullptr, JobCounter* p_dependency = nullptr);
+
+        /**
+         * \brief Queues the given coroutine on any thread. The counter is only signaled once the coroutine returns,
+         * however many times it gets suspended
+         * \param p_coroutine The coroutine to run
+         * \param p_counter The counter tracking the coroutine. Can be null
+         * \param p_dependency A counter which must reach zero before the coroutine is queued. Can be null
+         */
+        void Schedule(Coroutine p_coroutine, JobCounter* p_counter = nullptr, JobCounter* p_dependency = nullptr);
+
+        /**
+         * \brief Queues the given task on the main thread. It runs during ExecuteMainThreadJobs or while the main thread waits
+         * \param p_task The task to run
+         * \param p_counter The counter tracking the job. Can be null
+         * \param p_dependency A counter which must reach zero before the job is queued. Can be null
+         */
+        void ScheduleOnMainThread(Task p_task, JobCounter* p_counter = nullptr, JobCounter* p_dependency = nullptr);
+
+        /**
+         * \brief Calls the given function for every index in [p_begin, p_end), splitting the range in chunks spread across
+         * the workers, and waits for all of them. The calling thread takes part in the work
+         * \tparam Func The function's type. Must be callable as `void(size_t)`
+         * \param p_begin The range's first index
+         * \param p_end The range's end (excluded)
+         * \param p_func The function to call for each index
+         * \param p_grainSize The minimum number of indices per job. 0 to pick one from the worker count
+         */
+        template <class Func>
+        void ParallelFor(size_t p_begin, size_t p_end, Func&& p_func, size_t p_grainSize = 0);
+
+        /**
+         * \brief Runs other jobs on the calling thread until the given counter reaches zero.\n
+         * Coroutines should `co_await` the counter instead, which frees their thread while they wait
+         * \param p_counter The counter to wait for
+         */
+        void Wait(const JobCounter& p_counter);
+
+        /**
+         * \brief Runs the jobs queued on the main thread. Main thread only
+         * \return The number of executed jobs
+         */
+        size_t ExecuteMainThreadJobs();
+
+        /**
+         * \brief Checks whether the calling thread is the job system's main thread
+         * \return True if called from the main thread. False otherwise
+         */
+        bool IsMainThread() const;
+
+        /**
+         * \brief Gets the number of worker threads, excluding the main thread
+         * \return The number of worker threads
+         */
+        uint32_t GetWorkerCount() const;
+
+        /**
+         * \brief Accessor to the JobSystem singleton. Created on first use by the calling thread, which becomes its main thread
+         * \return A reference to the current JobSystem instance
+         */
+        static JobSystem& GetInstance();
+
+    private:
+        friend class Coroutine;
+
+        using Job = JobCounter::Job;
+
+        static constexpr size_t QUEUE_CAPACITY = 4096;
+
+        std::vector<std::unique_ptr<WorkStealingQueue<Job>>> m_queues;
+        std::vector<std::thread>                             m_workers;
+        std::deque<Job*>                                     m_sharedJobs;
+        std::deque<Job*>                                     m_mainThreadJobs;
+        std::mutex                                           m_sharedMutex;
+        std::mutex                                           m_mainThreadMutex;
+        std::mutex                                           m_sleepMutex;
+        std::condition_variable                              m_sleepCondition;
+        std::atomic<uint32_t>                                m_queuedCount   = 0;
+        std::atomic<uint32_t>                                m_sleepingCount = 0;
+        std::atomic<bool>                                    m_isRunning     = true;
+        std::thread::id                                      m_mainThreadId;
+
+        /**
+         * \brief Creates a job for the given task and queues it, or parks it on its dependency
+         * \param p_task The task to run
+         * \param p_counter The counter tracking the job. Can be null
+         * \param p_dependency A counter which must reach zero before the job is queued. Can be null
+         * \param p_isMainThreadOnly Whether the job must run on the main thread
+         */
+        void Submit(Task p_task, JobCounter* p_counter, JobCounter* p_dependency, bool p_isMainThreadOnly);
+
+        /**
+         * \brief Queues the given job on the calling thread's deque, the shared queue or the main thread queue
+         * \param p_job The job to queue
+         */
+        void Enqueue(Job* p_job);
+
+        /**
+         * \brief Finds a job to run on the calling thread: its own deque first, then the shared queue, then other deques
+         * \return The found job. nullptr if there is nothing to run
+         */
+        Job* FindJob();
+
+        /**
+         * \brief Runs the given job, updates its counter and releases the jobs waiting on it
+         * \param p_job The job to run
+         */
+        void Execute(Job* p_job);
+
+        /**
+         * \brief Decrements the given counter and queues the jobs waiting on it once it reaches zero
+         * \param p_counter The counter to decrement
+         */
+        void Signal(JobCounter& p_counter);
+
+        /**
+         * \brief Runs jobs until the job system is destroyed
+         * \param p_index The worker's queue index
+         */
+        void WorkerLoop(uint32_t p_index);
+    };
+}
+
+#include "SurvivantCore/Threading/JobSystem.inl"
@@ -0,0 +1,43 @@
+#pragma once
+#include "SurvivantCore/Threading/JobSystem.h"
+
+#include <algorithm>
+
+namespace SvCore::Threading
+{
+    template <class Func>
+    void JobSystem::ParallelFor(const size_t p_begin, const size_t p_end, Func&& p_func, size_t p_grainSize)
+    {
+        if (p_end <= p_begin)
+            return;
+
+        const size_t count = p_end - p_begin;
+
+        // A few chunks per thread lets stealing even out uneven work
+        if (p_grainSize == 0)
+            p_grainSize = std::max<size_t>(1, count / ((static_cast<size_t>(GetWorkerCount()) + 1) * 4));
+
+        if (count <= p_grainSize)
+        {
+            for (size_t i = p_begin; i < p_end; ++i)
+                p_func(i);
+
+            return;
+        }
+
+        JobCounter counter;
+
+        for (size_t first = p_begin; first < p_end; first += p_grainSize)
+        {
+            const size_t last = std::min(first + p_grainSize, p_end);
+
+            Schedule([&p_func, first, last]
+            {
+                for (size_t i = first; i < last; ++i)
+                    p_func(i);
+            }, &counter);
+        }
+
+        Wait(counter);
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace SvCore::Threading
+{
+    /**
+     * \brief Fixed capacity lock-free multi-producer single-consumer ring buffer.\n
+     * Each cell carries a sequence number telling producers and the consumer whether it is free or filled, so pushing
+     * never takes a lock. Elements are filled and consumed in place to avoid copying large records
+     * \tparam T The stored element type. Must be default constructible
+     */
+    template <class T>
+    class MpscRingBuffer
+    {
+    public:
+        /**
+         * \brief Creates a ring buffer able to hold the given number of elements
+         * \param p_capacity The buffer's capacity. Must be a power of two
+         */
+        explicit MpscRingBuffer(size_t p_capacity);
+
+        /**
+         * \brief Disable ring buffer copying
+         */
+        MpscRingBuffer(const MpscRingBuffer& p_other) = delete;
+
+        /**
+         * \brief Disable ring buffer moving
+         */
+        MpscRingBuffer(MpscRingBuffer&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the ring buffer
+         */
+        ~MpscRingBuffer() = default;
+
+        /**
+         * \brief Disable ring buffer copying
+         */
+        MpscRingBuffer& operator=(const MpscRingBuffer& p_other) = delete;
+
+        /**
+         * \brief Disable ring buffer moving
+         */
+        MpscRingBuffer& operator=(MpscRingBuffer&& p_other) noexcept = delete;
+
+        /**
+         * \brief Reserves a free cell and fills it in place. Safe to call from any thread
+         * \tparam Func The filling function's type. Must be callable as `void(T&)`
+         * \param p_fill The function writing the new element
+         * \return True on success. False if the buffer is full
+         */
+        template <class Func>
+        bool TryPush(Func&& p_fill);
+
+        /**
+         * \brief Consumes the oldest element in place. Consumer thread only
+         * \tparam Func The consuming function's type. Must be callable as `void(T&)`
+         * \param p_consume The function reading the element
+         * \return True on success. False if the buffer is empty or the oldest element is still being filled
+         */
+        template <class Func>
+        bool TryPop(Func&& p_consume);
+
+        /**
+         * \brief Gets the ring buffer's capacity
+         * \return The maximum number of elements
+         */
+        size_t GetCapacity() const;
+
+        /**
+         * \brief Gets the number of cells reserved by producers since the buffer's creation
+         * \return The total number of started pushes
+         */
+        size_t GetPushCount() const;
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> m_sequence;
+            T                   m_value;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        size_t                  m_mask;
+
+        // Keep the producers' end and the consumer's end on separate cache lines
+        alignas(64) std::atomic<size_t> m_head = 0;
+        alignas(64) size_t              m_tail = 0;
+    };
+}
+
+#include "SurvivantCore/Threading/MpscRingBuffer.inl"
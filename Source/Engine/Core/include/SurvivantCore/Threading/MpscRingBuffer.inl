@@ -0,0 +1,84 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/Threading/MpscRingBuffer.h"
+
+#include <cstdint>
+
+namespace SvCore::Threading
+{
+    template <class T>
+    MpscRingBuffer<T>::MpscRingBuffer(const size_t p_capacity)
+        : m_cells(std::make_unique<Cell[]>(p_capacity)), m_mask(p_capacity - 1)
+    {
+        ASSERT(p_capacity > 0 && (p_capacity & (p_capacity - 1)) == 0, "Ring buffer capacity must be a power of two");
+
+        for (size_t i = 0; i < p_capacity; ++i)
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+
+    template <class T>
+    template <class Func>
+    bool MpscRingBuffer<T>::TryPush(Func&& p_fill)
+    {
+        size_t position = m_head.load(std::memory_order_relaxed);
+        Cell*  cell;
+
+        for (;;)
+        {
+            cell = &m_cells[position & m_mask];
+
+            const size_t   sequence   = cell->m_sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                // The consumer hasn't freed this cell yet
+                return false;
+            }
+            else
+            {
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        p_fill(cell->m_value);
+        cell->m_sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template <class T>
+    template <class Func>
+    bool MpscRingBuffer<T>::TryPop(Func&& p_consume)
+    {
+        Cell& cell = m_cells[m_tail & m_mask];
+
+        if (cell.m_sequence.load(std::memory_order_acquire) != m_tail + 1)
+            return false;
+
+        p_consume(cell.m_value);
+
+        // Hand the cell back to the producers for the next lap
+        cell.m_sequence.store(m_tail + m_mask + 1, std::memory_order_release);
+        ++m_tail;
+
+        return true;
+    }
+
+    template <class T>
+    size_t MpscRingBuffer<T>::GetCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+    template <class T>
+    size_t MpscRingBuffer<T>::GetPushCount() const
+    {
+        return m_head.load(std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace SvCore::Threading
+{
+    /**
+     * \brief Fixed capacity Chase-Lev work stealing deque.\n
+     * Only the owning thread may push and pop (LIFO, from the bottom). Any thread may steal (FIFO, from the top)
+     * \tparam T The stored pointee type
+     */
+    template <class T>
+    class WorkStealingQueue
+    {
+    public:
+        /**
+         * \brief Creates a queue able to hold the given number of elements
+         * \param p_capacity The queue's capacity. Must be a power of two
+         */
+        explicit WorkStealingQueue(size_t p_capacity);
+
+        /**
+         * \brief Disable work stealing queue copying
+         */
+        WorkStealingQueue(const WorkStealingQueue& p_other) = delete;
+
+        /**
+         * \brief Disable work stealing queue moving
+         */
+        WorkStealingQueue(WorkStealingQueue&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the queue. Remaining elements aren't freed
+         */
+        ~WorkStealingQueue() = default;
+
+        /**
+         * \brief Disable work stealing queue copying
+         */
+        WorkStealingQueue& operator=(const WorkStealingQueue& p_other) = delete;
+
+        /**
+         * \brief Disable work stealing queue moving
+         */
+        WorkStealingQueue& operator=(WorkStealingQueue&& p_other) noexcept = delete;
+
+        /**
+         * \brief Adds the given element at the bottom of the queue. Owner thread only
+         * \param p_item The element to add
+         * \return True on success. False if the queue is full
+         */
+        bool Push(T* p_item);
+
+        /**
+         * \brief Removes the element at the bottom of the queue. Owner thread only
+         * \return The removed element. nullptr if the queue is empty or the last element was stolen
+         */
+        T* Pop();
+
+        /**
+         * \brief Removes the element at the top of the queue. Safe to call from any thread
+         * \return The removed element. nullptr if the queue is empty or another thread won the race
+         */
+        T* Steal();
+
+        /**
+         * \brief Gets the approximate number of elements in the queue
+         * \return The number of queued elements at the time of the call
+         */
+        size_t GetSize() const;
+
+    private:
+        std::unique_ptr<std::atomic<T*>[]> m_items;
+        int64_t                            m_mask;
+
+        // Keep the owner's end and the thieves' end on separate cache lines
+        alignas(64) std::atomic<int64_t> m_top    = 0;
+        alignas(64) std::atomic<int64_t> m_bottom = 0;
+    };
+}
+
+#include "SurvivantCore/Threading/WorkStealingQueue.inl"
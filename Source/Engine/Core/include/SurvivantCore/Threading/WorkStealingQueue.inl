@@ -0,0 +1,87 @@
+#pragma once
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/Threading/WorkStealingQueue.h"
+
+namespace SvCore::Threading
+{
+    template <class T>
+    WorkStealingQueue<T>::WorkStealingQueue(const size_t p_capacity)
+        : m_items(std::make_unique<std::atomic<T*>[]>(p_capacity)), m_mask(static_cast<int64_t>(p_capacity) - 1)
+    {
+        ASSERT(p_capacity > 0 && (p_capacity & (p_capacity - 1)) == 0, "Work stealing queue capacity must be a power of two");
+    }
+
+    template <class T>
+    bool WorkStealingQueue<T>::Push(T* p_item)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top    = m_top.load(std::memory_order_acquire);
+
+        if (bottom - top > m_mask)
+            return false;
+
+        m_items[bottom & m_mask].store(p_item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    template <class T>
+    T* WorkStealingQueue<T>::Pop()
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            // Empty - restore the bottom
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = m_items[bottom & m_mask].load(std::memory_order_relaxed);
+
+        if (top == bottom)
+        {
+            // Last element - race against thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                item = nullptr;
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    template <class T>
+    T* WorkStealingQueue<T>::Steal()
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return nullptr;
+
+        T* item = m_items[top & m_mask].load(std::memory_order_relaxed);
+
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+
+        return item;
+    }
+
+    template <class T>
+    size_t WorkStealingQueue<T>::GetSize() const
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top    = m_top.load(std::memory_order_relaxed);
+
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+}
@@ -21,4 +21,12 @@ namespace SvCore::Utility
      * \return True on success. False otherwise
      */
     bool SetWorkingDirectory(const std::string& p_directory);
+
+    /**
+     * \brief Converts the given path to an absolute, lexically normal path with forward slashes.\n
+     * Paths are case-insensitive on Windows so the result is lower case there
+     * \param p_path The path to normalize
+     * \return The normalized path
+     */
+    std::string NormalizePath(const std::string& p_path);
 }
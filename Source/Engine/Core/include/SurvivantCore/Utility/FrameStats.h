@@ -0,0 +1,143 @@
+#pragma once
+#include "SurvivantCore/Utility/Timer.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SvCore::Utility
+{
+    /**
+     * \brief The distribution of a timing over the statistics window
+     */
+    struct TimingSummary
+    {
+        size_t m_sampleCount = 0;
+        size_t m_hitchCount  = 0;
+        float  m_min         = 0;
+        float  m_average     = 0;
+        float  m_p50         = 0;
+        float  m_p95         = 0;
+        float  m_p99         = 0;
+        float  m_max         = 0;
+    };
+
+    /**
+     * \brief Keeps a rolling window of frame times and named per-frame timings (e.g. per subsystem) to report their
+     * distribution instead of a single average.\n
+     * A sample is counted as a hitch when it exceeds the window's average by the hitch factor
+     */
+    class FrameStats
+    {
+    public:
+        static constexpr const char* FRAME_TIMING_NAME   = "Frame";
+        static constexpr size_t      DEFAULT_WINDOW_SIZE = 600;
+        static constexpr float       DEFAULT_HITCH_RATIO = 2.f;
+
+        /**
+         * \brief Creates frame statistics with the given window
+         * \param p_windowSize The number of most recent samples kept per timing
+         * \param p_hitchRatio The ratio to the window's average above which a sample is counted as a hitch
+         */
+        explicit FrameStats(size_t p_windowSize = DEFAULT_WINDOW_SIZE, float p_hitchRatio = DEFAULT_HITCH_RATIO);
+
+        /**
+         * \brief Adds the timer's last real delta time as a frame time sample. Call it right after ticking the timer
+         * \param p_timer The frame timer
+         */
+        void AddFrame(const Timer& p_timer);
+
+        /**
+         * \brief Adds a sample to the given named timing for the current frame
+         * \param p_name The timing's name
+         * \param p_milliseconds The sample's duration in milliseconds
+         */
+        void AddTiming(const std::string& p_name, float p_milliseconds);
+
+        /**
+         * \brief Gets the frame times' distribution over the window
+         * \return The frame times' summary
+         */
+        TimingSummary GetFrameSummary() const;
+
+        /**
+         * \brief Gets the given timing's distribution over the window
+         * \param p_name The timing's name
+         * \return The timing's summary. Empty if the timing has no sample
+         */
+        TimingSummary GetSummary(const std::string& p_name) const;
+
+        /**
+         * \brief Gets the names of every recorded timing, in order of first appearance
+         * \return The recorded timings' names
+         */
+        std::vector<std::string> GetTimingNames() const;
+
+        /**
+         * \brief Gets the number of frame hitches since the statistics' creation or last reset
+         * \return The total number of frame hitches
+         */
+        size_t GetTotalHitchCount() const;
+
+        /**
+         * \brief Starts writing every sample to the given file as "frame,timing,milliseconds" CSV rows
+         * \param p_filePath The CSV file's path
+         * \return True if the file could be opened. False otherwise
+         */
+        bool OpenCsv(const std::filesystem::path& p_filePath);
+
+        /**
+         * \brief Writes every timing's summary to the given file as CSV
+         * \param p_filePath The CSV file's path
+         * \return True on success. False otherwise
+         */
+        bool WriteSummaryCsv(const std::filesystem::path& p_filePath) const;
+
+        /**
+         * \brief Formats the frame times' summary for logging
+         * \return The frame times' summary as a single line
+         */
+        std::string ToString() const;
+
+        /**
+         * \brief Clears every sample and hitch count
+         */
+        void Reset();
+
+    private:
+        struct Timing
+        {
+            std::string        m_name;
+            std::vector<float> m_samples;
+            std::vector<bool>  m_hitches;
+            size_t             m_next            = 0;
+            size_t             m_hitchCount      = 0;
+            size_t             m_totalHitchCount = 0;
+            double             m_sum             = 0;
+        };
+
+        std::vector<Timing>                     m_timings;
+        std::unordered_map<std::string, size_t> m_timingIndices;
+        std::ofstream                           m_csv;
+        uint64_t                                m_frameIndex = 0;
+        size_t                                  m_windowSize;
+        float                                   m_hitchRatio;
+
+        /**
+         * \brief Adds a sample to the given timing, replacing its oldest one when the window is full
+         * \param p_timing The timing to update
+         * \param p_milliseconds The sample's duration in milliseconds
+         */
+        void AddSample(Timing& p_timing, float p_milliseconds);
+
+        /**
+         * \brief Computes the given timing's distribution over the window
+         * \param p_timing The timing to summarize
+         * \return The timing's summary
+         */
+        static TimingSummary Summarize(const Timing& p_timing);
+    };
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace SvCore::Utility
+{
+    /**
+     * \brief Read-only file mapped in memory with copy-on-write pages.\n
+     * Writes to the mapped bytes stay private to the process and are never written back to the file, which lets
+     * loaders patch the data in place
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * \brief Creates a closed mapped file
+         */
+        MappedFile() = default;
+
+        /**
+         * \brief Disable mapped file copying
+         */
+        MappedFile(const MappedFile& p_other) = delete;
+
+        /**
+         * \brief Disable mapped file moving
+         */
+        MappedFile(MappedFile&& p_other) noexcept = delete;
+
+        /**
+         * \brief Unmaps the file
+         */
+        ~MappedFile();
+
+        /**
+         * \brief Disable mapped file copying
+         */
+        MappedFile& operator=(const MappedFile& p_other) = delete;
+
+        /**
+         * \brief Disable mapped file moving
+         */
+        MappedFile& operator=(MappedFile&& p_other) noexcept = delete;
+
+        /**
+         * \brief Maps the given file, unmapping the current one
+         * \param p_path The file's path
+         * \return True on success. False if the file couldn't be opened or is empty
+         */
+        bool Open(const std::string& p_path);
+
+        /**
+         * \brief Unmaps the file. Pointers to its data become dangling
+         */
+        void Close();
+
+        /**
+         * \brief Checks whether a file is mapped
+         * \return True if a file is mapped. False otherwise
+         */
+        bool IsOpen() const;
+
+        /**
+         * \brief Gets the mapped bytes
+         * \return A pointer to the file's first byte. Nullptr if no file is mapped
+         */
+        std::byte* GetData() const;
+
+        /**
+         * \brief Gets the mapped file's size
+         * \return The file's size in bytes
+         */
+        size_t GetSize() const;
+
+    private:
+        std::byte* m_data = nullptr;
+        size_t     m_size = 0;
+    };
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+// Detect the available SIMD instruction sets.
+// SSE2 is part of the x86-64 baseline so it is always available on 64-bit builds
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SV_SIMD_SSE2
+#include <emmintrin.h>
+#endif // SSE2
@@ -51,6 +51,12 @@ namespace SvCore::Utility
          */
         float getUnscaledDeltaTime() const;
 
+        /**
+         * \brief Gets the real time between the previous and last ticks, even in fixed step mode
+         * \return The real time between the previous and last ticks
+         */
+        float getRealDeltaTime() const;
+
         /**
          * \brief Gets the current time scale
          * \return The current time scale
@@ -62,6 +68,19 @@ namespace SvCore::Utility
          */
         void setTimeScale(float timeScale);
 
+        /**
+         * \brief Gets the fixed time step
+         * \return The unscaled time added on each tick. 0 when the timer follows the real time
+         */
+        float getFixedDeltaTime() const;
+
+        /**
+         * \brief Sets the fixed time step. In fixed step mode, each tick advances the timer by the given step
+         * regardless of the real elapsed time, making the simulation reproducible across runs
+         * \param fixedDeltaTime The unscaled time to add on each tick. 0 to follow the real time
+         */
+        void setFixedDeltaTime(float fixedDeltaTime);
+
         /**
          * \brief Gets the number of time the "tick" function has been called
          * \return The elapsed number of frames since the timer's creation
@@ -76,10 +95,12 @@ namespace SvCore::Utility
 
         uint64_t m_frameCount = 0;
 
-        float m_time         = 0;
-        float m_unscaledTime = 0;
-        float m_deltaTime    = 0;
-        float m_timeScale    = 1;
+        float m_time           = 0;
+        float m_unscaledTime   = 0;
+        float m_deltaTime      = 0;
+        float m_realDeltaTime  = 0;
+        float m_fixedDeltaTime = 0;
+        float m_timeScale      = 1;
 
         bool m_isFirstUpdate = true;
     };
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace SvCore::Utility
@@ -73,6 +75,13 @@ namespace SvCore::Utility
      * \return The string converted to lower case
      */
     std::string ToLower(std::string p_str);
+
+    /**
+     * \brief Hashes the given string with 64-bit FNV-1a. The result is the same on every platform and run
+     * \param p_str The string to hash
+     * \return The string's hash
+     */
+    constexpr uint64_t HashString(std::string_view p_str);
 }
 
 #include "SurvivantCore/Utility/Utility.inl"
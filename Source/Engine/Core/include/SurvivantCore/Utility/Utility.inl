@@ -53,4 +53,17 @@ namespace SvCore::Utility
         TrimStringEnd(p_str, p_compareFunc);
         TrimStringStart(p_str, p_compareFunc);
     }
+
+    constexpr uint64_t HashString(const std::string_view p_str)
+    {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (const char c : p_str)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
 }
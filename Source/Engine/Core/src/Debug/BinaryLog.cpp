@@ -0,0 +1,394 @@
+#include "SurvivantCore/Debug/BinaryLog.h"
+
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+using namespace SvCore::Enums;
+
+namespace SvCore::Debug
+{
+    namespace
+    {
+        constexpr uint32_t BINARY_LOG_MAGIC   = 0x474C5653; // "SVLG"
+        constexpr uint32_t BINARY_LOG_VERSION = 2;
+
+        constexpr char STRING_ENTRY = 'S';
+        constexpr char RECORD_ENTRY = 'R';
+        constexpr char TEXT_ENTRY   = 'T';
+
+        constexpr const char* LEVEL_NAMES[] = { "TRACE", "DEBUG", "INFO", "WARNING", "ERROR" };
+
+        struct Argument
+        {
+            ELogArgType m_type = ELogArgType::INT;
+            uint64_t    m_bits = 0;
+            std::string m_string;
+
+            int64_t AsInt() const
+            {
+                return m_type == ELogArgType::FLOAT ? static_cast<int64_t>(AsDouble()) : static_cast<int64_t>(m_bits);
+            }
+
+            uint64_t AsUInt() const
+            {
+                return m_type == ELogArgType::FLOAT ? static_cast<uint64_t>(AsDouble()) : m_bits;
+            }
+
+            double AsDouble() const
+            {
+                switch (m_type)
+                {
+                case ELogArgType::FLOAT:
+                    return std::bit_cast<double>(m_bits);
+                case ELogArgType::INT:
+                    return static_cast<double>(static_cast<int64_t>(m_bits));
+                default:
+                    return static_cast<double>(m_bits);
+                }
+            }
+        };
+
+        class ArgumentReader
+        {
+        public:
+            ArgumentReader(const std::byte* p_data, const size_t p_size)
+                : m_data(p_data), m_size(p_size)
+            {
+            }
+
+            bool Read(Argument& p_out)
+            {
+                if (m_offset >= m_size)
+                    return false;
+
+                p_out.m_type = static_cast<ELogArgType>(m_data[m_offset++]);
+
+                if (p_out.m_type != ELogArgType::STRING)
+                    return ReadBytes(&p_out.m_bits, sizeof(p_out.m_bits));
+
+                uint16_t length;
+
+                if (!ReadBytes(&length, sizeof(length)) || m_offset + length > m_size)
+                    return false;
+
+                p_out.m_string.assign(reinterpret_cast<const char*>(m_data + m_offset), length);
+                m_offset += length;
+                return true;
+            }
+
+        private:
+            const std::byte* m_data;
+            size_t           m_size;
+            size_t           m_offset = 0;
+
+            bool ReadBytes(void* p_out, const size_t p_count)
+            {
+                if (m_offset + p_count > m_size)
+                    return false;
+
+                std::memcpy(p_out, m_data + m_offset, p_count);
+                m_offset += p_count;
+                return true;
+            }
+        };
+
+        std::string FormatArgument(const std::string& p_spec, const char p_conversion, const Argument& p_argument)
+        {
+            switch (p_conversion)
+            {
+            case 'd':
+            case 'i':
+                return Utility::FormatString(p_spec + "lld", static_cast<long long>(p_argument.AsInt()));
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                return Utility::FormatString(p_spec + "ll" + p_conversion, static_cast<unsigned long long>(p_argument.AsUInt()));
+            case 'c':
+                return Utility::FormatString(p_spec + 'c', static_cast<int>(p_argument.AsInt()));
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                return Utility::FormatString(p_spec + p_conversion, p_argument.AsDouble());
+            case 's':
+                if (p_argument.m_type != ELogArgType::STRING)
+                    return "(invalid)";
+
+                return Utility::FormatString(p_spec + 's', p_argument.m_string.c_str());
+            case 'p':
+                return Utility::FormatString(p_spec + 'p', reinterpret_cast<void*>(static_cast<uintptr_t>(p_argument.m_bits)));
+            default:
+                return "(invalid)";
+            }
+        }
+
+        template <class T>
+        void WriteValue(std::ostream& p_stream, const T& p_value)
+        {
+            p_stream.write(reinterpret_cast<const char*>(&p_value), sizeof(T));
+        }
+
+        template <class T>
+        bool ReadValue(std::istream& p_stream, T& p_value)
+        {
+            return static_cast<bool>(p_stream.read(reinterpret_cast<char*>(&p_value), sizeof(T)));
+        }
+
+        bool ReadBlock(std::istream& p_stream, const size_t p_size, std::string& p_out)
+        {
+            p_out.resize(p_size);
+            return static_cast<bool>(p_stream.read(p_out.data(), static_cast<std::streamsize>(p_size)));
+        }
+    }
+
+    const std::byte* LogArguments::GetData() const
+    {
+        return m_data;
+    }
+
+    size_t LogArguments::GetSize() const
+    {
+        return m_size;
+    }
+
+    std::string LogArguments::Format(const char* p_format, const std::byte* p_data, const size_t p_size)
+    {
+        std::string    result;
+        ArgumentReader reader(p_data, p_size);
+        const char*    it = p_format;
+
+        while (*it)
+        {
+            if (*it != '%')
+            {
+                result += *it++;
+                continue;
+            }
+
+            const char* specStart = it++;
+
+            if (*it == '%')
+            {
+                result += '%';
+                ++it;
+                continue;
+            }
+
+            std::string spec = "%";
+
+            while (*it && std::strchr("-+ #0", *it))
+                spec += *it++;
+
+            while (*it && (std::isdigit(static_cast<unsigned char>(*it)) || *it == '.' || *it == '*'))
+            {
+                if (*it++ != '*')
+                {
+                    spec += it[-1];
+                    continue;
+                }
+
+                // Dynamic width and precision are stored as regular arguments
+                Argument size;
+                spec += std::to_string(reader.Read(size) ? size.AsInt() : 0);
+            }
+
+            // Length modifiers are picked from the stored argument's type instead
+            while (*it && std::strchr("hlzjtL", *it))
+                ++it;
+
+            if (!*it)
+            {
+                result += specStart;
+                break;
+            }
+
+            const char conversion = *it++;
+            Argument   argument;
+
+            if (reader.Read(argument))
+                result += FormatArgument(spec, conversion, argument);
+            else
+                result += "(missing)";
+        }
+
+        return result;
+    }
+
+    void LogArguments::AddString(const char* p_string)
+    {
+        if (!p_string)
+            p_string = "(null)";
+
+        constexpr size_t headerSize = 1 + sizeof(uint16_t);
+
+        if (m_size + headerSize > CAPACITY)
+            return;
+
+        const auto length = static_cast<uint16_t>(std::min(std::strlen(p_string), CAPACITY - m_size - headerSize));
+
+        Append(ELogArgType::STRING, &length, sizeof(length));
+        std::memcpy(m_data + m_size, p_string, length);
+        m_size += length;
+    }
+
+    void LogArguments::Append(const ELogArgType p_type, const void* p_value, const size_t p_size)
+    {
+        // Arguments that don't fit are dropped - they are formatted as missing
+        if (m_size + 1 + p_size > CAPACITY)
+            return;
+
+        m_data[m_size++] = static_cast<std::byte>(p_type);
+        std::memcpy(m_data + m_size, p_value, p_size);
+        m_size += p_size;
+    }
+
+    bool BinaryLogFile::Open(const std::filesystem::path& p_filePath)
+    {
+        m_file.close();
+        m_file.open(p_filePath, std::ios::binary | std::ios::trunc);
+        m_stringIds.clear();
+
+        if (!m_file.is_open())
+            return false;
+
+        WriteValue(m_file, BINARY_LOG_MAGIC);
+        WriteValue(m_file, BINARY_LOG_VERSION);
+        return true;
+    }
+
+    bool BinaryLogFile::IsOpen() const
+    {
+        return m_file.is_open();
+    }
+
+    void BinaryLogFile::WriteRecord(const char* p_format, const char* p_file, const uint32_t p_line, const char* p_category,
+                                    const ELogLevel p_level, const std::byte* p_data, const uint16_t p_size)
+    {
+        const uint32_t formatId   = GetStringId(p_format);
+        const uint32_t fileId     = GetStringId(p_file);
+        const uint32_t categoryId = GetStringId(p_category);
+
+        WriteValue(m_file, RECORD_ENTRY);
+        WriteValue(m_file, formatId);
+        WriteValue(m_file, fileId);
+        WriteValue(m_file, categoryId);
+        WriteValue(m_file, p_line);
+        WriteValue(m_file, p_level);
+        WriteValue(m_file, p_size);
+        m_file.write(reinterpret_cast<const char*>(p_data), p_size);
+    }
+
+    void BinaryLogFile::WriteText(const std::string_view p_message, const ELogLevel p_level)
+    {
+        WriteValue(m_file, TEXT_ENTRY);
+        WriteValue(m_file, p_level);
+        WriteValue(m_file, static_cast<uint32_t>(p_message.size()));
+        m_file.write(p_message.data(), static_cast<std::streamsize>(p_message.size()));
+    }
+
+    void BinaryLogFile::Flush()
+    {
+        m_file.flush();
+    }
+
+    uint32_t BinaryLogFile::GetStringId(const char* p_string)
+    {
+        const auto it = m_stringIds.find(p_string);
+
+        if (it != m_stringIds.end())
+            return it->second;
+
+        const auto id     = static_cast<uint32_t>(m_stringIds.size());
+        const auto length = static_cast<uint32_t>(std::strlen(p_string));
+
+        WriteValue(m_file, STRING_ENTRY);
+        WriteValue(m_file, id);
+        WriteValue(m_file, length);
+        m_file.write(p_string, length);
+
+        m_stringIds.emplace(p_string, id);
+        return id;
+    }
+
+    bool DecodeBinaryLog(std::istream& p_input, std::ostream& p_output)
+    {
+        uint32_t magic, version;
+
+        if (!ReadValue(p_input, magic) || !ReadValue(p_input, version)
+            || magic != BINARY_LOG_MAGIC || version != BINARY_LOG_VERSION)
+            return false;
+
+        std::vector<std::string> strings;
+        std::string              block;
+        char                     entry;
+
+        while (ReadValue(p_input, entry))
+        {
+            switch (entry)
+            {
+            case STRING_ENTRY:
+            {
+                uint32_t id, length;
+
+                if (!ReadValue(p_input, id) || !ReadValue(p_input, length) || id != strings.size()
+                    || !ReadBlock(p_input, length, block))
+                    return false;
+
+                strings.push_back(block);
+                break;
+            }
+            case RECORD_ENTRY:
+            {
+                uint32_t  formatId, fileId, categoryId, line;
+                ELogLevel level;
+                uint16_t  size;
+
+                if (!ReadValue(p_input, formatId) || !ReadValue(p_input, fileId) || !ReadValue(p_input, categoryId)
+                    || !ReadValue(p_input, line) || !ReadValue(p_input, level) || !ReadValue(p_input, size)
+                    || !ReadBlock(p_input, size, block)
+                    || formatId >= strings.size() || fileId >= strings.size() || categoryId >= strings.size()
+                    || level > ELogLevel::SEVERE)
+                    return false;
+
+                const std::string message = LogArguments::Format(strings[formatId].c_str(),
+                    reinterpret_cast<const std::byte*>(block.data()), block.size());
+
+                p_output << strings[fileId] << '(' << line << "): " << LEVEL_NAMES[static_cast<size_t>(level)] << ' ';
+
+                if (!strings[categoryId].empty())
+                    p_output << '[' << strings[categoryId] << "] ";
+
+                p_output << message << '\n';
+                break;
+            }
+            case TEXT_ENTRY:
+            {
+                ELogLevel level;
+                uint32_t  length;
+
+                if (!ReadValue(p_input, level) || !ReadValue(p_input, length) || !ReadBlock(p_input, length, block))
+                    return false;
+
+                p_output << block;
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+
+        return p_input.eof();
+    }
+}
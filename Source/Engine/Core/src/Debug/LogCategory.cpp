@@ -0,0 +1,93 @@
+#include "SurvivantCore/Debug/LogCategory.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+using namespace SvCore::Enums;
+
+namespace SvCore::Debug
+{
+    namespace
+    {
+        struct CategoryRegistry
+        {
+            std::vector<LogCategory*> m_categories;
+            std::mutex                m_mutex;
+        };
+
+        CategoryRegistry& GetRegistry()
+        {
+            static CategoryRegistry registry;
+            return registry;
+        }
+    }
+
+    std::atomic<ELogLevel> LogCategory::s_globalLevel = ELogLevel::TRACE;
+
+    LogCategory::LogCategory(const char* p_name, const ELogLevel p_level)
+        : m_name(p_name), m_level(p_level)
+    {
+        CategoryRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+        registry.m_categories.push_back(this);
+    }
+
+    LogCategory::~LogCategory()
+    {
+        CategoryRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+        std::erase(registry.m_categories, this);
+    }
+
+    const char* LogCategory::GetName() const
+    {
+        return m_name;
+    }
+
+    ELogLevel LogCategory::GetLevel() const
+    {
+        return m_level;
+    }
+
+    void LogCategory::SetLevel(const ELogLevel p_level)
+    {
+        m_level = p_level;
+    }
+
+    bool LogCategory::SetLevel(const std::string_view p_name, const ELogLevel p_level)
+    {
+        CategoryRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        const auto it = std::ranges::find_if(registry.m_categories, [p_name](const LogCategory* p_category)
+        {
+            return p_name == p_category->GetName();
+        });
+
+        if (it == registry.m_categories.end())
+            return false;
+
+        (*it)->SetLevel(p_level);
+        return true;
+    }
+
+    void LogCategory::SetGlobalLevel(const ELogLevel p_level)
+    {
+        s_globalLevel = p_level;
+    }
+
+    ELogLevel LogCategory::GetGlobalLevel()
+    {
+        return s_globalLevel;
+    }
+
+    LogCategory& LogCategory::GetDefault()
+    {
+        static LogCategory instance("");
+        return instance;
+    }
+}
@@ -0,0 +1,444 @@
+#include "SurvivantCore/Debug/Logger.h"
+
+#include "SurvivantCore/Memory/MemoryTracker.h"
+#include "SurvivantCore/Threading/MpscRingBuffer.h"
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // _WIN32
+
+using namespace SvCore::Enums;
+
+namespace SvCore::Debug
+{
+    static_assert(static_cast<int>(ELogLevel::TRACE) == SV_LOG_LEVEL_TRACE);
+    static_assert(static_cast<int>(ELogLevel::DEBUG) == SV_LOG_LEVEL_DEBUG);
+    static_assert(static_cast<int>(ELogLevel::INFO) == SV_LOG_LEVEL_INFO);
+    static_assert(static_cast<int>(ELogLevel::WARNING) == SV_LOG_LEVEL_WARNING);
+    static_assert(static_cast<int>(ELogLevel::SEVERE) == SV_LOG_LEVEL_SEVERE);
+
+    struct Logger::Record
+    {
+        static constexpr size_t MAX_LENGTH = 500;
+
+        // Set for deferred records, whose data holds raw arguments instead of text
+        const char* m_format   = nullptr;
+        const char* m_file     = nullptr;
+        const char* m_category = nullptr;
+        uint32_t    m_line     = 0;
+        ELogLevel   m_level    = ELogLevel::INFO;
+        uint16_t    m_length   = 0;
+        char        m_data[MAX_LENGTH]{};
+
+        static_assert(LogArguments::CAPACITY <= MAX_LENGTH);
+    };
+
+    namespace
+    {
+        std::terminate_handler g_previousTerminate = nullptr;
+
+        void OnCrash(const int p_signal)
+        {
+            Logger::GetInstance().FlushOnCrash();
+
+            std::signal(p_signal, SIG_DFL);
+            std::raise(p_signal);
+        }
+
+        void OnTerminate()
+        {
+            Logger::GetInstance().Flush();
+
+            if (g_previousTerminate)
+                g_previousTerminate();
+
+            std::abort();
+        }
+
+        /**
+         * \brief Writes the given text to the standard error without going through the streams or taking locks
+         * \param p_text The text to write
+         */
+        void WriteToStandardError(const std::string_view p_text)
+        {
+#ifdef _WIN32
+            (void)_write(2, p_text.data(), static_cast<unsigned>(p_text.size()));
+#else
+            (void)write(STDERR_FILENO, p_text.data(), p_text.size());
+#endif // _WIN32
+        }
+
+        void InstallCrashHandlers()
+        {
+            static std::once_flag once;
+
+            std::call_once(once, []
+            {
+                for (const int signal : { SIGABRT, SIGSEGV, SIGFPE, SIGILL })
+                    std::signal(signal, &OnCrash);
+
+                g_previousTerminate = std::set_terminate(&OnTerminate);
+            });
+        }
+    }
+
+    Logger::Logger() = default;
+
+    Logger::~Logger()
+    {
+        StopAsync();
+    }
+
+    void Logger::SetFile(const std::filesystem::path& p_filePath)
+    {
+        bool isOpen;
+
+        {
+            std::scoped_lock lock(m_outputMutex);
+
+            m_file.close();
+            m_file.open(p_filePath, std::ios::app);
+            isOpen = m_file.is_open();
+        }
+
+        if (!isOpen)
+            Write(Utility::FormatString("Failed to open log file \"%s\"\n", p_filePath.string().c_str()), ELogLevel::SEVERE);
+    }
+
+    void Logger::SetBinaryFile(const std::filesystem::path& p_filePath)
+    {
+        bool isOpen;
+
+        {
+            std::scoped_lock lock(m_outputMutex);
+            isOpen = m_binaryFile.Open(p_filePath);
+        }
+
+        if (!isOpen)
+            Write(Utility::FormatString("Failed to open binary log file \"%s\"\n", p_filePath.string().c_str()),
+                  ELogLevel::SEVERE);
+    }
+
+    void Logger::SetDeferredFormatting(const bool p_isDeferred)
+    {
+        m_isDeferred = p_isDeferred;
+    }
+
+    void Logger::StartAsync(const ELogOverflow p_overflow, const size_t p_capacity)
+    {
+        if (m_isAsync)
+            return;
+
+        SV_MEMORY_TAG(EMemoryTag::LOGGING);
+
+        m_records       = std::make_unique<Threading::MpscRingBuffer<Record>>(p_capacity);
+        m_overflow      = p_overflow;
+        m_writtenCount  = 0;
+        m_droppedCount  = 0;
+        m_reportedDrops = 0;
+        m_isRunning     = true;
+        m_writer        = std::thread(&Logger::WriterLoop, this);
+        m_isAsync       = true;
+
+        InstallCrashHandlers();
+    }
+
+    void Logger::StopAsync()
+    {
+        if (!m_isAsync)
+            return;
+
+        m_isAsync   = false;
+        m_isRunning = false;
+        m_writerCondition.notify_one();
+        m_writer.join();
+
+        // Catch messages pushed while the writer was stopping
+        WritePending();
+    }
+
+    void Logger::Flush()
+    {
+        if (!m_isAsync)
+        {
+            std::scoped_lock lock(m_outputMutex);
+
+            std::cout.flush();
+            std::cerr.flush();
+
+            if (m_file.is_open())
+                m_file.flush();
+
+            if (m_binaryFile.IsOpen())
+                m_binaryFile.Flush();
+
+            return;
+        }
+
+        // The writer can't wait for itself
+        if (std::this_thread::get_id() == m_writer.get_id())
+            return;
+
+        const size_t target = m_records->GetPushCount();
+        const auto   start  = std::chrono::steady_clock::now();
+
+        // Spin with a timeout instead of blocking - this also runs from crash handlers
+        while (m_writtenCount.load(std::memory_order_acquire) < target
+            && std::chrono::steady_clock::now() - start < FLUSH_TIMEOUT)
+        {
+            Wake();
+            std::this_thread::yield();
+        }
+    }
+
+    void Logger::FlushOnCrash()
+    {
+        // Synchronous messages are flushed as they are written
+        if (!m_isAsync)
+            return;
+
+        const bool isWriter = std::this_thread::get_id() == m_writer.get_id();
+
+        // The writer isn't woken up, since notifying takes locks - it still writes every WRITE_INTERVAL
+        if (!isWriter)
+        {
+            const size_t target = m_records->GetPushCount();
+            const auto   start  = std::chrono::steady_clock::now();
+
+            while (m_writtenCount.load(std::memory_order_acquire) < target
+                && std::chrono::steady_clock::now() - start < FLUSH_TIMEOUT)
+                std::this_thread::yield();
+        }
+
+        // The output's owner may be the crashing thread or a stuck writer, whose records can't be popped safely
+        if (isWriter || !m_outputMutex.try_lock())
+            return;
+
+        std::scoped_lock lock(std::adopt_lock, m_outputMutex);
+
+        // Deferred records would need formatting, which allocates, so only their format is written
+        while (m_records->TryPop([](const Record& p_record)
+        {
+            if (p_record.m_format)
+            {
+                WriteToStandardError(p_record.m_format);
+                WriteToStandardError("\n");
+            }
+            else
+            {
+                WriteToStandardError({ p_record.m_data, p_record.m_length });
+            }
+        }))
+        {
+            m_writtenCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool Logger::IsAsync() const
+    {
+        return m_isAsync;
+    }
+
+    size_t Logger::GetDroppedCount() const
+    {
+        return m_droppedCount;
+    }
+
+    Logger& Logger::GetInstance()
+    {
+        static Logger instance;
+        return instance;
+    }
+
+    std::string Logger::Decorate(const char* p_file, const size_t p_line, const char* p_category, const std::string& p_message)
+    {
+        const char* separator = *p_category ? "] " : "";
+        const char* prefix    = *p_category ? "[" : "";
+
+#if defined(_DEBUG) || defined(SV_VERBOSE_LOG)
+        return Utility::FormatString("%s(%zu): %s%s%s%s\n", p_file, p_line, prefix, p_category, separator, p_message.c_str());
+#else
+        (void)p_file;
+        (void)p_line;
+        return Utility::FormatString("%s%s%s%s\n", prefix, p_category, separator, p_message.c_str());
+#endif // _DEBUG || SV_VERBOSE_LOG
+    }
+
+    void Logger::Write(const std::string_view p_message, const ELogLevel p_level)
+    {
+        if (!m_isAsync)
+        {
+            std::scoped_lock lock(m_outputMutex);
+
+            Output(p_message, p_level);
+
+            (p_level >= ELogLevel::WARNING ? std::cerr : std::cout).flush();
+
+            if (m_file.is_open())
+                m_file.flush();
+
+            if (m_binaryFile.IsOpen())
+            {
+                m_binaryFile.WriteText(p_message, p_level);
+                m_binaryFile.Flush();
+            }
+
+            return;
+        }
+
+        Push([p_message, p_level](Record& p_record)
+        {
+            const size_t length = std::min(p_message.size(), Record::MAX_LENGTH);
+
+            std::memcpy(p_record.m_data, p_message.data(), length);
+            p_record.m_format = nullptr;
+            p_record.m_level  = p_level;
+            p_record.m_length = static_cast<uint16_t>(length);
+
+            if (length < p_message.size())
+                std::memcpy(p_record.m_data + length - 4, "...\n", 4);
+        }, p_level);
+    }
+
+    void Logger::WriteDeferred(const char* p_file, const size_t p_line, const char* p_category, const ELogLevel p_level,
+                               const char* p_format, const LogArguments& p_arguments)
+    {
+        Push([&](Record& p_record)
+        {
+            std::memcpy(p_record.m_data, p_arguments.GetData(), p_arguments.GetSize());
+            p_record.m_format   = p_format;
+            p_record.m_file     = p_file;
+            p_record.m_category = p_category;
+            p_record.m_line     = static_cast<uint32_t>(p_line);
+            p_record.m_level    = p_level;
+            p_record.m_length   = static_cast<uint16_t>(p_arguments.GetSize());
+        }, p_level);
+    }
+
+    template <class Func>
+    void Logger::Push(const Func& p_fill, const ELogLevel p_level)
+    {
+        bool isPushed = m_records->TryPush(p_fill);
+
+        while (!isPushed && m_overflow == ELogOverflow::BLOCK)
+        {
+            Wake();
+            std::this_thread::yield();
+            isPushed = m_records->TryPush(p_fill);
+        }
+
+        if (!isPushed)
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+
+        // Regular messages are batched until the next write interval
+        if (!isPushed || p_level >= ELogLevel::WARNING)
+            Wake();
+    }
+
+    void Logger::Output(const std::string_view p_message, const ELogLevel p_level)
+    {
+        (p_level >= ELogLevel::WARNING ? std::cerr : std::cout) << p_message;
+
+        if (m_file.is_open())
+            m_file << p_message;
+    }
+
+    void Logger::Wake()
+    {
+        // A missed notification only delays the batch until the next write interval
+        if (!m_isWakeQueued.exchange(true))
+            m_writerCondition.notify_one();
+    }
+
+    void Logger::WriterLoop()
+    {
+        while (m_isRunning)
+        {
+            {
+                std::unique_lock lock(m_writerMutex);
+                m_writerCondition.wait_for(lock, WRITE_INTERVAL, [this]
+                {
+                    return m_isWakeQueued || !m_isRunning;
+                });
+            }
+
+            m_isWakeQueued = false;
+            WritePending();
+        }
+
+        WritePending();
+    }
+
+    size_t Logger::WritePending()
+    {
+        std::scoped_lock lock(m_outputMutex);
+
+        size_t count = 0;
+
+        while (m_records->TryPop([this](const Record& p_record)
+        {
+            WriteRecord(p_record);
+        }))
+        {
+            ++count;
+        }
+
+        const size_t droppedCount = m_droppedCount.load(std::memory_order_relaxed);
+
+        if (droppedCount != m_reportedDrops)
+        {
+            Output(Utility::FormatString("%zu log messages dropped\n", droppedCount - m_reportedDrops), ELogLevel::WARNING);
+            m_reportedDrops = droppedCount;
+        }
+
+        if (count > 0)
+        {
+            std::cout.flush();
+            std::cerr.flush();
+
+            if (m_file.is_open())
+                m_file.flush();
+
+            if (m_binaryFile.IsOpen())
+                m_binaryFile.Flush();
+        }
+
+        m_writtenCount.fetch_add(count, std::memory_order_release);
+        return count;
+    }
+
+    void Logger::WriteRecord(const Record& p_record)
+    {
+        if (!p_record.m_format)
+        {
+            const std::string_view message(p_record.m_data, p_record.m_length);
+
+            Output(message, p_record.m_level);
+
+            if (m_binaryFile.IsOpen())
+                m_binaryFile.WriteText(message, p_record.m_level);
+
+            return;
+        }
+
+        const auto* arguments = reinterpret_cast<const std::byte*>(p_record.m_data);
+
+        const std::string message = LogArguments::Format(p_record.m_format, arguments, p_record.m_length);
+
+        Output(Decorate(p_record.m_file, p_record.m_line, p_record.m_category, message), p_record.m_level);
+
+        if (m_binaryFile.IsOpen())
+        {
+            m_binaryFile.WriteRecord(p_record.m_format, p_record.m_file, p_record.m_line, p_record.m_category,
+                                     p_record.m_level, arguments, p_record.m_length);
+        }
+    }
+}
@@ -0,0 +1,417 @@
+#include "SurvivantCore/Debug/Profiler.h"
+
+#include "SurvivantCore/Memory/MemoryTracker.h"
+#include "SurvivantCore/Memory/ScratchArena.h"
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <tuple>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SV_PROFILER_RDTSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SV_PROFILER_RDTSC
+#endif
+
+namespace SvCore::Debug
+{
+    struct Profiler::ThreadBuffer
+    {
+        std::unique_ptr<ProfileEvent[]> m_events = std::make_unique<ProfileEvent[]>(THREAD_BUFFER_CAPACITY);
+        std::atomic<uint64_t>           m_head   = 0;
+
+        // Reader side - only touched while draining
+        uint64_t m_readIndex = 0;
+
+        // Owner side - only touched by the buffer's thread
+        uint32_t m_depth = 0;
+
+        uint32_t    m_index = 0;
+        std::string m_name;
+    };
+
+    namespace
+    {
+        void WriteJsonString(std::ostream& p_stream, const char* p_string)
+        {
+            p_stream << '"';
+
+            for (const char* c = p_string; *c; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                    p_stream << '\\';
+
+                p_stream << *c;
+            }
+
+            p_stream << '"';
+        }
+    }
+
+    std::atomic<bool> Profiler::s_isEnabled = true;
+
+    ProfileZone::ProfileZone(const char* p_name)
+        : m_name(nullptr), m_start(0)
+    {
+        if (!Profiler::IsEnabled())
+            return;
+
+        ++Profiler::GetInstance().GetThreadBuffer().m_depth;
+
+        m_name  = p_name;
+        m_start = Profiler::GetTimestamp();
+    }
+
+    ProfileZone::~ProfileZone()
+    {
+        if (!m_name)
+            return;
+
+        const uint64_t end = Profiler::GetTimestamp();
+
+        Profiler::ThreadBuffer& buffer = Profiler::GetInstance().GetThreadBuffer();
+        const uint64_t          head   = buffer.m_head.load(std::memory_order_relaxed);
+
+        buffer.m_events[head % Profiler::THREAD_BUFFER_CAPACITY] = { m_name, m_start, end, --buffer.m_depth, buffer.m_index };
+        buffer.m_head.store(head + 1, std::memory_order_release);
+    }
+
+    Profiler::Profiler()
+        : m_startTicks(GetTimestamp()), m_startTime(std::chrono::steady_clock::now())
+    {
+        // Rough first estimate of the tick duration - refined every frame
+        while (std::chrono::steady_clock::now() - m_startTime < std::chrono::milliseconds(1))
+        {
+        }
+
+        Calibrate();
+        m_frameStart = GetTimestamp();
+    }
+
+    Profiler::~Profiler() = default;
+
+    uint64_t Profiler::GetTimestamp()
+    {
+#ifdef SV_PROFILER_RDTSC
+        return __rdtsc();
+#else
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#endif
+    }
+
+    double Profiler::ToMilliseconds(const uint64_t p_ticks) const
+    {
+        return static_cast<double>(p_ticks) / m_ticksPerMs;
+    }
+
+    int64_t Profiler::ToTicks(const double p_milliseconds) const
+    {
+        return static_cast<int64_t>(p_milliseconds * m_ticksPerMs);
+    }
+
+    void Profiler::SetEnabled(const bool p_isEnabled)
+    {
+        s_isEnabled = p_isEnabled;
+    }
+
+    bool Profiler::IsEnabled()
+    {
+        return s_isEnabled.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::SetThreadName(const std::string& p_name)
+    {
+        ThreadBuffer& buffer = GetThreadBuffer();
+
+        std::scoped_lock lock(m_bufferMutex);
+        buffer.m_name = p_name;
+    }
+
+    uint32_t Profiler::AddTrack(const std::string& p_name)
+    {
+        SV_MEMORY_TAG(Enums::EMemoryTag::PROFILING);
+
+        std::scoped_lock lock(m_bufferMutex);
+
+        std::unique_ptr<ThreadBuffer>& buffer = m_threadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+        buffer->m_index                       = static_cast<uint32_t>(m_threadBuffers.size() - 1);
+        buffer->m_name                        = p_name;
+
+        return buffer->m_index;
+    }
+
+    void Profiler::RecordEvent(const uint32_t p_track, const char* p_name, const uint64_t p_start, const uint64_t p_end,
+                               const uint32_t p_depth)
+    {
+        if (!IsEnabled())
+            return;
+
+        ThreadBuffer* buffer;
+
+        {
+            std::scoped_lock lock(m_bufferMutex);
+
+            if (p_track >= m_threadBuffers.size())
+                return;
+
+            buffer = m_threadBuffers[p_track].get();
+        }
+
+        const uint64_t head = buffer->m_head.load(std::memory_order_relaxed);
+
+        buffer->m_events[head % THREAD_BUFFER_CAPACITY] = { p_name, p_start, p_end, p_depth, p_track };
+        buffer->m_head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::EndFrame()
+    {
+        std::scoped_lock lock(m_drainMutex);
+
+        const uint64_t now = GetTimestamp();
+
+        Calibrate();
+
+        m_frameTime  = ToMilliseconds(now - m_frameStart);
+        m_frameStart = now;
+
+        m_frameEvents.clear();
+        Drain(m_frameEvents);
+
+        if (m_isCapturing)
+        {
+            const size_t count = std::min(m_frameEvents.size(), MAX_CAPTURE_EVENTS - m_captureEvents.size());
+            m_captureEvents.insert(m_captureEvents.end(), m_frameEvents.begin(), m_frameEvents.begin() + count);
+            m_captureFrames.push_back(now);
+        }
+
+        Aggregate(m_frameEvents);
+    }
+
+    const std::vector<ProfileZoneStats>& Profiler::GetFrameZones() const
+    {
+        return m_frameZones;
+    }
+
+    double Profiler::GetFrameTime() const
+    {
+        return m_frameTime;
+    }
+
+    size_t Profiler::GetLostEventCount() const
+    {
+        return m_lostEventCount;
+    }
+
+    void Profiler::BeginCapture()
+    {
+        std::scoped_lock lock(m_drainMutex);
+
+        // Drop the events recorded before the capture
+        m_frameEvents.clear();
+        Drain(m_frameEvents);
+
+        m_captureEvents.clear();
+        m_captureFrames.clear();
+        m_isCapturing = true;
+    }
+
+    bool Profiler::EndCapture(const std::filesystem::path& p_filePath)
+    {
+        std::scoped_lock lock(m_drainMutex);
+
+        if (!m_isCapturing)
+            return false;
+
+        Drain(m_captureEvents);
+        m_captureEvents.resize(std::min(m_captureEvents.size(), MAX_CAPTURE_EVENTS));
+        m_isCapturing = false;
+
+        std::ofstream file(p_filePath);
+
+        if (!file.is_open())
+            return false;
+
+        const auto toMicroseconds = [this](const uint64_t p_ticks)
+        {
+            return Utility::FormatString("%.3f", ToMilliseconds(p_ticks) * 1000.0);
+        };
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        bool isFirst = true;
+
+        const auto beginEvent = [&file, &isFirst]
+        {
+            file << (isFirst ? "\n" : ",\n");
+            isFirst = false;
+        };
+
+        {
+            std::scoped_lock bufferLock(m_bufferMutex);
+
+            for (const std::unique_ptr<ThreadBuffer>& buffer : m_threadBuffers)
+            {
+                beginEvent();
+                file << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << buffer->m_index << R"(,"args":{"name":)";
+                WriteJsonString(file, buffer->m_name.c_str());
+                file << "}}";
+            }
+        }
+
+        for (const ProfileEvent& event : m_captureEvents)
+        {
+            beginEvent();
+            file << R"({"name":)";
+            WriteJsonString(file, event.m_name);
+            file << R"(,"ph":"X","pid":1,"tid":)" << event.m_thread
+                << R"(,"ts":)" << toMicroseconds(event.m_start - m_startTicks)
+                << R"(,"dur":)" << toMicroseconds(event.m_end - event.m_start) << '}';
+        }
+
+        for (const uint64_t frame : m_captureFrames)
+        {
+            beginEvent();
+            file << R"({"name":"Frame","ph":"i","s":"g","pid":1,"tid":0,"ts":)" << toMicroseconds(frame - m_startTicks) << '}';
+        }
+
+        file << "\n]}\n";
+
+        m_captureEvents.clear();
+        m_captureFrames.clear();
+
+        return static_cast<bool>(file);
+    }
+
+    bool Profiler::IsCapturing() const
+    {
+        return m_isCapturing;
+    }
+
+    Profiler& Profiler::GetInstance()
+    {
+        static Profiler instance;
+        return instance;
+    }
+
+    Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+    {
+        thread_local ThreadBuffer* threadBuffer = nullptr;
+
+        if (threadBuffer)
+            return *threadBuffer;
+
+        SV_MEMORY_TAG(Enums::EMemoryTag::PROFILING);
+
+        std::scoped_lock lock(m_bufferMutex);
+
+        std::unique_ptr<ThreadBuffer>& buffer = m_threadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+        buffer->m_index                       = static_cast<uint32_t>(m_threadBuffers.size() - 1);
+        buffer->m_name                        = Utility::FormatString("Thread %u", buffer->m_index);
+
+        threadBuffer = buffer.get();
+        return *threadBuffer;
+    }
+
+    void Profiler::Drain(std::vector<ProfileEvent>& p_out)
+    {
+        std::scoped_lock lock(m_bufferMutex);
+
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_threadBuffers)
+        {
+            const uint64_t head = buffer->m_head.load(std::memory_order_acquire);
+
+            if (head - buffer->m_readIndex > THREAD_BUFFER_CAPACITY)
+            {
+                m_lostEventCount += head - THREAD_BUFFER_CAPACITY - buffer->m_readIndex;
+                buffer->m_readIndex = head - THREAD_BUFFER_CAPACITY;
+            }
+
+            const size_t first = p_out.size();
+
+            for (uint64_t i = buffer->m_readIndex; i < head; ++i)
+                p_out.push_back(buffer->m_events[i % THREAD_BUFFER_CAPACITY]);
+
+            // The owner may have wrapped around while we were copying - drop the events that could be torn
+            const uint64_t newHead = buffer->m_head.load(std::memory_order_acquire);
+
+            if (newHead - buffer->m_readIndex > THREAD_BUFFER_CAPACITY)
+            {
+                const size_t tornCount = std::min<size_t>(newHead - THREAD_BUFFER_CAPACITY - buffer->m_readIndex,
+                                                          head - buffer->m_readIndex);
+
+                p_out.erase(p_out.begin() + static_cast<ptrdiff_t>(first),
+                            p_out.begin() + static_cast<ptrdiff_t>(first + tornCount));
+
+                m_lostEventCount += tornCount;
+            }
+
+            buffer->m_readIndex = head;
+        }
+    }
+
+    void Profiler::Aggregate(std::vector<ProfileEvent>& p_events)
+    {
+        m_frameZones.clear();
+
+        // Parents start before (or with) their children and end after them
+        std::ranges::sort(p_events, [](const ProfileEvent& p_a, const ProfileEvent& p_b)
+        {
+            if (p_a.m_thread != p_b.m_thread)
+                return p_a.m_thread < p_b.m_thread;
+
+            return p_a.m_start != p_b.m_start ? p_a.m_start < p_b.m_start : p_a.m_depth < p_b.m_depth;
+        });
+
+        // Parent zone index + 1 (0 for root zones), name and thread
+        using ZoneKey = std::tuple<size_t, const char*, uint32_t>;
+
+        const Memory::ScratchArena scratch;
+
+        std::pmr::map<ZoneKey, size_t>                zoneIndices(scratch.GetResource());
+        std::pmr::vector<std::pair<uint64_t, size_t>> stack(scratch.GetResource());
+        uint32_t                                      thread = UINT32_MAX;
+
+        for (const ProfileEvent& event : p_events)
+        {
+            if (event.m_thread != thread)
+            {
+                stack.clear();
+                thread = event.m_thread;
+            }
+
+            while (!stack.empty() && stack.back().first <= event.m_start)
+                stack.pop_back();
+
+            const size_t parent = stack.empty() ? 0 : stack.back().second + 1;
+            const auto [it, isNew] = zoneIndices.try_emplace({ parent, event.m_name, thread }, m_frameZones.size());
+
+            if (isNew)
+                m_frameZones.push_back({ event.m_name, thread, static_cast<uint32_t>(stack.size()), 0, 0, 0 });
+
+            const double duration = ToMilliseconds(event.m_end - event.m_start);
+
+            ProfileZoneStats& zone = m_frameZones[it->second];
+            ++zone.m_callCount;
+            zone.m_totalMs += duration;
+            zone.m_selfMs += duration;
+
+            if (parent != 0)
+                m_frameZones[parent - 1].m_selfMs -= duration;
+
+            stack.emplace_back(event.m_end, it->second);
+        }
+    }
+
+    void Profiler::Calibrate()
+    {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_startTime;
+
+        if (elapsed.count() > 0)
+            m_ticksPerMs = static_cast<double>(GetTimestamp() - m_startTicks) / elapsed.count();
+    }
+}
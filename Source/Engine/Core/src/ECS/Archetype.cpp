@@ -0,0 +1,274 @@
+#include "SurvivantCore/ECS/Archetype.h"
+
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/Memory/MemoryTracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+using namespace SvCore::Enums;
+using namespace SvCore::Memory;
+
+namespace SvCore::ECS
+{
+    namespace
+    {
+        size_t AlignUp(const size_t p_value, const size_t p_alignment)
+        {
+            return (p_value + p_alignment - 1) & ~(p_alignment - 1);
+        }
+    }
+
+    Archetype::Archetype(const ComponentMask& p_mask)
+        : m_mask(p_mask)
+    {
+        m_columns.fill(INVALID_COLUMN);
+
+        size_t rowSize = sizeof(Entity);
+
+        for (ComponentId id = 0; id < MAX_COMPONENT_COUNT; ++id)
+        {
+            if (!p_mask.test(id))
+                continue;
+
+            const ComponentInfo* info = GetComponentInfo(id);
+            ASSERT(info, "Archetype uses unregistered component type %u", id);
+            ASSERT(info->m_alignment <= CHUNK_ALIGN, "Component type %u is over-aligned", id);
+
+            m_columns[id] = static_cast<uint32_t>(m_infos.size());
+            m_infos.push_back(info);
+            rowSize += info->m_size;
+        }
+
+        m_offsets.resize(m_infos.size());
+
+        // Alignment padding can make the estimate a few rows too large
+        m_chunkCapacity = std::max<uint32_t>(1, static_cast<uint32_t>(CHUNK_SIZE / rowSize));
+
+        while (m_chunkCapacity > 1 && ComputeLayout(m_chunkCapacity) > CHUNK_SIZE)
+            --m_chunkCapacity;
+
+        // Rows bigger than a chunk get one oversized chunk each
+        m_chunkSize = std::max(CHUNK_SIZE, ComputeLayout(m_chunkCapacity));
+    }
+
+    Archetype::~Archetype()
+    {
+        for (size_t row = 0; row < m_entityCount; ++row)
+            DestroyRow(static_cast<uint32_t>(row));
+
+        for (const Chunk& chunk : m_chunks)
+            MemoryTracker::Free(chunk.m_data);
+    }
+
+    uint32_t Archetype::AddRow(const Entity p_entity)
+    {
+        const size_t chunkIndex = m_entityCount / m_chunkCapacity;
+
+        if (chunkIndex == m_chunks.size())
+        {
+            void* data = MemoryTracker::Allocate(m_chunkSize, CHUNK_ALIGN, EMemoryTag::SCENE);
+
+            if (!data)
+                throw std::bad_alloc();
+
+            m_chunks.push_back({ static_cast<std::byte*>(data), 0 });
+        }
+
+        Chunk& chunk = m_chunks[chunkIndex];
+        new(chunk.m_data + chunk.m_count * sizeof(Entity)) Entity(p_entity);
+        ++chunk.m_count;
+
+        return static_cast<uint32_t>(m_entityCount++);
+    }
+
+    Entity Archetype::RemoveRow(const uint32_t p_row)
+    {
+        DestroyRow(p_row);
+        return FillRow(p_row);
+    }
+
+    uint32_t Archetype::MoveRow(const uint32_t p_row, Archetype& p_destination, Entity& p_movedEntity)
+    {
+        const uint32_t    newRow      = p_destination.AddRow(GetEntity(p_row));
+        const RowLocation source      = Locate(p_row);
+        const RowLocation destination = p_destination.Locate(newRow);
+
+        for (uint32_t column = 0; column < m_infos.size(); ++column)
+        {
+            const ComponentInfo& info       = *m_infos[column];
+            const uint32_t       destColumn = p_destination.GetColumn(info.m_id);
+            void*                component  = GetComponent(source, column);
+
+            if (info.m_isTrivial)
+            {
+                if (destColumn != INVALID_COLUMN)
+                    std::memcpy(p_destination.GetComponent(destination, destColumn), component, info.m_size);
+
+                continue;
+            }
+
+            if (destColumn != INVALID_COLUMN)
+                info.m_move(p_destination.GetComponent(destination, destColumn), component);
+
+            info.m_destroy(component);
+        }
+
+        p_movedEntity = FillRow(p_row);
+        return newRow;
+    }
+
+    const ComponentMask& Archetype::GetMask() const
+    {
+        return m_mask;
+    }
+
+    uint32_t Archetype::GetColumn(const ComponentId p_id) const
+    {
+        return p_id < MAX_COMPONENT_COUNT ? m_columns[p_id] : INVALID_COLUMN;
+    }
+
+    const ComponentInfo& Archetype::GetColumnInfo(const uint32_t p_column) const
+    {
+        return *m_infos[p_column];
+    }
+
+    uint32_t Archetype::GetColumnCount() const
+    {
+        return static_cast<uint32_t>(m_infos.size());
+    }
+
+    void* Archetype::GetComponent(const uint32_t p_row, const uint32_t p_column) const
+    {
+        return GetComponent(Locate(p_row), p_column);
+    }
+
+    Entity Archetype::GetEntity(const uint32_t p_row) const
+    {
+        const RowLocation location = Locate(p_row);
+        return std::launder(reinterpret_cast<const Entity*>(location.m_data))[location.m_index];
+    }
+
+    const std::vector<Archetype::Chunk>& Archetype::GetChunks() const
+    {
+        return m_chunks;
+    }
+
+    const Entity* Archetype::GetEntities(const Chunk& p_chunk) const
+    {
+        return std::launder(reinterpret_cast<const Entity*>(p_chunk.m_data));
+    }
+
+    void* Archetype::GetComponents(const Chunk& p_chunk, const uint32_t p_column) const
+    {
+        return p_chunk.m_data + m_offsets[p_column];
+    }
+
+    uint32_t Archetype::GetChunkCapacity() const
+    {
+        return m_chunkCapacity;
+    }
+
+    size_t Archetype::GetEntityCount() const
+    {
+        return m_entityCount;
+    }
+
+    Archetype* Archetype::GetAddEdge(const ComponentId p_id) const
+    {
+        return m_addEdges[p_id];
+    }
+
+    Archetype* Archetype::GetRemoveEdge(const ComponentId p_id) const
+    {
+        return m_removeEdges[p_id];
+    }
+
+    void Archetype::SetAddEdge(const ComponentId p_id, Archetype* p_archetype)
+    {
+        m_addEdges[p_id] = p_archetype;
+    }
+
+    void Archetype::SetRemoveEdge(const ComponentId p_id, Archetype* p_archetype)
+    {
+        m_removeEdges[p_id] = p_archetype;
+    }
+
+    Archetype::RowLocation Archetype::Locate(const uint32_t p_row) const
+    {
+        return { m_chunks[p_row / m_chunkCapacity].m_data, p_row % m_chunkCapacity };
+    }
+
+    void* Archetype::GetComponent(const RowLocation& p_location, const uint32_t p_column) const
+    {
+        return p_location.m_data + m_offsets[p_column] + p_location.m_index * m_infos[p_column]->m_size;
+    }
+
+    size_t Archetype::ComputeLayout(const uint32_t p_capacity)
+    {
+        size_t size = p_capacity * sizeof(Entity);
+
+        for (size_t column = 0; column < m_infos.size(); ++column)
+        {
+            size              = AlignUp(size, m_infos[column]->m_alignment);
+            m_offsets[column] = size;
+            size += p_capacity * m_infos[column]->m_size;
+        }
+
+        return size;
+    }
+
+    void Archetype::DestroyRow(const uint32_t p_row)
+    {
+        const RowLocation location = Locate(p_row);
+
+        for (uint32_t column = 0; column < m_infos.size(); ++column)
+        {
+            if (!m_infos[column]->m_isTrivial)
+                m_infos[column]->m_destroy(GetComponent(location, column));
+        }
+    }
+
+    Entity Archetype::FillRow(const uint32_t p_row)
+    {
+        const uint32_t lastRow     = static_cast<uint32_t>(m_entityCount - 1);
+        Entity         movedEntity = {};
+
+        if (p_row != lastRow)
+        {
+            const RowLocation hole = Locate(p_row);
+            const RowLocation last = Locate(lastRow);
+
+            for (uint32_t column = 0; column < m_infos.size(); ++column)
+            {
+                const ComponentInfo& info      = *m_infos[column];
+                void*                component = GetComponent(last, column);
+
+                if (info.m_isTrivial)
+                {
+                    std::memcpy(GetComponent(hole, column), component, info.m_size);
+                    continue;
+                }
+
+                info.m_move(GetComponent(hole, column), component);
+                info.m_destroy(component);
+            }
+
+            movedEntity = std::launder(reinterpret_cast<Entity*>(last.m_data))[last.m_index];
+            std::launder(reinterpret_cast<Entity*>(hole.m_data))[hole.m_index] = movedEntity;
+        }
+
+        const size_t lastChunkIndex = lastRow / m_chunkCapacity;
+        --m_entityCount;
+
+        // One empty chunk is kept so rows added and removed around a chunk boundary don't allocate every time
+        if (--m_chunks[lastChunkIndex].m_count == 0 && m_chunks.size() > lastChunkIndex + 1)
+        {
+            MemoryTracker::Free(m_chunks.back().m_data);
+            m_chunks.pop_back();
+        }
+
+        return movedEntity;
+    }
+}
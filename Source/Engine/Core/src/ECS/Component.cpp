@@ -0,0 +1,50 @@
+#include "SurvivantCore/ECS/Component.h"
+
+#include "SurvivantCore/Debug/Assertion.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace SvCore::ECS
+{
+    namespace
+    {
+        struct ComponentRegistry
+        {
+            std::array<ComponentInfo, MAX_COMPONENT_COUNT> m_infos;
+            std::atomic<uint32_t>                          m_count = 0;
+            std::mutex                                     m_mutex;
+        };
+
+        ComponentRegistry& GetRegistry()
+        {
+            // Never destroyed - component infos are referenced until exit by static locals
+            static ComponentRegistry* registry = new ComponentRegistry();
+            return *registry;
+        }
+    }
+
+    const ComponentInfo* GetComponentInfo(const ComponentId p_id)
+    {
+        const ComponentRegistry& registry = GetRegistry();
+        return p_id < registry.m_count.load(std::memory_order_acquire) ? &registry.m_infos[p_id] : nullptr;
+    }
+
+    const ComponentInfo& RegisterComponent(const ComponentInfo& p_info)
+    {
+        ComponentRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        const uint32_t id = registry.m_count.load(std::memory_order_relaxed);
+        ASSERT(id < MAX_COMPONENT_COUNT, "Too many component types - increase MAX_COMPONENT_COUNT");
+
+        ComponentInfo& info = registry.m_infos[id];
+        info      = p_info;
+        info.m_id = id;
+
+        registry.m_count.store(id + 1, std::memory_order_release);
+        return info;
+    }
+}
@@ -0,0 +1,106 @@
+#include "SurvivantCore/ECS/ComponentSerialization.h"
+
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <array>
+#include <memory>
+#include <mutex>
+
+namespace SvCore::ECS
+{
+    namespace
+    {
+        struct SerializationRegistry
+        {
+            std::array<std::unique_ptr<SerializedComponentInfo>, MAX_COMPONENT_COUNT> m_infos;
+            std::mutex                                                                m_mutex;
+        };
+
+        SerializationRegistry& GetRegistry()
+        {
+            // Never destroyed - registered descriptions can be used by scenes saved during static destruction
+            static SerializationRegistry* registry = new SerializationRegistry();
+            return *registry;
+        }
+
+        uint64_t HashLayout(const SerializedComponentInfo& p_info)
+        {
+            std::string layout = std::to_string(p_info.m_size);
+
+            for (const FieldInfo& field : p_info.m_fields)
+            {
+                layout += Utility::FormatString("|%s:%u:%u:%u", field.m_name, field.m_offset, field.m_count,
+                    static_cast<uint32_t>(field.m_type));
+            }
+
+            return Utility::HashString(layout);
+        }
+    }
+
+    const SerializedComponentInfo& RegisterSerializedComponent(SerializedComponentInfo p_info)
+    {
+        SerializationRegistry& registry = GetRegistry();
+
+        p_info.m_typeHash   = Utility::HashString(p_info.m_name);
+        p_info.m_layoutHash = HashLayout(p_info);
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        for (const std::unique_ptr<SerializedComponentInfo>& info : registry.m_infos)
+        {
+            ASSERT(!info || info->m_id == p_info.m_id || info->m_typeHash != p_info.m_typeHash,
+                "Serialized component name \"%s\" is already used", p_info.m_name.c_str());
+        }
+
+        // Registering a type again replaces its description in place, so references to it stay valid
+        std::unique_ptr<SerializedComponentInfo>& info = registry.m_infos[p_info.m_id];
+
+        if (info)
+            *info = std::move(p_info);
+        else
+            info = std::make_unique<SerializedComponentInfo>(std::move(p_info));
+
+        return *info;
+    }
+
+    const SerializedComponentInfo* GetSerializedComponentInfo(const ComponentId p_id)
+    {
+        SerializationRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+        return p_id < MAX_COMPONENT_COUNT ? registry.m_infos[p_id].get() : nullptr;
+    }
+
+    const SerializedComponentInfo* FindSerializedComponentInfo(const uint64_t p_typeHash)
+    {
+        SerializationRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        for (const std::unique_ptr<SerializedComponentInfo>& info : registry.m_infos)
+        {
+            if (info && info->m_typeHash == p_typeHash)
+                return info.get();
+        }
+
+        return nullptr;
+    }
+
+    std::vector<const SerializedComponentInfo*> GetSerializedComponentInfos()
+    {
+        SerializationRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        std::vector<const SerializedComponentInfo*> infos;
+
+        for (const std::unique_ptr<SerializedComponentInfo>& info : registry.m_infos)
+        {
+            if (info)
+                infos.push_back(info.get());
+        }
+
+        return infos;
+    }
+}
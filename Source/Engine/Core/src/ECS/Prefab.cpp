@@ -0,0 +1,109 @@
+#include "SurvivantCore/ECS/Prefab.h"
+
+#include "SurvivantCore/Debug/Assertion.h"
+#include "SurvivantCore/ECS/World.h"
+
+#include <algorithm>
+#include <new>
+
+namespace SvCore::ECS
+{
+    namespace
+    {
+        /**
+         * \brief Copies the given component to a new shared allocation
+         * \param p_info The component's type info
+         * \param p_source The component to copy
+         * \return The copied component, destroyed with its last reference
+         */
+        std::shared_ptr<void> CopyComponent(const ComponentInfo& p_info, const void* p_source)
+        {
+            ASSERT(p_info.m_copy, "Unable to copy components of type %u", p_info.m_id);
+
+            const std::align_val_t alignment = static_cast<std::align_val_t>(p_info.m_alignment);
+            void*                  component = ::operator new(p_info.m_size, alignment);
+
+            try
+            {
+                p_info.m_copy(component, p_source);
+            }
+            catch (...)
+            {
+                ::operator delete(component, alignment);
+                throw;
+            }
+
+            return std::shared_ptr<void>(component, [&p_info, alignment](void* p_component)
+            {
+                p_info.m_destroy(p_component);
+                ::operator delete(p_component, alignment);
+            });
+        }
+    }
+
+    Prefab::Prefab(const World& p_world, const Entity p_entity)
+    {
+        for (ComponentId id = 0; id < MAX_COMPONENT_COUNT; ++id)
+        {
+            const ComponentInfo* info = GetComponentInfo(id);
+
+            if (!info)
+                break;
+
+            if (const void* component = p_world.GetComponent(p_entity, id))
+                SetComponent(id, CopyComponent(*info, component));
+        }
+    }
+
+    size_t Prefab::GetComponentCount() const
+    {
+        return m_ids.size();
+    }
+
+    Entity Prefab::Instantiate(World& p_world) const
+    {
+        return Instantiate(p_world, 1).front();
+    }
+
+    std::vector<Entity> Prefab::Instantiate(World& p_world, const size_t p_count) const
+    {
+        std::vector<const void*> components;
+        components.reserve(m_components.size());
+
+        for (const std::shared_ptr<void>& component : m_components)
+            components.push_back(component.get());
+
+        return p_world.CreateEntitiesFrom(p_count, m_ids, components);
+    }
+
+    void Prefab::SetComponent(const ComponentId p_id, std::shared_ptr<void> p_component)
+    {
+        if (const auto it = std::ranges::find(m_ids, p_id); it != m_ids.end())
+        {
+            m_components[static_cast<size_t>(it - m_ids.begin())] = std::move(p_component);
+            return;
+        }
+
+        m_ids.push_back(p_id);
+        m_components.push_back(std::move(p_component));
+    }
+
+    bool Prefab::RemoveComponent(const ComponentId p_id)
+    {
+        const auto it = std::ranges::find(m_ids, p_id);
+
+        if (it == m_ids.end())
+            return false;
+
+        m_components.erase(m_components.begin() + (it - m_ids.begin()));
+        m_ids.erase(it);
+
+        return true;
+    }
+
+    const void* Prefab::FindComponent(const ComponentId p_id) const
+    {
+        const auto it = std::ranges::find(m_ids, p_id);
+        return it != m_ids.end() ? m_components[static_cast<size_t>(it - m_ids.begin())].get() : nullptr;
+    }
+}
@@ -0,0 +1,518 @@
+#include "SurvivantCore/ECS/SceneFile.h"
+
+#include "SurvivantCore/Debug/Logger.h"
+#include "SurvivantCore/Debug/Profiler.h"
+#include "SurvivantCore/Memory/MemoryTracker.h"
+#include "SurvivantCore/Resources/IResource.h"
+#include "SurvivantCore/Resources/ResourceHandle.h"
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <span>
+
+using namespace SvCore::ECS::SceneFormat;
+using namespace SvCore::Enums;
+
+namespace SvCore::ECS
+{
+    namespace
+    {
+        /**
+         * \brief Appends the given string to the given JSON text as a quoted and escaped JSON string
+         * \param p_json The JSON text
+         * \param p_string The string to append
+         */
+        void AppendJsonString(std::string& p_json, const char* p_string)
+        {
+            p_json += '"';
+
+            for (const char* c = p_string; *c != '\0'; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                    (p_json += '\\') += *c;
+                else if (static_cast<unsigned char>(*c) < 0x20)
+                    p_json += Utility::FormatString("\\u%04x", static_cast<unsigned char>(*c));
+                else
+                    p_json += *c;
+            }
+
+            p_json += '"';
+        }
+
+        /**
+         * \brief Appends the given field value to the given JSON text
+         * \param p_json The JSON text
+         * \param p_type The value's type. Must not be a reference type
+         * \param p_value The value's bytes
+         */
+        void AppendJsonValue(std::string& p_json, const EFieldType p_type, const std::byte* p_value)
+        {
+            switch (p_type)
+            {
+            case EFieldType::BOOL:
+                p_json += *p_value != std::byte{ 0 } ? "true" : "false";
+                break;
+            case EFieldType::INT32:
+            {
+                int32_t value;
+                std::memcpy(&value, p_value, sizeof(value));
+                p_json += std::to_string(value);
+                break;
+            }
+            case EFieldType::UINT32:
+            {
+                uint32_t value;
+                std::memcpy(&value, p_value, sizeof(value));
+                p_json += std::to_string(value);
+                break;
+            }
+            case EFieldType::INT64:
+            {
+                int64_t value;
+                std::memcpy(&value, p_value, sizeof(value));
+                p_json += std::to_string(value);
+                break;
+            }
+            case EFieldType::UINT64:
+            {
+                uint64_t value;
+                std::memcpy(&value, p_value, sizeof(value));
+                p_json += std::to_string(value);
+                break;
+            }
+            case EFieldType::FLOAT:
+            {
+                float value;
+                std::memcpy(&value, p_value, sizeof(value));
+                p_json += std::isfinite(value) ? Utility::FormatString("%.9g", static_cast<double>(value)) : "null";
+                break;
+            }
+            case EFieldType::DOUBLE:
+            {
+                double value;
+                std::memcpy(&value, p_value, sizeof(value));
+                p_json += std::isfinite(value) ? Utility::FormatString("%.17g", value) : "null";
+                break;
+            }
+            case EFieldType::ENTITY:
+            case EFieldType::RESOURCE:
+            default:
+                p_json += "null";
+                break;
+            }
+        }
+    }
+
+    bool SceneFile::Open(const std::string& p_path)
+    {
+        Close();
+
+        if (!m_file.Open(p_path))
+        {
+            SV_LOG_ERROR("Unable to open scene \"%s\" - failed to map file", p_path.c_str());
+            return false;
+        }
+
+        m_header = reinterpret_cast<const Header*>(m_file.GetData());
+
+        if (!Validate())
+        {
+            SV_LOG_ERROR("Unable to open scene \"%s\" - invalid or corrupted file", p_path.c_str());
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void SceneFile::Close()
+    {
+        m_file.Close();
+        m_header = nullptr;
+    }
+
+    bool SceneFile::IsOpen() const
+    {
+        return m_header != nullptr;
+    }
+
+    uint32_t SceneFile::GetEntityCount() const
+    {
+        return m_header ? m_header->m_entityCount : 0;
+    }
+
+    std::vector<Entity> SceneFile::Instantiate(World& p_world)
+    {
+        SV_PROFILE_FUNCTION();
+        SV_MEMORY_TAG(EMemoryTag::SCENE);
+
+        if (!m_header)
+            return {};
+
+        const std::vector<const SerializedComponentInfo*> infos    = GetComponentInfos();
+        const std::vector<Entity>                         entities = p_world.CreateEntities(m_header->m_entityCount);
+
+        // Resources are loaded by their first reference, whose resolved handle is copied to the other ones
+        const Resource*       resources = GetArray(m_header->m_resources);
+        std::vector<uint64_t> resolvedResources(m_header->m_resources.m_count);
+        std::vector<bool>     isResolved(m_header->m_resources.m_count, false);
+
+        const Resources::ResourceHandle<Resources::IResource> invalidHandle;
+
+        for (const Fixup& fixup : std::span(GetArray(m_header->m_fixups), m_header->m_fixups.m_count))
+        {
+            const SerializedComponentInfo* info = infos[fixup.m_componentType];
+
+            if (!info || fixup.m_field >= info->m_fields.size() || info->m_fields[fixup.m_field].m_type != fixup.m_type)
+                continue;
+
+            std::byte* field = m_file.GetData() + fixup.m_offset;
+
+            if (fixup.m_type == EFieldType::ENTITY)
+            {
+                const Entity entity = fixup.m_value != INVALID_INDEX ? entities[fixup.m_value] : Entity();
+                std::memcpy(field, &entity, sizeof(Entity));
+            }
+            else if (fixup.m_resource == INVALID_INDEX)
+            {
+                std::memcpy(field, &invalidHandle, sizeof(invalidHandle));
+            }
+            else if (!isResolved[fixup.m_resource])
+            {
+                info->m_fields[fixup.m_field].m_resource->m_load(GetString(resources[fixup.m_resource].m_path), field);
+                std::memcpy(&resolvedResources[fixup.m_resource], field, sizeof(uint64_t));
+                isResolved[fixup.m_resource] = true;
+            }
+            else
+            {
+                std::memcpy(field, &resolvedResources[fixup.m_resource], sizeof(uint64_t));
+            }
+        }
+
+        std::vector<ComponentId> ids;
+        std::vector<const void*> sources;
+
+        for (const Block& block : std::span(GetArray(m_header->m_blocks), m_header->m_blocks.m_count))
+        {
+            ids.clear();
+            sources.clear();
+
+            for (const Column& column : std::span(GetArray(block.m_columns), block.m_columns.m_count))
+            {
+                if (const SerializedComponentInfo* info = infos[column.m_componentType])
+                {
+                    ids.push_back(info->m_id);
+                    sources.push_back(m_file.GetData() + column.m_data);
+                }
+            }
+
+            if (!ids.empty())
+            {
+                p_world.AddComponents(std::span(entities).subspan(block.m_firstEntity, block.m_entityCount), ids,
+                    sources);
+            }
+        }
+
+        return entities;
+    }
+
+    std::string SceneFile::ExportJson() const
+    {
+        if (!m_header)
+            return {};
+
+        const std::vector<const SerializedComponentInfo*> infos     = GetComponentInfos();
+        const ComponentType*                              types     = GetArray(m_header->m_componentTypes);
+        const Resource*                                   resources = GetArray(m_header->m_resources);
+
+        std::string json = Utility::FormatString("{\n\"version\": %u,\n\"resources\": [", m_header->m_version);
+
+        for (uint64_t i = 0; i < m_header->m_resources.m_count; ++i)
+        {
+            json += Utility::FormatString("%s\n  { \"guid\": \"%016llx\", \"path\": ", i == 0 ? "" : ",",
+                static_cast<unsigned long long>(resources[i].m_guid));
+
+            AppendJsonString(json, GetString(resources[i].m_path));
+            json += " }";
+        }
+
+        json += "\n],\n\"entities\": [";
+
+        for (const Block& block : std::span(GetArray(m_header->m_blocks), m_header->m_blocks.m_count))
+        {
+            const std::span<const Column> columns(GetArray(block.m_columns), block.m_columns.m_count);
+
+            for (uint32_t i = 0; i < block.m_entityCount; ++i)
+            {
+                const uint32_t entity = block.m_firstEntity + i;
+                json += Utility::FormatString("%s\n  { \"id\": %u", entity == 0 ? "" : ",", entity);
+
+                for (const Column& column : columns)
+                {
+                    const ComponentType& type = types[column.m_componentType];
+
+                    json += ", ";
+                    AppendJsonString(json, GetString(type.m_name));
+                    json += ": ";
+
+                    AppendComponentJson(json, infos[column.m_componentType], type,
+                        column.m_data + static_cast<uint64_t>(i) * type.m_size);
+                }
+
+                json += " }";
+            }
+        }
+
+        json += "\n]\n}\n";
+        return json;
+    }
+
+    void SceneFile::AppendComponentJson(std::string& p_json, const SerializedComponentInfo* p_info,
+                                        const ComponentType& p_type, const uint64_t p_offset) const
+    {
+        const std::byte* component = m_file.GetData() + p_offset;
+
+        // Components without a known layout are exported as raw bytes
+        if (!p_info)
+        {
+            p_json += '"';
+
+            for (uint32_t i = 0; i < p_type.m_size; ++i)
+                p_json += Utility::FormatString("%02x", static_cast<unsigned>(component[i]));
+
+            p_json += '"';
+            return;
+        }
+
+        const std::span<const Fixup> fixups(GetArray(m_header->m_fixups), m_header->m_fixups.m_count);
+        const Resource*              resources = GetArray(m_header->m_resources);
+
+        p_json += '{';
+
+        for (size_t fieldIndex = 0; fieldIndex < p_info->m_fields.size(); ++fieldIndex)
+        {
+            const FieldInfo& field = p_info->m_fields[fieldIndex];
+
+            p_json += fieldIndex == 0 ? " " : ", ";
+            AppendJsonString(p_json, field.m_name);
+            p_json += ": ";
+
+            if (field.m_type == EFieldType::ENTITY || field.m_type == EFieldType::RESOURCE)
+            {
+                // Fixed up fields no longer hold their saved value, which is kept in the fixup table
+                const uint64_t fieldOffset = p_offset + field.m_offset;
+                const auto     fixup       = std::ranges::lower_bound(fixups, fieldOffset, {}, &Fixup::m_offset);
+
+                if (fixup == fixups.end() || fixup->m_offset != fieldOffset)
+                    p_json += "null";
+                else if (field.m_type == EFieldType::ENTITY && fixup->m_value != INVALID_INDEX)
+                    p_json += std::to_string(fixup->m_value);
+                else if (field.m_type == EFieldType::RESOURCE && fixup->m_resource != INVALID_INDEX)
+                    AppendJsonString(p_json, GetString(resources[fixup->m_resource].m_path));
+                else
+                    p_json += "null";
+
+                continue;
+            }
+
+            const size_t valueSize = GetFieldTypeSize(field.m_type);
+
+            if (field.m_count == 1)
+            {
+                AppendJsonValue(p_json, field.m_type, component + field.m_offset);
+                continue;
+            }
+
+            p_json += '[';
+
+            for (uint32_t i = 0; i < field.m_count; ++i)
+            {
+                if (i > 0)
+                    p_json += ", ";
+
+                AppendJsonValue(p_json, field.m_type, component + field.m_offset + i * valueSize);
+            }
+
+            p_json += ']';
+        }
+
+        p_json += " }";
+    }
+
+    template <class T>
+    T* SceneFile::GetArray(const Range<T>& p_range) const
+    {
+        return reinterpret_cast<T*>(m_file.GetData() + p_range.m_offset);
+    }
+
+    const char* SceneFile::GetString(const uint32_t p_offset) const
+    {
+        return GetArray(m_header->m_strings) + p_offset;
+    }
+
+    bool SceneFile::Validate() const
+    {
+        const size_t fileSize = m_file.GetSize();
+
+        if (fileSize < sizeof(Header) || m_header->m_magic != MAGIC || m_header->m_version != VERSION
+            || m_header->m_fileSize != fileSize)
+            return false;
+
+        if (!IsValidRange(m_header->m_componentTypes) || !IsValidRange(m_header->m_blocks)
+            || !IsValidRange(m_header->m_resources) || !IsValidRange(m_header->m_fixups)
+            || !IsValidRange(m_header->m_strings))
+            return false;
+
+        // Every string offset is checked against the table, which must end with a terminator
+        const uint64_t stringCount = m_header->m_strings.m_count;
+
+        if (stringCount > 0 && GetArray(m_header->m_strings)[stringCount - 1] != '\0')
+            return false;
+
+        const std::span<const ComponentType> types(GetArray(m_header->m_componentTypes),
+            m_header->m_componentTypes.m_count);
+
+        for (const ComponentType& type : types)
+        {
+            if (type.m_name >= stringCount || type.m_size == 0)
+                return false;
+        }
+
+        for (const Resource& resource : std::span(GetArray(m_header->m_resources), m_header->m_resources.m_count))
+        {
+            if (resource.m_path >= stringCount)
+                return false;
+        }
+
+        const std::span<const Block> blocks(GetArray(m_header->m_blocks), m_header->m_blocks.m_count);
+
+        // Fixups are applied in place, so component data must not overlap any table read during or after patching
+        std::vector<std::pair<uint64_t, uint64_t>> tables = {
+            { 0, sizeof(Header) },
+            GetByteRange(m_header->m_componentTypes),
+            GetByteRange(m_header->m_blocks),
+            GetByteRange(m_header->m_resources),
+            GetByteRange(m_header->m_fixups),
+            GetByteRange(m_header->m_strings)
+        };
+
+        for (const Block& block : blocks)
+        {
+            if (!IsValidRange(block.m_columns))
+                return false;
+
+            tables.push_back(GetByteRange(block.m_columns));
+        }
+
+        // Overlapping tables are merged, so the first table ending after a column's data is the only one to check
+        std::ranges::sort(tables);
+        std::vector<std::pair<uint64_t, uint64_t>> mergedTables;
+
+        for (const auto& [begin, end] : tables)
+        {
+            if (begin == end)
+                continue;
+
+            if (!mergedTables.empty() && begin <= mergedTables.back().second)
+                mergedTables.back().second = std::max(mergedTables.back().second, end);
+            else
+                mergedTables.emplace_back(begin, end);
+        }
+
+        // Columns are saved by increasing data offset, and the sorted fixups are matched to them in a single pass
+        const std::span<const Fixup> fixups(GetArray(m_header->m_fixups), m_header->m_fixups.m_count);
+        size_t                       fixupIndex  = 0;
+        uint64_t                     dataEnd     = 0;
+        uint64_t                     entityCount = 0;
+
+        for (const Block& block : blocks)
+        {
+            if (block.m_firstEntity != entityCount)
+                return false;
+
+            entityCount += block.m_entityCount;
+
+            for (const Column& column : std::span(GetArray(block.m_columns), block.m_columns.m_count))
+            {
+                if (column.m_componentType >= types.size() || column.m_data % DATA_ALIGNMENT != 0
+                    || column.m_data < dataEnd)
+                    return false;
+
+                const uint32_t size     = types[column.m_componentType].m_size;
+                const uint64_t dataSize = static_cast<uint64_t>(block.m_entityCount) * size;
+
+                if (column.m_data > fileSize || dataSize > fileSize - column.m_data)
+                    return false;
+
+                dataEnd = column.m_data + dataSize;
+
+                const auto table = std::ranges::upper_bound(mergedTables, column.m_data, {},
+                    &std::pair<uint64_t, uint64_t>::second);
+
+                if (dataSize > 0 && table != mergedTables.end() && table->first < dataEnd)
+                    return false;
+
+                for (; fixupIndex < fixups.size() && fixups[fixupIndex].m_offset < dataEnd; ++fixupIndex)
+                {
+                    const Fixup& fixup = fixups[fixupIndex];
+
+                    if (fixup.m_offset < column.m_data || fixup.m_offset + sizeof(uint64_t) > dataEnd
+                        || fixup.m_componentType != column.m_componentType
+                        || (fixup.m_type != EFieldType::ENTITY && fixup.m_type != EFieldType::RESOURCE))
+                        return false;
+
+                    if (fixup.m_type == EFieldType::ENTITY && fixup.m_value != INVALID_INDEX
+                        && fixup.m_value >= m_header->m_entityCount)
+                        return false;
+
+                    if (fixup.m_type == EFieldType::RESOURCE && fixup.m_resource != INVALID_INDEX
+                        && fixup.m_resource >= m_header->m_resources.m_count)
+                        return false;
+                }
+            }
+        }
+
+        return entityCount == m_header->m_entityCount && fixupIndex == fixups.size();
+    }
+
+    template <class T>
+    bool SceneFile::IsValidRange(const Range<T>& p_range) const
+    {
+        const size_t fileSize = m_file.GetSize();
+
+        return p_range.m_offset <= fileSize && p_range.m_offset % alignof(T) == 0
+            && p_range.m_count <= (fileSize - p_range.m_offset) / sizeof(T);
+    }
+
+    template <class T>
+    std::pair<uint64_t, uint64_t> SceneFile::GetByteRange(const Range<T>& p_range)
+    {
+        return { p_range.m_offset, p_range.m_offset + p_range.m_count * sizeof(T) };
+    }
+
+    std::vector<const SerializedComponentInfo*> SceneFile::GetComponentInfos() const
+    {
+        const std::span<const ComponentType> types(GetArray(m_header->m_componentTypes),
+            m_header->m_componentTypes.m_count);
+
+        std::vector<const SerializedComponentInfo*> infos;
+        infos.reserve(types.size());
+
+        for (const ComponentType& type : types)
+        {
+            const SerializedComponentInfo* info = FindSerializedComponentInfo(type.m_typeHash);
+
+            if (info && (info->m_layoutHash != type.m_layoutHash || info->m_size != type.m_size))
+            {
+                SV_LOG_WARNING("Scene component \"%s\" was saved with another layout", GetString(type.m_name));
+                info = nullptr;
+            }
+
+            infos.push_back(info);
+        }
+
+        return infos;
+    }
+}
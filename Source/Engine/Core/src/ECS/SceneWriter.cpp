@@ -0,0 +1,313 @@
+#include "SurvivantCore/ECS/SceneWriter.h"
+
+#include "SurvivantCore/Debug/Logger.h"
+#include "SurvivantCore/Debug/Profiler.h"
+#include "SurvivantCore/ECS/ComponentSerialization.h"
+#include "SurvivantCore/ECS/SceneFormat.h"
+#include "SurvivantCore/Memory/MemoryTracker.h"
+#include "SurvivantCore/Utility/FileSystem.h"
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace SvCore::ECS::SceneFormat;
+using namespace SvCore::Enums;
+
+namespace SvCore::ECS
+{
+    namespace
+    {
+        /**
+         * \brief Growing byte buffer the scene file is built in
+         */
+        class SceneBuffer
+        {
+        public:
+            /**
+             * \brief Appends zeroed bytes at the given alignment
+             * \param p_size The number of bytes to append
+             * \param p_alignment The appended bytes' alignment from the start of the buffer
+             * \return The appended bytes' offset
+             */
+            uint64_t Reserve(const size_t p_size, const size_t p_alignment)
+            {
+                const size_t offset = (m_bytes.size() + p_alignment - 1) / p_alignment * p_alignment;
+                m_bytes.resize(offset + p_size);
+                return offset;
+            }
+
+            /**
+             * \brief Copies the given value at the given offset
+             * \tparam T The value's type
+             * \param p_offset The value's offset. Must have been reserved
+             * \param p_value The value to copy
+             */
+            template <class T>
+            void Write(const uint64_t p_offset, const T& p_value)
+            {
+                std::memcpy(m_bytes.data() + p_offset, &p_value, sizeof(T));
+            }
+
+            /**
+             * \brief Gets the bytes at the given offset
+             * \param p_offset The bytes' offset. Must have been reserved
+             * \return A pointer to the bytes, valid until the next reservation
+             */
+            std::byte* GetData(const uint64_t p_offset)
+            {
+                return m_bytes.data() + p_offset;
+            }
+
+            /**
+             * \brief Gets the buffer's content
+             * \return The buffer's bytes
+             */
+            const std::vector<std::byte>& GetBytes() const
+            {
+                return m_bytes;
+            }
+
+        private:
+            std::vector<std::byte> m_bytes;
+        };
+
+        /**
+         * \brief Entities of the saved world having the same serialized components
+         */
+        struct BlockEntities
+        {
+            ComponentMask       m_mask;
+            std::vector<Entity> m_entities;
+        };
+
+        /**
+         * \brief Gets the given resource path relative to the working directory, so scenes can move between machines
+         * \param p_path The resource's normalized path
+         * \return The path to save
+         */
+        std::string GetScenePath(const std::string& p_path)
+        {
+            const std::filesystem::path workingDirectory = Utility::NormalizePath(Utility::GetWorkingDirectory());
+            const std::filesystem::path relativePath     =
+                std::filesystem::path(p_path).lexically_relative(workingDirectory);
+
+            return relativePath.empty() ? p_path : relativePath.generic_string();
+        }
+    }
+
+    bool SaveScene(const World& p_world, const std::string& p_path)
+    {
+        SV_PROFILE_FUNCTION();
+        SV_MEMORY_TAG(EMemoryTag::SCENE);
+
+        const std::vector<const SerializedComponentInfo*> infos    = GetSerializedComponentInfos();
+        const std::vector<Entity>                         entities = p_world.GetEntities();
+
+        // Groups the entities by serialized components, keeping the world's order within each group
+        std::vector<BlockEntities>                 blocks;
+        std::unordered_map<ComponentMask, size_t> blockIndices;
+        ComponentMask                              usedMask;
+
+        for (const Entity entity : entities)
+        {
+            ComponentMask mask;
+
+            for (const SerializedComponentInfo* info : infos)
+            {
+                if (p_world.GetComponent(entity, info->m_id))
+                    mask.set(info->m_id);
+            }
+
+            const auto [it, isNew] = blockIndices.try_emplace(mask, blocks.size());
+
+            if (isNew)
+                blocks.push_back({ mask, {} });
+
+            blocks[it->second].m_entities.push_back(entity);
+            usedMask |= mask;
+        }
+
+        std::vector<uint32_t> sceneIndices(entities.empty() ? 0 : entities.back().m_index + 1, INVALID_INDEX);
+        uint32_t              entityCount = 0;
+
+        for (const BlockEntities& block : blocks)
+        {
+            for (const Entity entity : block.m_entities)
+                sceneIndices[entity.m_index] = entityCount++;
+        }
+
+        SceneBuffer buffer;
+        Header      header;
+
+        const uint64_t headerOffset = buffer.Reserve(sizeof(Header), alignof(Header));
+        header.m_entityCount        = entityCount;
+
+        // Component types, by increasing type id
+        std::vector<uint32_t>                       typeIndices(MAX_COMPONENT_COUNT, INVALID_INDEX);
+        std::vector<const SerializedComponentInfo*> types;
+
+        for (const SerializedComponentInfo* info : infos)
+        {
+            if (usedMask.test(info->m_id))
+            {
+                typeIndices[info->m_id] = static_cast<uint32_t>(types.size());
+                types.push_back(info);
+            }
+        }
+
+        std::string                               strings;
+        std::unordered_map<std::string, uint32_t> stringOffsets;
+
+        auto addString = [&strings, &stringOffsets](const std::string& p_string)
+        {
+            const auto [it, isNew] = stringOffsets.try_emplace(p_string, static_cast<uint32_t>(strings.size()));
+
+            if (isNew)
+                strings.append(p_string).push_back('\0');
+
+            return it->second;
+        };
+
+        header.m_componentTypes = { buffer.Reserve(types.size() * sizeof(ComponentType), alignof(ComponentType)),
+            types.size() };
+
+        for (size_t i = 0; i < types.size(); ++i)
+        {
+            ComponentType type;
+            type.m_typeHash   = types[i]->m_typeHash;
+            type.m_layoutHash = types[i]->m_layoutHash;
+            type.m_size       = types[i]->m_size;
+            type.m_name       = addString(types[i]->m_name);
+
+            buffer.Write(header.m_componentTypes.m_offset + i * sizeof(ComponentType), type);
+        }
+
+        header.m_blocks = { buffer.Reserve(blocks.size() * sizeof(Block), alignof(Block)), blocks.size() };
+
+        std::vector<Resource>                      resources;
+        std::unordered_map<ResourceGuid, uint32_t> resourceIndices;
+        std::vector<Fixup>                         fixups;
+        uint32_t                                   firstEntity = 0;
+
+        for (size_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex)
+        {
+            const BlockEntities& blockEntities = blocks[blockIndex];
+
+            Block block;
+            block.m_firstEntity = firstEntity;
+            block.m_entityCount = static_cast<uint32_t>(blockEntities.m_entities.size());
+            block.m_columns     = { buffer.Reserve(blockEntities.m_mask.count() * sizeof(Column), alignof(Column)),
+                blockEntities.m_mask.count() };
+
+            buffer.Write(header.m_blocks.m_offset + blockIndex * sizeof(Block), block);
+            firstEntity += block.m_entityCount;
+
+            uint64_t columnOffset = block.m_columns.m_offset;
+
+            for (const SerializedComponentInfo* info : types)
+            {
+                if (!blockEntities.m_mask.test(info->m_id))
+                    continue;
+
+                Column column;
+                column.m_componentType = typeIndices[info->m_id];
+                column.m_data          = buffer.Reserve(static_cast<size_t>(block.m_entityCount) * info->m_size,
+                    DATA_ALIGNMENT);
+
+                buffer.Write(columnOffset, column);
+                columnOffset += sizeof(Column);
+
+                for (uint32_t i = 0; i < block.m_entityCount; ++i)
+                {
+                    const Entity   entity          = blockEntities.m_entities[i];
+                    const uint64_t componentOffset = column.m_data + static_cast<uint64_t>(i) * info->m_size;
+                    std::byte*     component       = buffer.GetData(componentOffset);
+
+                    std::memcpy(component, p_world.GetComponent(entity, info->m_id), info->m_size);
+
+                    // References are replaced by their saved values and listed for the loader to fix up
+                    for (uint16_t fieldIndex = 0; fieldIndex < info->m_fields.size(); ++fieldIndex)
+                    {
+                        const FieldInfo& field = info->m_fields[fieldIndex];
+
+                        if (field.m_type != EFieldType::ENTITY && field.m_type != EFieldType::RESOURCE)
+                            continue;
+
+                        Fixup fixup;
+                        fixup.m_offset        = componentOffset + field.m_offset;
+                        fixup.m_componentType = column.m_componentType;
+                        fixup.m_field         = fieldIndex;
+                        fixup.m_type          = field.m_type;
+
+                        if (field.m_type == EFieldType::ENTITY)
+                        {
+                            Entity reference;
+                            std::memcpy(&reference, component + field.m_offset, sizeof(Entity));
+
+                            fixup.m_value = p_world.IsAlive(reference) ?
+                                sceneIndices[reference.m_index] : INVALID_INDEX;
+                        }
+                        else if (const std::string path = field.m_resource->m_getPath(component + field.m_offset);
+                            !path.empty())
+                        {
+                            const std::string  scenePath = GetScenePath(path);
+                            const ResourceGuid guid      = Utility::HashString(scenePath);
+
+                            const auto [it, isNew] = resourceIndices.try_emplace(guid,
+                                static_cast<uint32_t>(resources.size()));
+
+                            if (isNew)
+                                resources.push_back({ guid, addString(scenePath), 0 });
+
+                            fixup.m_value    = guid;
+                            fixup.m_resource = it->second;
+                        }
+
+                        std::memcpy(component + field.m_offset, &fixup.m_value, sizeof(uint64_t));
+                        fixups.push_back(fixup);
+                    }
+                }
+            }
+        }
+
+        header.m_resources = { buffer.Reserve(resources.size() * sizeof(Resource), alignof(Resource)),
+            resources.size() };
+
+        if (!resources.empty())
+        {
+            std::memcpy(buffer.GetData(header.m_resources.m_offset), resources.data(),
+                resources.size() * sizeof(Resource));
+        }
+
+        header.m_fixups = { buffer.Reserve(fixups.size() * sizeof(Fixup), alignof(Fixup)), fixups.size() };
+
+        if (!fixups.empty())
+            std::memcpy(buffer.GetData(header.m_fixups.m_offset), fixups.data(), fixups.size() * sizeof(Fixup));
+
+        header.m_strings = { buffer.Reserve(strings.size(), 1), strings.size() };
+
+        if (!strings.empty())
+            std::memcpy(buffer.GetData(header.m_strings.m_offset), strings.data(), strings.size());
+
+        header.m_fileSize = buffer.GetBytes().size();
+        buffer.Write(headerOffset, header);
+
+        std::ofstream file(p_path, std::ios::binary | std::ios::trunc);
+
+        if (!file)
+        {
+            SV_LOG_ERROR("Unable to save scene to \"%s\" - failed to open file", p_path.c_str());
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(buffer.GetBytes().data()),
+            static_cast<std::streamsize>(buffer.GetBytes().size()));
+
+        return static_cast<bool>(file);
+    }
+}
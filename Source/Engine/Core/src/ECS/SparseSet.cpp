@@ -0,0 +1,95 @@
+#include "SurvivantCore/ECS/SparseSet.h"
+
+namespace SvCore::ECS
+{
+    bool ISparseSet::Contains(const Entity p_entity) const
+    {
+        return GetIndex(p_entity) != INVALID_INDEX;
+    }
+
+    uint32_t ISparseSet::GetIndex(const Entity p_entity) const
+    {
+        const size_t page = p_entity.m_index / PAGE_SIZE;
+
+        if (page >= m_pages.size() || !m_pages[page])
+            return INVALID_INDEX;
+
+        const uint32_t index = (*m_pages[page])[p_entity.m_index % PAGE_SIZE];
+
+        // The packed entity's generation tells apart a recycled index
+        return index != INVALID_INDEX && m_entities[index] == p_entity ? index : INVALID_INDEX;
+    }
+
+    size_t ISparseSet::GetSize() const
+    {
+        return m_entities.size();
+    }
+
+    const Entity* ISparseSet::GetEntities() const
+    {
+        return m_entities.data();
+    }
+
+    uint64_t ISparseSet::GetVersion() const
+    {
+        return m_version;
+    }
+
+    uint32_t ISparseSet::AddEntity(const Entity p_entity)
+    {
+        const uint32_t index = static_cast<uint32_t>(m_entities.size());
+
+        GetSparseEntry(p_entity.m_index) = index;
+        m_entities.push_back(p_entity);
+        ++m_version;
+
+        return index;
+    }
+
+    void ISparseSet::RemoveEntity(const uint32_t p_index)
+    {
+        const Entity removed = m_entities[p_index];
+        const Entity last    = m_entities.back();
+
+        m_entities[p_index]             = last;
+        GetSparseEntry(last.m_index)    = p_index;
+        GetSparseEntry(removed.m_index) = INVALID_INDEX;
+
+        m_entities.pop_back();
+        ++m_version;
+    }
+
+    void ISparseSet::SwapEntities(const uint32_t p_first, const uint32_t p_second)
+    {
+        std::swap(m_entities[p_first], m_entities[p_second]);
+
+        GetSparseEntry(m_entities[p_first].m_index)  = p_first;
+        GetSparseEntry(m_entities[p_second].m_index) = p_second;
+        ++m_version;
+    }
+
+    void ISparseSet::ClearEntities()
+    {
+        for (const Entity entity : m_entities)
+            GetSparseEntry(entity.m_index) = INVALID_INDEX;
+
+        m_entities.clear();
+        ++m_version;
+    }
+
+    uint32_t& ISparseSet::GetSparseEntry(const uint32_t p_index)
+    {
+        const size_t page = p_index / PAGE_SIZE;
+
+        if (page >= m_pages.size())
+            m_pages.resize(page + 1);
+
+        if (!m_pages[page])
+        {
+            m_pages[page] = std::make_unique<Page>();
+            m_pages[page]->fill(INVALID_INDEX);
+        }
+
+        return (*m_pages[page])[p_index % PAGE_SIZE];
+    }
+}
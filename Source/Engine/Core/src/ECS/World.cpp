@@ -0,0 +1,365 @@
+#include "SurvivantCore/ECS/World.h"
+
+#include "SurvivantCore/Threading/JobSystem.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace SvCore::ECS
+{
+    World::World()
+    {
+        m_emptyArchetype = &GetArchetype({});
+    }
+
+    World::~World() = default;
+
+    Entity World::CreateEntity()
+    {
+        const Entity entity = AllocateEntity();
+
+        m_records[entity.m_index].m_archetype = m_emptyArchetype;
+        m_records[entity.m_index].m_row       = m_emptyArchetype->AddRow(entity);
+
+        return entity;
+    }
+
+    std::vector<Entity> World::CreateEntitiesFrom(const size_t p_count, const std::span<const ComponentId> p_ids,
+                                                  const std::span<const void* const> p_components)
+    {
+        ASSERT(p_ids.size() == p_components.size(), "Every component type needs a component to copy");
+
+        std::vector<const ComponentInfo*> infos;
+        infos.reserve(p_ids.size());
+
+        ComponentMask mask;
+        ComponentMask sparseMask;
+
+        for (const ComponentId id : p_ids)
+        {
+            const ComponentInfo* info = GetComponentInfo(id);
+            ASSERT(info && info->m_copy, "Unable to copy components of type %u", id);
+            ASSERT(!mask.test(id) && !sparseMask.test(id), "An entity can't have several components of the same type");
+
+            (info->m_isSparse ? sparseMask : mask).set(id);
+            infos.push_back(info);
+        }
+
+        Archetype&     archetype = GetArchetype(mask);
+        const uint32_t firstRow  = static_cast<uint32_t>(archetype.GetEntityCount());
+
+        std::vector<Entity> entities;
+        entities.reserve(p_count);
+
+        for (size_t i = 0; i < p_count; ++i)
+        {
+            const Entity entity = AllocateEntity();
+
+            m_records[entity.m_index].m_archetype = &archetype;
+            m_records[entity.m_index].m_row       = archetype.AddRow(entity);
+
+            entities.push_back(entity);
+        }
+
+        // The rows were appended to the archetype, so each of the chunks they span can be filled by a separate job
+        const size_t capacity = archetype.GetChunkCapacity();
+        const size_t endRow   = firstRow + p_count;
+
+        if (p_count > 0 && archetype.GetColumnCount() > 0)
+        {
+            Threading::JobSystem::GetInstance().ParallelFor(firstRow / capacity, (endRow - 1) / capacity + 1,
+                [&archetype, &infos, p_components, capacity, firstRow, endRow](const size_t p_chunk)
+                {
+                    const Archetype::Chunk& chunk       = archetype.GetChunks()[p_chunk];
+                    const size_t            chunkRow    = p_chunk * capacity;
+                    const size_t            beginOffset = std::max<size_t>(firstRow, chunkRow) - chunkRow;
+                    const size_t            endOffset   = std::min(endRow, chunkRow + capacity) - chunkRow;
+
+                    for (size_t j = 0; j < infos.size(); ++j)
+                    {
+                        const ComponentInfo& info = *infos[j];
+
+                        if (info.m_isSparse)
+                            continue;
+
+                        std::byte* components = static_cast<std::byte*>(
+                            archetype.GetComponents(chunk, archetype.GetColumn(info.m_id))) + beginOffset * info.m_size;
+
+                        const size_t count = endOffset - beginOffset;
+
+                        if (!info.m_isTrivial)
+                        {
+                            for (size_t i = 0; i < count; ++i)
+                                info.m_copy(components + i * info.m_size, p_components[j]);
+
+                            continue;
+                        }
+
+                        // Trivial components are spread by doubling the copied range, in a few large copies
+                        std::memcpy(components, p_components[j], info.m_size);
+
+                        for (size_t copied = 1; copied < count; copied *= 2)
+                        {
+                            std::memcpy(components + copied * info.m_size, components,
+                                std::min(copied, count - copied) * info.m_size);
+                        }
+                    }
+                });
+        }
+
+        for (size_t j = 0; j < p_ids.size(); ++j)
+        {
+            if (!infos[j]->m_isSparse)
+                continue;
+
+            ISparseSet& set = GetSparseSet(p_ids[j]);
+
+            for (const Entity entity : entities)
+                set.CopyComponent(entity, p_components[j]);
+        }
+
+        return entities;
+    }
+
+    void World::DestroyEntity(const Entity p_entity)
+    {
+        EntityRecord* record = GetRecord(p_entity);
+
+        if (!record)
+            return;
+
+        OnRowMoved(record->m_archetype->RemoveRow(record->m_row), record->m_row);
+
+        for (const std::unique_ptr<ISparseSet>& set : m_sparseSets)
+        {
+            if (set)
+                set->Remove(p_entity);
+        }
+
+        record->m_archetype = nullptr;
+        ++record->m_generation;
+        record->m_nextFree = m_freeHead;
+        m_freeHead         = p_entity.m_index;
+        --m_entityCount;
+    }
+
+    bool World::IsAlive(const Entity p_entity) const
+    {
+        return GetRecord(p_entity) != nullptr;
+    }
+
+    void World::AddComponents(const std::span<const Entity> p_entities, const std::span<const ComponentId> p_ids,
+                              const std::span<const void* const> p_sources)
+    {
+        ASSERT(p_ids.size() == p_sources.size(), "Every added component type needs a source array");
+
+        std::vector<const ComponentInfo*> infos;
+        infos.reserve(p_ids.size());
+
+        ComponentMask addedMask;
+
+        for (const ComponentId id : p_ids)
+        {
+            const ComponentInfo* info = GetComponentInfo(id);
+            ASSERT(info && info->m_copy, "Unable to copy components of type %u", id);
+
+            if (!info->m_isSparse)
+                addedMask.set(id);
+
+            infos.push_back(info);
+        }
+
+        std::vector<uint32_t> columns(p_ids.size(), Archetype::INVALID_COLUMN);
+        Archetype*            source      = nullptr;
+        Archetype*            destination = nullptr;
+
+        for (size_t i = 0; i < p_entities.size(); ++i)
+        {
+            EntityRecord* record = GetRecord(p_entities[i]);
+
+            if (!record)
+                continue;
+
+            // Loaded entities usually come in runs sharing an archetype, so the target is only looked up on change
+            if (record->m_archetype != source)
+            {
+                source = record->m_archetype;
+                ASSERT((source->GetMask() & addedMask).none(), "Entities must not already have the added components");
+
+                destination = &GetArchetype(source->GetMask() | addedMask);
+
+                for (size_t j = 0; j < p_ids.size(); ++j)
+                    columns[j] = destination->GetColumn(p_ids[j]);
+            }
+
+            if (destination != source)
+                MoveEntity(*record, *destination);
+
+            for (size_t j = 0; j < p_ids.size(); ++j)
+            {
+                const ComponentInfo& info      = *infos[j];
+                const void*          component = static_cast<const std::byte*>(p_sources[j]) + i * info.m_size;
+
+                if (info.m_isSparse)
+                {
+                    GetSparseSet(p_ids[j]).CopyComponent(p_entities[i], component);
+                    continue;
+                }
+
+                void* destinationComponent = destination->GetComponent(record->m_row, columns[j]);
+
+                if (info.m_isTrivial)
+                    std::memcpy(destinationComponent, component, info.m_size);
+                else
+                    info.m_copy(destinationComponent, component);
+            }
+        }
+    }
+
+    void* World::GetComponent(const Entity p_entity, const ComponentId p_id) const
+    {
+        const ComponentInfo* info = GetComponentInfo(p_id);
+
+        if (!info)
+            return nullptr;
+
+        if (info->m_isSparse)
+            return m_sparseSets[p_id] ? m_sparseSets[p_id]->FindComponent(p_entity) : nullptr;
+
+        const EntityRecord* record = GetRecord(p_entity);
+
+        if (!record)
+            return nullptr;
+
+        const uint32_t column = record->m_archetype->GetColumn(p_id);
+        return column != Archetype::INVALID_COLUMN ? record->m_archetype->GetComponent(record->m_row, column) : nullptr;
+    }
+
+    std::vector<Entity> World::GetEntities() const
+    {
+        std::vector<Entity> entities;
+        entities.reserve(m_entityCount);
+
+        for (uint32_t i = 0; i < m_records.size(); ++i)
+        {
+            if (m_records[i].m_archetype)
+                entities.push_back({ i, m_records[i].m_generation });
+        }
+
+        return entities;
+    }
+
+    size_t World::GetEntityCount() const
+    {
+        return m_entityCount;
+    }
+
+    size_t World::GetArchetypeCount() const
+    {
+        return m_archetypes.size();
+    }
+
+    World::EntityRecord* World::GetRecord(const Entity p_entity) const
+    {
+        if (p_entity.m_index >= m_records.size())
+            return nullptr;
+
+        const EntityRecord& record = m_records[p_entity.m_index];
+
+        if (!record.m_archetype || record.m_generation != p_entity.m_generation)
+            return nullptr;
+
+        return const_cast<EntityRecord*>(&record);
+    }
+
+    Entity World::AllocateEntity()
+    {
+        ++m_entityCount;
+
+        if (m_freeHead != Entity::INVALID_INDEX)
+        {
+            const uint32_t index = m_freeHead;
+            m_freeHead           = m_records[index].m_nextFree;
+
+            return { index, m_records[index].m_generation };
+        }
+
+        m_records.emplace_back();
+        return { static_cast<uint32_t>(m_records.size() - 1), 0 };
+    }
+
+    ISparseSet& World::GetSparseSet(const ComponentId p_id)
+    {
+        std::unique_ptr<ISparseSet>& set = m_sparseSets[p_id];
+
+        if (!set)
+            set = GetComponentInfo(p_id)->m_createSparseSet();
+
+        return *set;
+    }
+
+    Archetype& World::GetArchetype(const ComponentMask& p_mask)
+    {
+        std::unique_ptr<Archetype>& archetype = m_archetypes[p_mask];
+
+        if (archetype)
+            return *archetype;
+
+        archetype = std::make_unique<Archetype>(p_mask);
+
+        for (const auto& [queryMask, cache] : m_queries)
+        {
+            if ((p_mask & queryMask) == queryMask)
+                cache->m_archetypes.push_back(archetype.get());
+        }
+
+        return *archetype;
+    }
+
+    Archetype& World::GetAddTarget(Archetype& p_source, const ComponentId p_id)
+    {
+        if (Archetype* target = p_source.GetAddEdge(p_id))
+            return *target;
+
+        ComponentMask mask = p_source.GetMask();
+        mask.set(p_id);
+
+        Archetype& target = GetArchetype(mask);
+        p_source.SetAddEdge(p_id, &target);
+        target.SetRemoveEdge(p_id, &p_source);
+
+        return target;
+    }
+
+    Archetype& World::GetRemoveTarget(Archetype& p_source, const ComponentId p_id)
+    {
+        if (Archetype* target = p_source.GetRemoveEdge(p_id))
+            return *target;
+
+        ComponentMask mask = p_source.GetMask();
+        mask.reset(p_id);
+
+        Archetype& target = GetArchetype(mask);
+        p_source.SetRemoveEdge(p_id, &target);
+        target.SetAddEdge(p_id, &p_source);
+
+        return target;
+    }
+
+    void World::MoveEntity(EntityRecord& p_record, Archetype& p_destination)
+    {
+        Entity         movedEntity;
+        const uint32_t oldRow = p_record.m_row;
+
+        p_record.m_row       = p_record.m_archetype->MoveRow(oldRow, p_destination, movedEntity);
+        p_record.m_archetype = &p_destination;
+
+        OnRowMoved(movedEntity, oldRow);
+    }
+
+    void World::OnRowMoved(const Entity p_movedEntity, const uint32_t p_row)
+    {
+        if (p_movedEntity.IsValid())
+            m_records[p_movedEntity.m_index].m_row = p_row;
+    }
+}
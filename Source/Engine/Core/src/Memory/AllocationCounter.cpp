@@ -0,0 +1,100 @@
+#include "SurvivantCore/Memory/AllocationCounter.h"
+
+#include "SurvivantCore/Memory/MemoryTracker.h"
+
+#include <new>
+
+using namespace SvCore::Memory;
+
+namespace
+{
+    void* TrackedAllocate(const size_t p_size, const size_t p_alignment)
+    {
+        void* pointer = MemoryTracker::Allocate(p_size, p_alignment, MemoryTracker::GetCurrentTag());
+
+        if (!pointer)
+            throw std::bad_alloc();
+
+        return pointer;
+    }
+}
+
+// The nothrow forms forward to these by default
+void* operator new(const size_t p_size)
+{
+    return TrackedAllocate(p_size, alignof(std::max_align_t));
+}
+
+void* operator new[](const size_t p_size)
+{
+    return TrackedAllocate(p_size, alignof(std::max_align_t));
+}
+
+void* operator new(const size_t p_size, const std::align_val_t p_alignment)
+{
+    return TrackedAllocate(p_size, static_cast<size_t>(p_alignment));
+}
+
+void* operator new[](const size_t p_size, const std::align_val_t p_alignment)
+{
+    return TrackedAllocate(p_size, static_cast<size_t>(p_alignment));
+}
+
+// Tracked blocks know their own size and alignment
+void operator delete(void* p_pointer) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete[](void* p_pointer) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete(void* p_pointer, size_t) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete[](void* p_pointer, size_t) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete(void* p_pointer, std::align_val_t) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete[](void* p_pointer, std::align_val_t) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete(void* p_pointer, size_t, std::align_val_t) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+void operator delete[](void* p_pointer, size_t, std::align_val_t) noexcept
+{
+    MemoryTracker::Free(p_pointer);
+}
+
+namespace SvCore::Memory
+{
+    size_t AllocationCounter::GetAllocationCount()
+    {
+        return MemoryTracker::GetTotalStats().m_allocationCount;
+    }
+
+    size_t AllocationCounter::GetFreeCount()
+    {
+        return MemoryTracker::GetTotalStats().m_freeCount;
+    }
+
+    size_t AllocationCounter::GetAllocatedBytes()
+    {
+        return MemoryTracker::GetTotalStats().m_allocatedBytes;
+    }
+}
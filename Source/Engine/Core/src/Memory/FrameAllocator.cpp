@@ -0,0 +1,61 @@
+#include "SurvivantCore/Memory/FrameAllocator.h"
+
+#include "SurvivantCore/Memory/AllocationCounter.h"
+
+namespace SvCore::Memory
+{
+    FrameAllocator::FrameAllocator()
+        : m_heapAllocationCount(AllocationCounter::GetAllocationCount()), m_heapFreeCount(AllocationCounter::GetFreeCount())
+    {
+        for (std::unique_ptr<LinearAllocator>& allocator : m_allocators)
+            allocator = std::make_unique<LinearAllocator>(DEFAULT_CAPACITY);
+
+        m_current = m_allocators.front().get();
+    }
+
+    void* FrameAllocator::Allocate(const size_t p_size, const size_t p_alignment)
+    {
+        return m_current.load(std::memory_order_acquire)->Allocate(p_size, p_alignment);
+    }
+
+    std::pmr::memory_resource* FrameAllocator::GetResource()
+    {
+        return m_current.load(std::memory_order_acquire);
+    }
+
+    void FrameAllocator::EndFrame()
+    {
+        const LinearAllocator& frameAllocator = *m_allocators[m_frameIndex % FRAME_COUNT];
+
+        const size_t overflowCount       = frameAllocator.GetOverflowCount();
+        const size_t heapAllocationCount = AllocationCounter::GetAllocationCount();
+        const size_t heapFreeCount       = AllocationCounter::GetFreeCount();
+
+        m_lastFrameStats = {
+            frameAllocator.GetUsedSize(),
+            overflowCount - m_overflowCount,
+            heapAllocationCount - m_heapAllocationCount,
+            heapFreeCount - m_heapFreeCount
+        };
+
+        LinearAllocator& nextAllocator = *m_allocators[++m_frameIndex % FRAME_COUNT];
+        nextAllocator.Reset();
+
+        m_overflowCount       = nextAllocator.GetOverflowCount();
+        m_heapAllocationCount = AllocationCounter::GetAllocationCount();
+        m_heapFreeCount       = AllocationCounter::GetFreeCount();
+
+        m_current.store(&nextAllocator, std::memory_order_release);
+    }
+
+    const FrameMemoryStats& FrameAllocator::GetLastFrameStats() const
+    {
+        return m_lastFrameStats;
+    }
+
+    FrameAllocator& FrameAllocator::GetInstance()
+    {
+        static FrameAllocator instance;
+        return instance;
+    }
+}
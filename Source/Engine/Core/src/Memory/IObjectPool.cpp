@@ -0,0 +1,70 @@
+#include "SurvivantCore/Memory/IObjectPool.h"
+
+#include "SurvivantCore/Debug/Logger.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace SvCore::Memory
+{
+    namespace
+    {
+        struct PoolRegistry
+        {
+            std::vector<const IObjectPool*> m_pools;
+            std::mutex                      m_mutex;
+        };
+
+        PoolRegistry& GetRegistry()
+        {
+            // Never destroyed - pools with a static lifetime can be destroyed after it
+            static PoolRegistry* registry = new PoolRegistry();
+            return *registry;
+        }
+    }
+
+    IObjectPool::IObjectPool()
+    {
+        PoolRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+        registry.m_pools.push_back(this);
+    }
+
+    IObjectPool::~IObjectPool()
+    {
+        PoolRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+        std::erase(registry.m_pools, this);
+    }
+
+    std::vector<PoolStats> IObjectPool::GetAllStats()
+    {
+        PoolRegistry& registry = GetRegistry();
+
+        std::scoped_lock lock(registry.m_mutex);
+
+        std::vector<PoolStats> stats;
+        stats.reserve(registry.m_pools.size());
+
+        for (const IObjectPool* pool : registry.m_pools)
+            stats.push_back(pool->GetStats());
+
+        return stats;
+    }
+
+    void IObjectPool::LogAllStats()
+    {
+        for (const PoolStats& stats : GetAllStats())
+        {
+            const double usage = stats.m_capacity > 0
+                                     ? static_cast<double>(stats.m_liveCount) / static_cast<double>(stats.m_capacity)
+                                     : 0;
+
+            SV_LOG("Pool \"%s\": %zu/%zu objects (peak %zu, %zu created) - %.1f KiB reserved, %.0f%% in use",
+                stats.m_name.c_str(), stats.m_liveCount, stats.m_capacity, stats.m_peakCount, stats.m_createdCount,
+                static_cast<double>(stats.m_reservedBytes) / 1024.0, usage * 100.0);
+        }
+    }
+}
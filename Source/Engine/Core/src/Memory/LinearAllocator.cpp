@@ -0,0 +1,98 @@
+#include "SurvivantCore/Memory/LinearAllocator.h"
+
+#include "SurvivantCore/Debug/Assertion.h"
+
+namespace SvCore::Memory
+{
+    LinearAllocator::LinearAllocator(const size_t p_capacity, std::pmr::memory_resource* p_upstream)
+        : m_buffer(std::make_unique<std::byte[]>(p_capacity)), m_capacity(p_capacity), m_upstream(p_upstream)
+    {
+    }
+
+    LinearAllocator::~LinearAllocator()
+    {
+        Reset();
+    }
+
+    void* LinearAllocator::Allocate(const size_t p_size, const size_t p_alignment)
+    {
+        ASSERT(p_alignment > 0 && (p_alignment & (p_alignment - 1)) == 0, "Alignment must be a power of two");
+
+        const auto base   = reinterpret_cast<uintptr_t>(m_buffer.get());
+        size_t     offset = m_offset.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            const uintptr_t address = (base + offset + p_alignment - 1) & ~(p_alignment - 1);
+            const size_t    end     = address - base + p_size;
+
+            if (end > m_capacity)
+                break;
+
+            if (m_offset.compare_exchange_weak(offset, end, std::memory_order_relaxed))
+                return reinterpret_cast<void*>(address);
+        }
+
+        void* pointer = m_upstream->allocate(p_size, p_alignment);
+
+        std::scoped_lock lock(m_overflowMutex);
+        m_overflowBlocks.push_back({ pointer, p_size, p_alignment });
+        ++m_overflowCount;
+
+        return pointer;
+    }
+
+    LinearAllocator::Marker LinearAllocator::GetMarker() const
+    {
+        std::scoped_lock lock(m_overflowMutex);
+        return { m_offset.load(std::memory_order_relaxed), m_overflowBlocks.size() };
+    }
+
+    void LinearAllocator::Rewind(const Marker& p_marker)
+    {
+        std::scoped_lock lock(m_overflowMutex);
+
+        while (m_overflowBlocks.size() > p_marker.m_overflowBlockCount)
+        {
+            const OverflowBlock& block = m_overflowBlocks.back();
+            m_upstream->deallocate(block.m_pointer, block.m_size, block.m_alignment);
+            m_overflowBlocks.pop_back();
+        }
+
+        m_offset.store(p_marker.m_offset, std::memory_order_relaxed);
+    }
+
+    void LinearAllocator::Reset()
+    {
+        Rewind({ 0, 0 });
+    }
+
+    size_t LinearAllocator::GetUsedSize() const
+    {
+        return m_offset.load(std::memory_order_relaxed);
+    }
+
+    size_t LinearAllocator::GetCapacity() const
+    {
+        return m_capacity;
+    }
+
+    size_t LinearAllocator::GetOverflowCount() const
+    {
+        return m_overflowCount.load(std::memory_order_relaxed);
+    }
+
+    void* LinearAllocator::do_allocate(const size_t p_bytes, const size_t p_alignment)
+    {
+        return Allocate(p_bytes, p_alignment);
+    }
+
+    void LinearAllocator::do_deallocate(void*, size_t, size_t)
+    {
+    }
+
+    bool LinearAllocator::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept
+    {
+        return this == &p_other;
+    }
+}
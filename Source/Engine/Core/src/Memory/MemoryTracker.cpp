@@ -0,0 +1,491 @@
+#include "SurvivantCore/Memory/MemoryTracker.h"
+
+#include "SurvivantCore/Debug/Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+
+#ifdef SV_TRACK_ALLOCATION_SITES
+#ifdef _WIN32
+#include "SurvivantCore/Utility/LeanWindows.h"
+#else
+#include <execinfo.h>
+#endif // _WIN32
+#endif // SV_TRACK_ALLOCATION_SITES
+
+using namespace SvCore::Enums;
+
+namespace SvCore::Memory
+{
+    namespace
+    {
+        constexpr size_t   HEADER_SIZE = 16;
+        constexpr uint32_t NO_SITE     = UINT32_MAX;
+
+        /**
+         * \brief Stored right before each tracked block
+         */
+        struct alignas(HEADER_SIZE) BlockHeader
+        {
+            size_t     m_size;
+            uint32_t   m_site;
+            uint8_t    m_alignmentShift;
+            EMemoryTag m_tag;
+        };
+
+        static_assert(sizeof(BlockHeader) == HEADER_SIZE);
+
+        struct TagCounters
+        {
+            std::atomic<size_t> m_liveBytes;
+            std::atomic<size_t> m_peakBytes;
+            std::atomic<size_t> m_allocatedBytes;
+            std::atomic<size_t> m_allocationCount;
+            std::atomic<size_t> m_freeCount;
+        };
+
+        // Constant-initialized so allocations made before main are tracked
+        TagCounters g_tagCounters[MEMORY_TAG_COUNT];
+        TagCounters g_totalCounters;
+
+        struct TrackerState
+        {
+            std::array<size_t, MEMORY_TAG_COUNT> m_budgets{};
+            std::array<bool, MEMORY_TAG_COUNT>   m_isOverBudget{};
+            std::vector<MemorySnapshot>          m_snapshots;
+            size_t                               m_nextSnapshot = 0;
+            uint64_t                             m_frame        = 0;
+            std::mutex                           m_mutex;
+        };
+
+        TrackerState& GetState()
+        {
+            // Never destroyed - allocations can still be freed while static objects are destroyed
+            static TrackerState* state = new TrackerState();
+            return *state;
+        }
+
+        void AddBytes(TagCounters& p_counters, const size_t p_size)
+        {
+            const size_t liveBytes = p_counters.m_liveBytes.fetch_add(p_size, std::memory_order_relaxed) + p_size;
+            size_t       peakBytes = p_counters.m_peakBytes.load(std::memory_order_relaxed);
+
+            while (liveBytes > peakBytes
+                && !p_counters.m_peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+            {
+            }
+
+            p_counters.m_allocatedBytes.fetch_add(p_size, std::memory_order_relaxed);
+            p_counters.m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void RemoveBytes(TagCounters& p_counters, const size_t p_size)
+        {
+            p_counters.m_liveBytes.fetch_sub(p_size, std::memory_order_relaxed);
+            p_counters.m_freeCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        MemoryTagStats ReadCounters(const TagCounters& p_counters)
+        {
+            return {
+                p_counters.m_liveBytes.load(std::memory_order_relaxed),
+                p_counters.m_peakBytes.load(std::memory_order_relaxed),
+                p_counters.m_allocatedBytes.load(std::memory_order_relaxed),
+                p_counters.m_allocationCount.load(std::memory_order_relaxed),
+                p_counters.m_freeCount.load(std::memory_order_relaxed)
+            };
+        }
+
+        double ToMiB(const size_t p_bytes)
+        {
+            return static_cast<double>(p_bytes) / (1024.0 * 1024.0);
+        }
+
+#ifdef SV_TRACK_ALLOCATION_SITES
+        constexpr size_t SITE_CAPACITY  = 4096;
+        constexpr int    SKIPPED_FRAMES = 3; // CaptureSite, MemoryTracker::Allocate and operator new
+
+        struct SiteEntry
+        {
+            uint64_t       m_hash;
+            AllocationSite m_site;
+        };
+
+        // Fixed-size so that tracking a site never allocates
+        SiteEntry  g_sites[SITE_CAPACITY];
+        std::mutex g_siteMutex;
+
+        thread_local bool t_isCapturingSite = false;
+
+        uint32_t CaptureSite(const size_t p_size)
+        {
+            // The stack walk can allocate the first time it is used
+            if (t_isCapturingSite)
+                return NO_SITE;
+
+            t_isCapturingSite = true;
+
+            void* frames[SKIPPED_FRAMES + AllocationSite::MAX_DEPTH]{};
+
+#ifdef _WIN32
+            const int frameCount = CaptureStackBackTrace(0, static_cast<DWORD>(std::size(frames)), frames, nullptr);
+#else
+            const int frameCount = backtrace(frames, static_cast<int>(std::size(frames)));
+#endif // _WIN32
+
+            t_isCapturingSite = false;
+
+            if (frameCount <= SKIPPED_FRAMES)
+                return NO_SITE;
+
+            // FNV-1a over the caller frames - 0 marks empty entries
+            uint64_t hash = 14695981039346656037ull;
+
+            for (int i = SKIPPED_FRAMES; i < frameCount; ++i)
+                hash = (hash ^ reinterpret_cast<uintptr_t>(frames[i])) * 1099511628211ull;
+
+            hash = hash != 0 ? hash : 1;
+
+            std::scoped_lock lock(g_siteMutex);
+
+            for (size_t probe = 0; probe < SITE_CAPACITY; ++probe)
+            {
+                const size_t index = (hash + probe) % SITE_CAPACITY;
+                SiteEntry&   entry = g_sites[index];
+
+                if (entry.m_hash == 0)
+                {
+                    entry.m_hash = hash;
+                    std::copy(frames + SKIPPED_FRAMES, frames + frameCount, entry.m_site.m_frames.begin());
+                }
+                else if (entry.m_hash != hash)
+                {
+                    continue;
+                }
+
+                entry.m_site.m_liveBytes += p_size;
+                ++entry.m_site.m_allocationCount;
+
+                return static_cast<uint32_t>(index);
+            }
+
+            return NO_SITE;
+        }
+
+        void ReleaseSite(const uint32_t p_site, const size_t p_size)
+        {
+            if (p_site == NO_SITE)
+                return;
+
+            std::scoped_lock lock(g_siteMutex);
+            g_sites[p_site].m_site.m_liveBytes -= p_size;
+        }
+#else
+        uint32_t CaptureSite(size_t)
+        {
+            return NO_SITE;
+        }
+
+        void ReleaseSite(uint32_t, size_t)
+        {
+        }
+#endif // SV_TRACK_ALLOCATION_SITES
+    }
+
+    thread_local EMemoryTag MemoryTracker::s_currentTag = EMemoryTag::UNTAGGED;
+
+    MemoryTagScope::MemoryTagScope(const EMemoryTag p_tag)
+        : m_previousTag(MemoryTracker::s_currentTag)
+    {
+        MemoryTracker::s_currentTag = p_tag;
+    }
+
+    MemoryTagScope::~MemoryTagScope()
+    {
+        MemoryTracker::s_currentTag = m_previousTag;
+    }
+
+    void* MemoryTracker::Allocate(const size_t p_size, const size_t p_alignment, const EMemoryTag p_tag)
+    {
+        // The header sits right before the block, which starts one alignment past the allocated base
+        const size_t alignment = std::max(p_alignment, HEADER_SIZE);
+
+        char* base;
+
+        if (alignment > HEADER_SIZE)
+        {
+#ifdef _MSC_VER
+            base = static_cast<char*>(_aligned_malloc(p_size + alignment, alignment));
+#else
+            // aligned_alloc requires the size to be a multiple of the alignment
+            base = static_cast<char*>(std::aligned_alloc(alignment, (p_size + 2 * alignment - 1) & ~(alignment - 1)));
+#endif
+        }
+        else
+        {
+            base = static_cast<char*>(std::malloc(p_size + HEADER_SIZE));
+        }
+
+        if (!base)
+            return nullptr;
+
+        char*        block  = base + alignment;
+        BlockHeader* header = reinterpret_cast<BlockHeader*>(block) - 1;
+
+        header->m_size           = p_size;
+        header->m_site           = CaptureSite(p_size);
+        header->m_alignmentShift = static_cast<uint8_t>(std::countr_zero(alignment));
+        header->m_tag            = p_tag;
+
+        AddBytes(g_tagCounters[static_cast<size_t>(p_tag)], p_size);
+        AddBytes(g_totalCounters, p_size);
+
+        return block;
+    }
+
+    void* MemoryTracker::Reallocate(void* p_pointer, const size_t p_size)
+    {
+        if (!p_pointer)
+            return Allocate(p_size);
+
+        const BlockHeader& header = *(static_cast<BlockHeader*>(p_pointer) - 1);
+
+        void* block = Allocate(p_size, size_t{ 1 } << header.m_alignmentShift, header.m_tag);
+
+        if (!block)
+            return nullptr;
+
+        std::memcpy(block, p_pointer, std::min(p_size, header.m_size));
+        Free(p_pointer);
+
+        return block;
+    }
+
+    void MemoryTracker::Free(void* p_pointer)
+    {
+        if (!p_pointer)
+            return;
+
+        const BlockHeader header    = *(static_cast<BlockHeader*>(p_pointer) - 1);
+        const size_t      alignment = size_t{ 1 } << header.m_alignmentShift;
+
+        RemoveBytes(g_tagCounters[static_cast<size_t>(header.m_tag)], header.m_size);
+        RemoveBytes(g_totalCounters, header.m_size);
+        ReleaseSite(header.m_site, header.m_size);
+
+        char* base = static_cast<char*>(p_pointer) - alignment;
+
+#ifdef _MSC_VER
+        if (alignment > HEADER_SIZE)
+        {
+            _aligned_free(base);
+            return;
+        }
+#endif
+
+        std::free(base);
+    }
+
+    EMemoryTag MemoryTracker::GetCurrentTag()
+    {
+        return s_currentTag;
+    }
+
+    MemoryTagStats MemoryTracker::GetTagStats(const EMemoryTag p_tag)
+    {
+        return ReadCounters(g_tagCounters[static_cast<size_t>(p_tag)]);
+    }
+
+    MemoryTagStats MemoryTracker::GetTotalStats()
+    {
+        return ReadCounters(g_totalCounters);
+    }
+
+    void MemoryTracker::SetBudget(const EMemoryTag p_tag, const size_t p_bytes)
+    {
+        TrackerState& state = GetState();
+
+        std::scoped_lock lock(state.m_mutex);
+        state.m_budgets[static_cast<size_t>(p_tag)]      = p_bytes;
+        state.m_isOverBudget[static_cast<size_t>(p_tag)] = false;
+    }
+
+    void MemoryTracker::EndFrame()
+    {
+        TrackerState& state = GetState();
+
+        std::scoped_lock lock(state.m_mutex);
+
+        MemorySnapshot snapshot;
+        snapshot.m_frame = state.m_frame++;
+        snapshot.m_total = GetTotalStats();
+
+        for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+        {
+            const EMemoryTag tag = static_cast<EMemoryTag>(i);
+            snapshot.m_tags[i]   = GetTagStats(tag);
+
+            const size_t budget = state.m_budgets[i];
+
+            if (budget == 0)
+                continue;
+
+            // Warn once per overrun instead of every frame
+            const bool isOverBudget = snapshot.m_tags[i].m_liveBytes > budget;
+
+            if (isOverBudget && !state.m_isOverBudget[i])
+            {
+                SV_LOG_WARNING("Memory tag \"%s\" is over budget: %.2f MiB used of %.2f MiB", GetTagName(tag),
+                    ToMiB(snapshot.m_tags[i].m_liveBytes), ToMiB(budget));
+            }
+
+            state.m_isOverBudget[i] = isOverBudget;
+        }
+
+        if (state.m_snapshots.size() < SNAPSHOT_COUNT)
+            state.m_snapshots.push_back(snapshot);
+        else
+            state.m_snapshots[state.m_nextSnapshot] = snapshot;
+
+        state.m_nextSnapshot = (state.m_nextSnapshot + 1) % SNAPSHOT_COUNT;
+    }
+
+    std::vector<MemorySnapshot> MemoryTracker::GetSnapshots()
+    {
+        TrackerState& state = GetState();
+
+        std::scoped_lock lock(state.m_mutex);
+
+        std::vector<MemorySnapshot> snapshots = state.m_snapshots;
+
+        if (snapshots.size() == SNAPSHOT_COUNT)
+            std::ranges::rotate(snapshots, snapshots.begin() + static_cast<ptrdiff_t>(state.m_nextSnapshot));
+
+        return snapshots;
+    }
+
+    std::vector<AllocationSite> MemoryTracker::GetTopSites([[maybe_unused]] const size_t p_count)
+    {
+        std::vector<AllocationSite> sites;
+
+#ifdef SV_TRACK_ALLOCATION_SITES
+        // Reserved before locking - growing the vector would deadlock on the site lock
+        sites.reserve(SITE_CAPACITY);
+
+        {
+            std::scoped_lock lock(g_siteMutex);
+
+            for (const SiteEntry& entry : g_sites)
+            {
+                if (entry.m_hash != 0 && entry.m_site.m_liveBytes > 0)
+                    sites.push_back(entry.m_site);
+            }
+        }
+
+        const size_t count = std::min(p_count, sites.size());
+
+        std::ranges::partial_sort(sites, sites.begin() + static_cast<ptrdiff_t>(count),
+            [](const AllocationSite& p_a, const AllocationSite& p_b)
+            {
+                return p_a.m_liveBytes > p_b.m_liveBytes;
+            });
+
+        sites.resize(count);
+#endif // SV_TRACK_ALLOCATION_SITES
+
+        return sites;
+    }
+
+    void MemoryTracker::LogReport()
+    {
+        const MemoryTagStats total = GetTotalStats();
+
+        SV_LOG("Heap: %.2f MiB live (peak %.2f MiB) - %zu allocations, %zu frees", ToMiB(total.m_liveBytes),
+            ToMiB(total.m_peakBytes), total.m_allocationCount, total.m_freeCount);
+
+        std::array<size_t, MEMORY_TAG_COUNT> budgets;
+
+        {
+            TrackerState& state = GetState();
+
+            std::scoped_lock lock(state.m_mutex);
+            budgets = state.m_budgets;
+        }
+
+        for (size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+        {
+            const EMemoryTag     tag   = static_cast<EMemoryTag>(i);
+            const MemoryTagStats stats = GetTagStats(tag);
+
+            if (stats.m_allocationCount == 0)
+                continue;
+
+            if (budgets[i] > 0)
+            {
+                SV_LOG("  %-10s %8.2f MiB live (peak %.2f MiB, budget %.2f MiB) - %zu allocations, %zu frees",
+                    GetTagName(tag), ToMiB(stats.m_liveBytes), ToMiB(stats.m_peakBytes), ToMiB(budgets[i]),
+                    stats.m_allocationCount, stats.m_freeCount);
+            }
+            else
+            {
+                SV_LOG("  %-10s %8.2f MiB live (peak %.2f MiB) - %zu allocations, %zu frees", GetTagName(tag),
+                    ToMiB(stats.m_liveBytes), ToMiB(stats.m_peakBytes), stats.m_allocationCount, stats.m_freeCount);
+            }
+        }
+
+#ifdef SV_TRACK_ALLOCATION_SITES
+        for (const AllocationSite& site : GetTopSites(10))
+        {
+            SV_LOG("Site holding %.2f MiB (%zu allocations):", ToMiB(site.m_liveBytes), site.m_allocationCount);
+
+            const size_t depth = static_cast<size_t>(std::ranges::find(site.m_frames, nullptr) - site.m_frames.begin());
+
+#ifdef _WIN32
+            for (size_t i = 0; i < depth; ++i)
+                SV_LOG("    %p", site.m_frames[i]);
+#else
+            char** symbols = backtrace_symbols(site.m_frames.data(), static_cast<int>(depth));
+
+            for (size_t i = 0; i < depth; ++i)
+                SV_LOG("    %s", symbols ? symbols[i] : "?");
+
+            std::free(symbols);
+#endif // _WIN32
+        }
+#endif // SV_TRACK_ALLOCATION_SITES
+    }
+
+    const char* MemoryTracker::GetTagName(const EMemoryTag p_tag)
+    {
+        switch (p_tag)
+        {
+        case EMemoryTag::UNTAGGED:
+            return "Untagged";
+        case EMemoryTag::CORE:
+            return "Core";
+        case EMemoryTag::RESOURCES:
+            return "Resources";
+        case EMemoryTag::TEXTURES:
+            return "Textures";
+        case EMemoryTag::MESHES:
+            return "Meshes";
+        case EMemoryTag::SHADERS:
+            return "Shaders";
+        case EMemoryTag::RENDERING:
+            return "Rendering";
+        case EMemoryTag::PROFILING:
+            return "Profiling";
+        case EMemoryTag::LOGGING:
+            return "Logging";
+        case EMemoryTag::SCENE:
+            return "Scene";
+        default:
+            return "Unknown";
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#include "SurvivantCore/Memory/ScratchArena.h"
+
+namespace SvCore::Memory
+{
+    ScratchArena::ScratchArena()
+        : m_allocator(GetThreadAllocator()), m_marker(m_allocator.GetMarker())
+    {
+    }
+
+    ScratchArena::~ScratchArena()
+    {
+        m_allocator.Rewind(m_marker);
+    }
+
+    void* ScratchArena::Allocate(const size_t p_size, const size_t p_alignment)
+    {
+        return m_allocator.Allocate(p_size, p_alignment);
+    }
+
+    std::pmr::memory_resource* ScratchArena::GetResource() const
+    {
+        return &m_allocator;
+    }
+
+    LinearAllocator& ScratchArena::GetThreadAllocator()
+    {
+        thread_local LinearAllocator allocator(THREAD_CAPACITY);
+        return allocator;
+    }
+}
@@ -0,0 +1,381 @@
+#include "SurvivantCore/Resources/ResourceLoader.h"
+
+#include "SurvivantCore/Debug/Logger.h"
+#include "SurvivantCore/Debug/Profiler.h"
+#include "SurvivantCore/Utility/FileSystem.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+
+using namespace SvCore::Enums;
+
+namespace SvCore::Resources
+{
+    ResourceLoader::ResourceLoader(ResourceManager& p_manager, Threading::JobSystem& p_jobSystem)
+        : m_manager(p_manager), m_jobSystem(p_jobSystem)
+    {
+    }
+
+    ResourceLoader::~ResourceLoader()
+    {
+        m_jobSystem.Wait(m_loadJobs);
+    }
+
+    size_t ResourceLoader::Update(const float p_timeBudget)
+    {
+        SV_PROFILE_FUNCTION();
+
+        using clock = std::chrono::steady_clock;
+
+        const clock::time_point start = clock::now();
+
+        std::unique_lock lock(m_mutex);
+
+        size_t completed  = 0;
+        bool   progressed = true;
+
+        // Initializing a request can unblock requests that depend on it so keep going until nothing moves
+        while (progressed)
+        {
+            progressed = false;
+
+            for (size_t i = 0; i < m_initQueue.size();)
+            {
+                const LoadTicket ticket  = m_initQueue[i];
+                Request&         request = m_requests.at(ticket);
+
+                bool hasFailedDependency = false;
+
+                if (!request.m_hasLoadedDependencies)
+                {
+                    request.m_hasLoadedDependencies = true;
+
+                    // Requesting dependencies enqueues requests, which takes the lock. Workers only append to the queue
+                    lock.unlock();
+                    const std::vector<LoadTicket> dependencies = request.m_resource->LoadDependencies(*this);
+                    lock.lock();
+
+                    // A dependency waiting on the request itself would never be ready
+                    hasFailedDependency = !AddDependencies(ticket, dependencies);
+                }
+
+                if (!hasFailedDependency && !AreDependenciesDone(request, hasFailedDependency))
+                {
+                    ++i;
+                    continue;
+                }
+
+                m_initQueue.erase(m_initQueue.begin() + static_cast<std::ptrdiff_t>(i));
+
+                if (hasFailedDependency)
+                {
+                    SV_LOG_ERROR("Unable to initialize resource \"%s\" - a dependency failed to load", request.m_path.c_str());
+                    Complete(request, ELoadState::FAILED);
+                }
+                else
+                {
+                    // Workers never touch a loaded request so Init can run without holding the lock
+                    lock.unlock();
+                    const bool isInitialized = request.m_resource->Init();
+                    lock.lock();
+
+                    if (isInitialized)
+                    {
+                        Register(request);
+                    }
+                    else
+                    {
+                        SV_LOG_ERROR("Unable to initialize resource \"%s\"", request.m_path.c_str());
+                        Complete(request, ELoadState::FAILED);
+                    }
+                }
+
+                ++completed;
+                progressed = true;
+
+                if (std::chrono::duration<float>(clock::now() - start).count() >= p_timeBudget)
+                    return completed;
+            }
+        }
+
+        return completed;
+    }
+
+    void ResourceLoader::Flush()
+    {
+        std::unique_lock lock(m_mutex);
+
+        while (m_pendingCount > 0)
+        {
+            const uint64_t loadedCount = m_loadedCount;
+
+            lock.unlock();
+            Update(FLT_MAX);
+            lock.lock();
+
+            // Whatever is left is either loading or waiting on something that is
+            m_loadedCondition.wait(lock, [this, loadedCount]
+            {
+                return m_pendingCount == 0 || m_loadedCount != loadedCount;
+            });
+        }
+    }
+
+    ELoadState ResourceLoader::GetState(const LoadTicket p_ticket) const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        const auto it = m_requests.find(p_ticket);
+        return it == m_requests.end() ? ELoadState::INVALID : it->second.m_state;
+    }
+
+    size_t ResourceLoader::GetPendingCount() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_pendingCount;
+    }
+
+    void ResourceLoader::ClearCompleted()
+    {
+        std::scoped_lock lock(m_mutex);
+
+        std::erase_if(m_requests, [this](const auto& p_pair)
+        {
+            // Dependents may still be waiting on the cleared requests, so remember which of them failed
+            if (p_pair.second.m_state == ELoadState::FAILED)
+                m_clearedFailures.insert(p_pair.first);
+
+            return p_pair.second.m_state == ELoadState::READY || p_pair.second.m_state == ELoadState::FAILED;
+        });
+    }
+
+    LoadTicket ResourceLoader::Enqueue(const std::string& p_path, const std::type_info& p_type,
+                                       std::unique_ptr<IResource> p_resource, const std::vector<LoadTicket>& p_dependencies)
+    {
+        std::string normalizedPath = Utility::NormalizePath(p_path);
+
+        std::unique_lock lock(m_mutex);
+
+        if (const auto it = m_pendingPaths.find(normalizedPath); it != m_pendingPaths.end())
+        {
+            Request& pending = m_requests.at(it->second);
+
+            if (*pending.m_type == p_type)
+            {
+                if (AddDependencies(it->second, p_dependencies))
+                {
+                    ++pending.m_requestCount;
+                    return it->second;
+                }
+
+                SV_LOG_ERROR("Unable to load resource \"%s\" - the request would depend on itself", p_path.c_str());
+
+                const LoadTicket ticket  = m_nextTicket++;
+                Request&         request = m_requests[ticket];
+
+                request.m_path           = p_path;
+                request.m_normalizedPath = std::move(normalizedPath);
+                request.m_type           = &p_type;
+                request.m_state          = ELoadState::FAILED;
+
+                return ticket;
+            }
+        }
+
+        const bool hasTypeConflict = m_pendingPaths.contains(normalizedPath)
+            || (m_manager.m_lookup.contains(normalizedPath) && m_manager.FindSlot(normalizedPath, p_type)
+                == ResourceHandle<IResource>::INVALID_INDEX);
+
+        const LoadTicket ticket  = m_nextTicket++;
+        Request&         request = m_requests[ticket];
+
+        request.m_path           = p_path;
+        request.m_normalizedPath = std::move(normalizedPath);
+        request.m_type           = &p_type;
+        request.m_dependencies   = p_dependencies;
+
+        if (hasTypeConflict)
+        {
+            SV_LOG_ERROR("Unable to load resource \"%s\" - already requested with a different type", p_path.c_str());
+            request.m_state = ELoadState::FAILED;
+            return ticket;
+        }
+
+        if (const uint32_t index = m_manager.FindSlot(request.m_normalizedPath, p_type);
+            index != ResourceHandle<IResource>::INVALID_INDEX)
+        {
+            m_manager.AddRef(index, m_manager.m_slots[index].m_generation, p_type);
+
+            request.m_state      = ELoadState::READY;
+            request.m_index      = index;
+            request.m_generation = m_manager.m_slots[index].m_generation;
+
+            return ticket;
+        }
+
+        request.m_resource = std::move(p_resource);
+
+        m_pendingPaths[request.m_normalizedPath] = ticket;
+        ++m_pendingCount;
+
+        lock.unlock();
+
+        m_jobSystem.Schedule([this, ticket]
+        {
+            LoadRequest(ticket);
+        }, &m_loadJobs);
+
+        return ticket;
+    }
+
+    bool ResourceLoader::AddDependencies(const LoadTicket p_ticket, const std::vector<LoadTicket>& p_dependencies)
+    {
+        const bool hasCycle = std::ranges::any_of(p_dependencies, [this, p_ticket](const LoadTicket p_dependency)
+        {
+            return p_dependency == p_ticket || DependsOn(p_dependency, p_ticket);
+        });
+
+        if (hasCycle)
+            return false;
+
+        std::vector<LoadTicket>& dependencies = m_requests.at(p_ticket).m_dependencies;
+
+        for (const LoadTicket dependency : p_dependencies)
+        {
+            if (std::ranges::find(dependencies, dependency) == dependencies.end())
+                dependencies.push_back(dependency);
+        }
+
+        return true;
+    }
+
+    bool ResourceLoader::DependsOn(const LoadTicket p_ticket, const LoadTicket p_dependency) const
+    {
+        std::vector<LoadTicket>        toVisit = { p_ticket };
+        std::unordered_set<LoadTicket> visited;
+
+        while (!toVisit.empty())
+        {
+            const LoadTicket ticket = toVisit.back();
+            toVisit.pop_back();
+
+            const auto it = m_requests.find(ticket);
+
+            // Completed requests don't wait on anything anymore
+            if (!visited.insert(ticket).second || it == m_requests.end() || it->second.m_state == ELoadState::READY
+                || it->second.m_state == ELoadState::FAILED)
+                continue;
+
+            for (const LoadTicket dependency : it->second.m_dependencies)
+            {
+                if (dependency == p_dependency)
+                    return true;
+
+                toVisit.push_back(dependency);
+            }
+        }
+
+        return false;
+    }
+
+    void ResourceLoader::LoadRequest(const LoadTicket p_ticket)
+    {
+        std::unique_lock lock(m_mutex);
+
+        Request& request = m_requests.at(p_ticket);
+        request.m_state  = ELoadState::LOADING;
+
+        lock.unlock();
+        const bool isLoaded = request.m_resource->Load(request.m_path);
+        lock.lock();
+
+        if (isLoaded)
+        {
+            request.m_state = ELoadState::LOADED;
+            m_initQueue.push_back(p_ticket);
+        }
+        else
+        {
+            SV_LOG_ERROR("Unable to load resource \"%s\"", request.m_path.c_str());
+            Complete(request, ELoadState::FAILED);
+        }
+
+        ++m_loadedCount;
+        m_loadedCondition.notify_all();
+    }
+
+    bool ResourceLoader::AreDependenciesDone(const Request& p_request, bool& p_hasFailedDependency) const
+    {
+        for (const LoadTicket dependency : p_request.m_dependencies)
+        {
+            const auto it = m_requests.find(dependency);
+
+            // Missing tickets were either never issued or cleared once completed
+            if (it == m_requests.end())
+            {
+                if (dependency == INVALID_LOAD_TICKET || dependency >= m_nextTicket
+                    || m_clearedFailures.contains(dependency))
+                    p_hasFailedDependency = true;
+
+                continue;
+            }
+
+            if (it->second.m_state == ELoadState::FAILED)
+            {
+                p_hasFailedDependency = true;
+                continue;
+            }
+
+            if (it->second.m_state != ELoadState::READY)
+                return false;
+        }
+
+        return true;
+    }
+
+    void ResourceLoader::Register(Request& p_request)
+    {
+        const std::type_info& type  = *p_request.m_type;
+        uint32_t              index = m_manager.FindSlot(p_request.m_normalizedPath, type);
+
+        if (index == ResourceHandle<IResource>::INVALID_INDEX && m_manager.m_lookup.contains(p_request.m_normalizedPath))
+        {
+            SV_LOG_ERROR("Unable to register resource \"%s\" - already loaded with a different type", p_request.m_path.c_str());
+            Complete(p_request, ELoadState::FAILED);
+            return;
+        }
+
+        // The resource may have been loaded synchronously while this request was in flight
+        if (index == ResourceHandle<IResource>::INVALID_INDEX)
+        {
+            index = m_manager.Register(p_request.m_normalizedPath, type, std::move(p_request.m_resource));
+
+            for (uint32_t i = 1; i < p_request.m_requestCount; ++i)
+                m_manager.AddRef(index, m_manager.m_slots[index].m_generation, type);
+        }
+        else
+        {
+            p_request.m_resource.reset();
+
+            for (uint32_t i = 0; i < p_request.m_requestCount; ++i)
+                m_manager.AddRef(index, m_manager.m_slots[index].m_generation, type);
+        }
+
+        p_request.m_index      = index;
+        p_request.m_generation = m_manager.m_slots[index].m_generation;
+
+        Complete(p_request, ELoadState::READY);
+    }
+
+    void ResourceLoader::Complete(Request& p_request, const ELoadState p_state)
+    {
+        p_request.m_state = p_state;
+        p_request.m_resource.reset();
+
+        m_pendingPaths.erase(p_request.m_normalizedPath);
+        --m_pendingCount;
+
+        m_loadedCondition.notify_all();
+    }
+}
@@ -0,0 +1,185 @@
+#include "SurvivantCore/Resources/ResourceManager.h"
+
+#include "SurvivantCore/Debug/Assertion.h"
+
+namespace SvCore::Resources
+{
+    constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+    void ResourceManager::SetMemoryBudget(const size_t p_budget)
+    {
+        m_memoryBudget = p_budget;
+        Trim();
+    }
+
+    size_t ResourceManager::GetMemoryBudget() const
+    {
+        return m_memoryBudget;
+    }
+
+    size_t ResourceManager::GetMemoryUsage() const
+    {
+        return m_memoryUsage;
+    }
+
+    size_t ResourceManager::GetResourceCount() const
+    {
+        return m_lookup.size();
+    }
+
+    size_t ResourceManager::UnloadUnused()
+    {
+        size_t count = 0;
+
+        for (uint32_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i].m_resource && m_slots[i].m_refCount == 0)
+            {
+                FreeSlot(i);
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+    void ResourceManager::Clear()
+    {
+        for (uint32_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i].m_resource)
+                FreeSlot(i);
+        }
+    }
+
+    ResourceManager& ResourceManager::GetInstance()
+    {
+        static ResourceManager instance;
+        return instance;
+    }
+
+    uint32_t ResourceManager::FindSlot(const std::string& p_path, const std::type_info& p_type) const
+    {
+        const auto it = m_lookup.find(p_path);
+
+        if (it == m_lookup.end() || *m_slots[it->second].m_type != p_type)
+            return INVALID_SLOT;
+
+        return it->second;
+    }
+
+    const ResourceManager::Slot* ResourceManager::GetSlot(const uint32_t p_index, const uint32_t p_generation,
+                                                          const std::type_info& p_type) const
+    {
+        if (p_index >= m_slots.size())
+            return nullptr;
+
+        const Slot& slot = m_slots[p_index];
+
+        if (!slot.m_resource || slot.m_generation != p_generation || *slot.m_type != p_type)
+            return nullptr;
+
+        return &slot;
+    }
+
+    uint32_t ResourceManager::Register(const std::string& p_path, const std::type_info& p_type,
+                                       std::unique_ptr<IResource> p_resource)
+    {
+        uint32_t index;
+
+        if (m_freeSlots.empty())
+        {
+            index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        else
+        {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+
+        Slot& slot = m_slots[index];
+
+        slot.m_memorySize = p_resource->GetMemorySize();
+        slot.m_resource   = std::move(p_resource);
+        slot.m_path       = p_path;
+        slot.m_type       = &p_type;
+        slot.m_refCount   = 1;
+
+        m_lookup[p_path] = index;
+        m_memoryUsage += slot.m_memorySize;
+
+        Trim();
+
+        return index;
+    }
+
+    bool ResourceManager::AddRef(const uint32_t p_index, const uint32_t p_generation, const std::type_info& p_type)
+    {
+        if (!GetSlot(p_index, p_generation, p_type))
+            return false;
+
+        ++m_slots[p_index].m_refCount;
+        return true;
+    }
+
+    void ResourceManager::RemoveRef(const uint32_t p_index, const uint32_t p_generation, const std::type_info& p_type)
+    {
+        if (!CHECK(GetSlot(p_index, p_generation, p_type) != nullptr, "Unable to release resource - stale handle"))
+            return;
+
+        Slot& slot = m_slots[p_index];
+
+        if (!CHECK(slot.m_refCount > 0, "Unable to release resource \"%s\" - not referenced", slot.m_path.c_str()))
+            return;
+
+        if (--slot.m_refCount == 0)
+        {
+            slot.m_lastRelease = ++m_releaseCount;
+            Trim();
+        }
+    }
+
+    void ResourceManager::Trim()
+    {
+        while (m_memoryUsage > m_memoryBudget)
+        {
+            uint32_t oldest = INVALID_SLOT;
+
+            for (uint32_t i = 0; i < m_slots.size(); ++i)
+            {
+                const Slot& slot = m_slots[i];
+
+                if (!slot.m_resource || slot.m_refCount != 0)
+                    continue;
+
+                if (oldest == INVALID_SLOT || slot.m_lastRelease < m_slots[oldest].m_lastRelease)
+                    oldest = i;
+            }
+
+            // Everything left is in use
+            if (oldest == INVALID_SLOT)
+                return;
+
+            FreeSlot(oldest);
+        }
+    }
+
+    void ResourceManager::FreeSlot(const uint32_t p_index)
+    {
+        Slot& slot = m_slots[p_index];
+
+        m_lookup.erase(slot.m_path);
+        m_memoryUsage -= slot.m_memorySize;
+
+        slot.m_resource.reset();
+        slot.m_path.clear();
+        slot.m_type       = nullptr;
+        slot.m_memorySize = 0;
+        slot.m_refCount   = 0;
+
+        // Invalidate the handles pointing to this slot
+        ++slot.m_generation;
+        m_freeSlots.push_back(p_index);
+    }
+}
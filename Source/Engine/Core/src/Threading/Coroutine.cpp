@@ -0,0 +1,218 @@
+#include "SurvivantCore/Threading/Coroutine.h"
+
+#include "SurvivantCore/Threading/JobSystem.h"
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace SvCore::Threading
+{
+    namespace
+    {
+        /**
+         * \brief Fixed-size pool of coroutine frames. Freed frames are reused by the next coroutines instead of going back
+         * to the heap
+         */
+        class FramePool
+        {
+        public:
+            static constexpr size_t FRAME_SIZE  = 1024;
+            static constexpr size_t FRAME_COUNT = 512;
+
+            FramePool()
+                : m_memory(std::make_unique<std::byte[]>(FRAME_SIZE * FRAME_COUNT))
+            {
+                m_freeFrames.reserve(FRAME_COUNT);
+
+                for (size_t i = FRAME_COUNT; i > 0; --i)
+                    m_freeFrames.push_back(m_memory.get() + (i - 1) * FRAME_SIZE);
+            }
+
+            void* Allocate()
+            {
+                std::scoped_lock lock(m_mutex);
+
+                if (m_freeFrames.empty())
+                    return nullptr;
+
+                void* frame = m_freeFrames.back();
+                m_freeFrames.pop_back();
+                return frame;
+            }
+
+            bool Free(void* p_frame)
+            {
+                std::byte* frame = static_cast<std::byte*>(p_frame);
+
+                if (frame < m_memory.get() || frame >= m_memory.get() + FRAME_SIZE * FRAME_COUNT)
+                    return false;
+
+                std::scoped_lock lock(m_mutex);
+                m_freeFrames.push_back(frame);
+                return true;
+            }
+
+        private:
+            std::unique_ptr<std::byte[]> m_memory;
+            std::vector<std::byte*>      m_freeFrames;
+            std::mutex                   m_mutex;
+        };
+
+        FramePool& GetFramePool()
+        {
+            // Never destroyed - coroutines can still finish while the job system singleton shuts down
+            static FramePool* pool = new FramePool();
+            return *pool;
+        }
+    }
+
+    bool Coroutine::CounterAwaiter::await_ready() const noexcept
+    {
+        return m_counter.IsDone();
+    }
+
+    void Coroutine::CounterAwaiter::await_suspend(const Handle p_handle) const
+    {
+        // Parks the resume job on the counter - it is queued on any worker once the counter reaches zero
+        p_handle.promise().m_jobSystem->Schedule([p_handle]
+        {
+            p_handle.resume();
+        }, nullptr, &m_counter);
+    }
+
+    void Coroutine::CounterAwaiter::await_resume() const noexcept
+    {
+    }
+
+    bool Coroutine::MainThreadAwaiter::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void Coroutine::MainThreadAwaiter::await_suspend(const Handle p_handle) const
+    {
+        p_handle.promise().m_jobSystem->ScheduleOnMainThread([p_handle]
+        {
+            p_handle.resume();
+        });
+    }
+
+    void Coroutine::MainThreadAwaiter::await_resume() const noexcept
+    {
+    }
+
+    bool Coroutine::FinalAwaiter::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void Coroutine::FinalAwaiter::await_suspend(const Handle p_handle) const noexcept
+    {
+        Complete(p_handle);
+    }
+
+    void Coroutine::FinalAwaiter::await_resume() const noexcept
+    {
+    }
+
+    Coroutine Coroutine::promise_type::get_return_object() noexcept
+    {
+        return Coroutine(Handle::from_promise(*this));
+    }
+
+    std::suspend_always Coroutine::promise_type::initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    Coroutine::FinalAwaiter Coroutine::promise_type::final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void Coroutine::promise_type::return_void() const noexcept
+    {
+    }
+
+    void Coroutine::promise_type::unhandled_exception() const noexcept
+    {
+        std::terminate();
+    }
+
+    Coroutine::CounterAwaiter Coroutine::promise_type::await_transform(JobCounter& p_counter) const noexcept
+    {
+        return { p_counter };
+    }
+
+    Coroutine::MainThreadAwaiter Coroutine::promise_type::await_transform(ResumeOnMainThread) const noexcept
+    {
+        return {};
+    }
+
+    void* Coroutine::promise_type::operator new(const size_t p_size)
+    {
+        if (p_size <= FramePool::FRAME_SIZE)
+        {
+            if (void* frame = GetFramePool().Allocate())
+                return frame;
+        }
+
+        return ::operator new(p_size);
+    }
+
+    void Coroutine::promise_type::operator delete(void* p_frame, const size_t p_size) noexcept
+    {
+        if (p_size <= FramePool::FRAME_SIZE && GetFramePool().Free(p_frame))
+            return;
+
+        ::operator delete(p_frame);
+    }
+
+    Coroutine::Coroutine(Coroutine&& p_other) noexcept
+        : m_handle(std::exchange(p_other.m_handle, nullptr))
+    {
+    }
+
+    Coroutine::~Coroutine()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    Coroutine& Coroutine::operator=(Coroutine&& p_other) noexcept
+    {
+        if (this == &p_other)
+            return *this;
+
+        if (m_handle)
+            m_handle.destroy();
+
+        m_handle = std::exchange(p_other.m_handle, nullptr);
+        return *this;
+    }
+
+    Coroutine::Coroutine(const Handle p_handle)
+        : m_handle(p_handle)
+    {
+    }
+
+    Coroutine::Handle Coroutine::Release()
+    {
+        return std::exchange(m_handle, nullptr);
+    }
+
+    void Coroutine::Complete(const Handle p_handle)
+    {
+        JobSystem*  jobSystem = p_handle.promise().m_jobSystem;
+        JobCounter* counter   = p_handle.promise().m_counter;
+
+        // Free the frame first so waiters resumed by the counter can reuse it
+        p_handle.destroy();
+
+        if (counter)
+            jobSystem->Signal(*counter);
+    }
+}
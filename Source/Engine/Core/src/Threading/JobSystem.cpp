@@ -0,0 +1,316 @@
+#include "SurvivantCore/Threading/JobSystem.h"
+
+#include "SurvivantCore/Debug/Profiler.h"
+#include "SurvivantCore/Memory/ScratchArena.h"
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <algorithm>
+#include <memory_resource>
+
+namespace SvCore::Threading
+{
+    struct JobCounter::Job
+    {
+        JobSystem::Task m_task;
+        JobCounter*     m_counter;
+        bool            m_isMainThreadOnly;
+    };
+
+    namespace
+    {
+        thread_local const JobSystem* g_currentSystem = nullptr;
+        thread_local uint32_t         g_queueIndex    = 0;
+    }
+
+    bool JobCounter::IsDone() const
+    {
+        return m_pending.load(std::memory_order_acquire) == 0;
+    }
+
+    uint32_t JobCounter::GetPendingCount() const
+    {
+        return m_pending.load(std::memory_order_acquire);
+    }
+
+    JobSystem::JobSystem(uint32_t p_workerCount)
+        : m_mainThreadId(std::this_thread::get_id())
+    {
+        if (p_workerCount == 0)
+            p_workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+        // Queue 0 belongs to the main thread
+        for (uint32_t i = 0; i <= p_workerCount; ++i)
+            m_queues.push_back(std::make_unique<WorkStealingQueue<Job>>(QUEUE_CAPACITY));
+
+        g_currentSystem = this;
+        g_queueIndex    = 0;
+
+        m_workers.reserve(p_workerCount);
+
+        for (uint32_t i = 1; i <= p_workerCount; ++i)
+            m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        while (Job* job = FindJob())
+            Execute(job);
+
+        m_isRunning = false;
+
+        {
+            std::scoped_lock lock(m_sleepMutex);
+            m_sleepCondition.notify_all();
+        }
+
+        for (std::thread& worker : m_workers)
+            worker.join();
+
+        if (g_currentSystem == this)
+            g_currentSystem = nullptr;
+    }
+
+    void JobSystem::Schedule(Task p_task, JobCounter* p_counter, JobCounter* p_dependency)
+    {
+        Submit(std::move(p_task), p_counter, p_dependency, false);
+    }
+
+    void JobSystem::Schedule(Coroutine p_coroutine, JobCounter* p_counter, JobCounter* p_dependency)
+    {
+        const Coroutine::Handle handle = p_coroutine.Release();
+
+        if (!handle)
+            return;
+
+        Coroutine::promise_type& promise = handle.promise();
+        promise.m_jobSystem              = this;
+        promise.m_counter                = p_counter;
+
+        // The resume job isn't tracked - the coroutine signals its counter when it returns
+        if (p_counter)
+            p_counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        Submit([handle]
+        {
+            handle.resume();
+        }, nullptr, p_dependency, false);
+    }
+
+    void JobSystem::ScheduleOnMainThread(Task p_task, JobCounter* p_counter, JobCounter* p_dependency)
+    {
+        Submit(std::move(p_task), p_counter, p_dependency, true);
+    }
+
+    void JobSystem::Wait(const JobCounter& p_counter)
+    {
+        while (!p_counter.IsDone())
+        {
+            if (Job* job = FindJob())
+                Execute(job);
+            else
+                std::this_thread::yield();
+        }
+
+        // The last job may still be releasing its waiting jobs - don't let the caller destroy the counter under it
+        std::scoped_lock lock(p_counter.m_mutex);
+    }
+
+    size_t JobSystem::ExecuteMainThreadJobs()
+    {
+        if (!IsMainThread())
+            return 0;
+
+        // Called every frame, so the jobs are copied to the scratch buffer instead of swapped into a new deque, which
+        // would allocate even when empty
+        const Memory::ScratchArena scratch;
+        std::pmr::vector<Job*>     jobs(scratch.GetResource());
+
+        {
+            std::scoped_lock lock(m_mainThreadMutex);
+            jobs.assign(m_mainThreadJobs.begin(), m_mainThreadJobs.end());
+            m_mainThreadJobs.clear();
+        }
+
+        for (Job* job : jobs)
+            Execute(job);
+
+        return jobs.size();
+    }
+
+    bool JobSystem::IsMainThread() const
+    {
+        return std::this_thread::get_id() == m_mainThreadId;
+    }
+
+    uint32_t JobSystem::GetWorkerCount() const
+    {
+        return static_cast<uint32_t>(m_workers.size());
+    }
+
+    JobSystem& JobSystem::GetInstance()
+    {
+        static JobSystem instance;
+        return instance;
+    }
+
+    void JobSystem::Submit(Task p_task, JobCounter* p_counter, JobCounter* p_dependency, const bool p_isMainThreadOnly)
+    {
+        Job* job = new Job{ std::move(p_task), p_counter, p_isMainThreadOnly };
+
+        if (p_counter)
+            p_counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        if (p_dependency)
+        {
+            std::scoped_lock lock(p_dependency->m_mutex);
+
+            if (!p_dependency->IsDone())
+            {
+                p_dependency->m_waitingJobs.push_back(job);
+                return;
+            }
+        }
+
+        Enqueue(job);
+    }
+
+    void JobSystem::Enqueue(Job* p_job)
+    {
+        if (p_job->m_isMainThreadOnly)
+        {
+            std::scoped_lock lock(m_mainThreadMutex);
+            m_mainThreadJobs.push_back(p_job);
+            return;
+        }
+
+        // Foreign threads and full deques fall back to the shared queue
+        if (g_currentSystem != this || !m_queues[g_queueIndex]->Push(p_job))
+        {
+            std::scoped_lock lock(m_sharedMutex);
+            m_sharedJobs.push_back(p_job);
+        }
+
+        m_queuedCount.fetch_add(1);
+
+        if (m_sleepingCount.load() > 0)
+        {
+            std::scoped_lock lock(m_sleepMutex);
+            m_sleepCondition.notify_one();
+        }
+    }
+
+    JobSystem::Job* JobSystem::FindJob()
+    {
+        const bool isOwnThread = g_currentSystem == this;
+
+        if (isOwnThread)
+        {
+            if (Job* job = m_queues[g_queueIndex]->Pop())
+            {
+                m_queuedCount.fetch_sub(1);
+                return job;
+            }
+        }
+
+        if (IsMainThread())
+        {
+            std::scoped_lock lock(m_mainThreadMutex);
+
+            if (!m_mainThreadJobs.empty())
+            {
+                Job* job = m_mainThreadJobs.front();
+                m_mainThreadJobs.pop_front();
+                return job;
+            }
+        }
+
+        {
+            std::scoped_lock lock(m_sharedMutex);
+
+            if (!m_sharedJobs.empty())
+            {
+                Job* job = m_sharedJobs.front();
+                m_sharedJobs.pop_front();
+                m_queuedCount.fetch_sub(1);
+                return job;
+            }
+        }
+
+        const auto   queueCount = static_cast<uint32_t>(m_queues.size());
+        const size_t firstQueue = isOwnThread ? g_queueIndex + 1 : 0;
+
+        for (uint32_t i = 0; i < queueCount; ++i)
+        {
+            const size_t index = (firstQueue + i) % queueCount;
+
+            if (isOwnThread && index == g_queueIndex)
+                continue;
+
+            if (Job* job = m_queues[index]->Steal())
+            {
+                m_queuedCount.fetch_sub(1);
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::Execute(Job* p_job)
+    {
+        {
+            SV_PROFILE_SCOPE("Job");
+            p_job->m_task();
+        }
+
+        JobCounter* counter = p_job->m_counter;
+        delete p_job;
+
+        if (counter)
+            Signal(*counter);
+    }
+
+    void JobSystem::Signal(JobCounter& p_counter)
+    {
+        std::vector<Job*> releasedJobs;
+
+        {
+            std::scoped_lock lock(p_counter.m_mutex);
+
+            if (p_counter.m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                releasedJobs.swap(p_counter.m_waitingJobs);
+        }
+
+        for (Job* job : releasedJobs)
+            Enqueue(job);
+    }
+
+    void JobSystem::WorkerLoop(const uint32_t p_index)
+    {
+        g_currentSystem = this;
+        g_queueIndex    = p_index;
+
+        Debug::Profiler::GetInstance().SetThreadName(Utility::FormatString("Worker %u", p_index));
+
+        while (m_isRunning)
+        {
+            if (Job* job = FindJob())
+            {
+                Execute(job);
+                continue;
+            }
+
+            m_sleepingCount.fetch_add(1);
+
+            {
+                std::unique_lock lock(m_sleepMutex);
+                m_sleepCondition.wait(lock, [this]
+                {
+                    return !m_isRunning || m_queuedCount.load() > 0;
+                });
+            }
+
+            m_sleepingCount.fetch_sub(1);
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include "SurvivantCore/Utility/FileSystem.h"
 #include "SurvivantCore/Utility/LeanWindows.h"
+#include "SurvivantCore/Utility/Utility.h"
 
 #include <direct.h>
 #include <filesystem>
@@ -38,4 +39,21 @@ namespace SvCore::Utility
     {
         return _chdir(p_directory.c_str()) == 0;
     }
+
+    std::string NormalizePath(const std::string& p_path)
+    {
+        std::error_code error;
+        std::filesystem::path path = std::filesystem::absolute(p_path, error);
+
+        if (error)
+            path = p_path;
+
+        std::string normalized = path.lexically_normal().generic_string();
+
+#ifdef _WIN32
+        ToLowerInPlace(normalized);
+#endif // _WIN32
+
+        return normalized;
+    }
 }
@@ -0,0 +1,180 @@
+#include "SurvivantCore/Utility/FrameStats.h"
+
+#include "SurvivantCore/Utility/Utility.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SvCore::Utility
+{
+    namespace
+    {
+        float Percentile(const std::vector<float>& p_sortedSamples, const float p_percent)
+        {
+            // Nearest-rank method - always returns an actual sample
+            const size_t rank = static_cast<size_t>(std::ceil(p_percent / 100.f * static_cast<float>(p_sortedSamples.size())));
+            return p_sortedSamples[std::clamp<size_t>(rank, 1, p_sortedSamples.size()) - 1];
+        }
+    }
+
+    FrameStats::FrameStats(const size_t p_windowSize, const float p_hitchRatio)
+        : m_windowSize(std::max<size_t>(p_windowSize, 1)), m_hitchRatio(p_hitchRatio)
+    {
+        Reset();
+    }
+
+    void FrameStats::AddFrame(const Timer& p_timer)
+    {
+        m_frameIndex = p_timer.getFrameCount();
+
+        // The first tick has no previous frame to measure
+        if (m_frameIndex <= 1)
+            return;
+
+        const float milliseconds = p_timer.getRealDeltaTime() * 1000.f;
+
+        AddSample(m_timings.front(), milliseconds);
+
+        if (m_csv.is_open())
+            m_csv << m_frameIndex << ',' << FRAME_TIMING_NAME << ',' << milliseconds << '\n';
+    }
+
+    void FrameStats::AddTiming(const std::string& p_name, const float p_milliseconds)
+    {
+        const auto [it, isNew] = m_timingIndices.try_emplace(p_name, m_timings.size());
+
+        if (isNew)
+            m_timings.emplace_back().m_name = p_name;
+
+        AddSample(m_timings[it->second], p_milliseconds);
+
+        if (m_csv.is_open())
+            m_csv << m_frameIndex << ',' << p_name << ',' << p_milliseconds << '\n';
+    }
+
+    TimingSummary FrameStats::GetFrameSummary() const
+    {
+        return Summarize(m_timings.front());
+    }
+
+    TimingSummary FrameStats::GetSummary(const std::string& p_name) const
+    {
+        const auto it = m_timingIndices.find(p_name);
+        return it != m_timingIndices.end() ? Summarize(m_timings[it->second]) : TimingSummary();
+    }
+
+    std::vector<std::string> FrameStats::GetTimingNames() const
+    {
+        std::vector<std::string> names;
+        names.reserve(m_timings.size());
+
+        for (const Timing& timing : m_timings)
+            names.push_back(timing.m_name);
+
+        return names;
+    }
+
+    size_t FrameStats::GetTotalHitchCount() const
+    {
+        return m_timings.front().m_totalHitchCount;
+    }
+
+    bool FrameStats::OpenCsv(const std::filesystem::path& p_filePath)
+    {
+        m_csv.close();
+        m_csv.open(p_filePath, std::ios::trunc);
+
+        if (!m_csv.is_open())
+            return false;
+
+        m_csv << "frame,timing,milliseconds\n";
+        return true;
+    }
+
+    bool FrameStats::WriteSummaryCsv(const std::filesystem::path& p_filePath) const
+    {
+        std::ofstream file(p_filePath, std::ios::trunc);
+
+        if (!file.is_open())
+            return false;
+
+        file << "timing,samples,hitches,min,average,p50,p95,p99,max\n";
+
+        for (const Timing& timing : m_timings)
+        {
+            const TimingSummary summary = Summarize(timing);
+
+            file << timing.m_name << ',' << summary.m_sampleCount << ',' << summary.m_hitchCount << ','
+                << summary.m_min << ',' << summary.m_average << ',' << summary.m_p50 << ',' << summary.m_p95 << ','
+                << summary.m_p99 << ',' << summary.m_max << '\n';
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    std::string FrameStats::ToString() const
+    {
+        const TimingSummary summary = GetFrameSummary();
+
+        return FormatString("%zu frames - min %.2fms | avg %.2fms | p50 %.2fms | p95 %.2fms | p99 %.2fms | max %.2fms | "
+                            "%zu hitches (%zu total)", summary.m_sampleCount, summary.m_min, summary.m_average,
+                            summary.m_p50, summary.m_p95, summary.m_p99, summary.m_max, summary.m_hitchCount,
+                            GetTotalHitchCount());
+    }
+
+    void FrameStats::Reset()
+    {
+        m_timings.clear();
+        m_timingIndices.clear();
+
+        m_timings.emplace_back().m_name = FRAME_TIMING_NAME;
+        m_timingIndices.emplace(FRAME_TIMING_NAME, 0);
+    }
+
+    void FrameStats::AddSample(Timing& p_timing, const float p_milliseconds)
+    {
+        const size_t count   = p_timing.m_samples.size();
+        const double average = count > 0 ? p_timing.m_sum / static_cast<double>(count) : 0;
+        const bool   isHitch = count > 0 && p_milliseconds > average * m_hitchRatio;
+
+        if (count < m_windowSize)
+        {
+            p_timing.m_samples.push_back(p_milliseconds);
+            p_timing.m_hitches.push_back(isHitch);
+        }
+        else
+        {
+            p_timing.m_sum -= p_timing.m_samples[p_timing.m_next];
+            p_timing.m_hitchCount -= p_timing.m_hitches[p_timing.m_next];
+
+            p_timing.m_samples[p_timing.m_next] = p_milliseconds;
+            p_timing.m_hitches[p_timing.m_next] = isHitch;
+            p_timing.m_next                     = (p_timing.m_next + 1) % m_windowSize;
+        }
+
+        p_timing.m_sum += p_milliseconds;
+        p_timing.m_hitchCount += isHitch;
+        p_timing.m_totalHitchCount += isHitch;
+    }
+
+    TimingSummary FrameStats::Summarize(const Timing& p_timing)
+    {
+        if (p_timing.m_samples.empty())
+            return {};
+
+        std::vector<float> samples = p_timing.m_samples;
+        std::ranges::sort(samples);
+
+        TimingSummary summary;
+        summary.m_sampleCount = samples.size();
+        summary.m_hitchCount  = p_timing.m_hitchCount;
+        summary.m_min         = samples.front();
+        summary.m_average     = static_cast<float>(p_timing.m_sum / static_cast<double>(samples.size()));
+        summary.m_p50         = Percentile(samples, 50.f);
+        summary.m_p95         = Percentile(samples, 95.f);
+        summary.m_p99         = Percentile(samples, 99.f);
+        summary.m_max         = samples.back();
+
+        return summary;
+    }
+}
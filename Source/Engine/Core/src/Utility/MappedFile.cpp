@@ -0,0 +1,109 @@
+#include "SurvivantCore/Utility/MappedFile.h"
+
+#ifdef _WIN32
+#include "SurvivantCore/Utility/LeanWindows.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace SvCore::Utility
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const std::string& p_path)
+    {
+        Close();
+
+#ifdef _WIN32
+        const HANDLE file = CreateFileA(p_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // The view keeps the mapping alive, so both handles can be closed right away
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (!mapping)
+            return false;
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mapping);
+
+        if (!data)
+            return false;
+
+        m_data = static_cast<std::byte*>(data);
+        m_size = static_cast<size_t>(size.QuadPart);
+#else
+        const int file = open(p_path.c_str(), O_RDONLY);
+
+        if (file < 0)
+            return false;
+
+        struct stat status;
+
+        if (fstat(file, &status) != 0 || status.st_size == 0)
+        {
+            close(file);
+            return false;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+        close(file);
+
+        if (data == MAP_FAILED)
+            return false;
+
+        m_data = static_cast<std::byte*>(data);
+        m_size = static_cast<size_t>(status.st_size);
+#endif // _WIN32
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (!m_data)
+            return;
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(m_data, m_size);
+#endif // _WIN32
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    std::byte* MappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    size_t MappedFile::GetSize() const
+    {
+        return m_size;
+    }
+}
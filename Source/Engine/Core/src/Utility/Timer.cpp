@@ -13,17 +13,19 @@ namespace SvCore::Utility
     {
         if (m_isFirstUpdate)
         {
-            m_currentTime = clock::now();
-            m_lastUpdate  = m_currentTime;
-            m_deltaTime   = 0;
+            m_currentTime   = clock::now();
+            m_lastUpdate    = m_currentTime;
+            m_deltaTime     = 0;
+            m_realDeltaTime = 0;
 
             m_isFirstUpdate = false;
         }
         else
         {
-            m_lastUpdate  = m_currentTime;
-            m_currentTime = clock::now();
-            m_deltaTime   = std::chrono::duration<float>(m_currentTime - m_lastUpdate).count();
+            m_lastUpdate    = m_currentTime;
+            m_currentTime   = clock::now();
+            m_realDeltaTime = std::chrono::duration<float>(m_currentTime - m_lastUpdate).count();
+            m_deltaTime     = m_fixedDeltaTime > 0.f ? m_fixedDeltaTime : m_realDeltaTime;
             m_unscaledTime += m_deltaTime;
             m_time += m_deltaTime * m_timeScale;
         }
@@ -51,6 +53,11 @@ namespace SvCore::Utility
         return m_deltaTime;
     }
 
+    float Timer::getRealDeltaTime() const
+    {
+        return m_realDeltaTime;
+    }
+
     float Timer::getTimeScale() const
     {
         return m_timeScale;
@@ -61,6 +68,16 @@ namespace SvCore::Utility
         m_timeScale = timeScale;
     }
 
+    float Timer::getFixedDeltaTime() const
+    {
+        return m_fixedDeltaTime;
+    }
+
+    void Timer::setFixedDeltaTime(const float fixedDeltaTime)
+    {
+        m_fixedDeltaTime = fixedDeltaTime;
+    }
+
     uint64_t Timer::getFrameCount() const
     {
         return m_frameCount;
@@ -0,0 +1,202 @@
+#pragma once
+#include "SurvivantCore/Debug/Profiler.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#ifndef SV_DISABLE_PROFILER
+// The zone's name must be a string literal - it is only resolved a few frames later
+#define SV_GPU_PROFILE_SCOPE(name) const SvRendering::Core::GpuZone SV_PROFILE_CONCAT(svGpuProfileZone, __LINE__)("" name)
+#else
+#define SV_GPU_PROFILE_SCOPE(name) ((void)0)
+#endif // !SV_DISABLE_PROFILER
+
+namespace SvRendering::Core
+{
+    /**
+     * \brief Times the GPU commands issued in the scope it lives in. Use the SV_GPU_PROFILE_SCOPE macro
+     */
+    class GpuZone
+    {
+    public:
+        /**
+         * \brief Starts a GPU profiling zone
+         * \param p_name The zone's name. Must have a static lifetime
+         */
+        explicit GpuZone(const char* p_name);
+
+        /**
+         * \brief Disable GPU zone copying
+         */
+        GpuZone(const GpuZone& p_other) = delete;
+
+        /**
+         * \brief Disable GPU zone moving
+         */
+        GpuZone(GpuZone&& p_other) noexcept = delete;
+
+        /**
+         * \brief Ends the GPU profiling zone
+         */
+        ~GpuZone();
+
+        /**
+         * \brief Disable GPU zone copying
+         */
+        GpuZone& operator=(const GpuZone& p_other) = delete;
+
+        /**
+         * \brief Disable GPU zone moving
+         */
+        GpuZone& operator=(GpuZone&& p_other) noexcept = delete;
+
+    private:
+        bool m_isRecording;
+    };
+
+    /**
+     * \brief GPU profiler based on timestamp queries.\n
+     * Each frame's queries are only read back FRAME_LATENCY frames later, and frames whose results still aren't
+     * available are skipped, so the CPU never waits on the GPU. Resolved zones are converted to the CPU profiler's
+     * clock and recorded in its "GPU" track.\n
+     * Every function is a no-op when the context doesn't support timestamp queries. Render thread only
+     */
+    class GpuProfiler
+    {
+    public:
+        static constexpr size_t FRAME_LATENCY   = 4;
+        static constexpr size_t MAX_FRAME_ZONES = 256;
+        static constexpr size_t MAX_ZONE_DEPTH  = 32;
+
+        /**
+         * \brief Disable GPU profiler copying
+         */
+        GpuProfiler(const GpuProfiler& p_other) = delete;
+
+        /**
+         * \brief Disable GPU profiler moving
+         */
+        GpuProfiler(GpuProfiler&& p_other) noexcept = delete;
+
+        /**
+         * \brief Destroys the GPU profiler. Shutdown must have been called while the context was still alive
+         */
+        ~GpuProfiler() = default;
+
+        /**
+         * \brief Disable GPU profiler copying
+         */
+        GpuProfiler& operator=(const GpuProfiler& p_other) = delete;
+
+        /**
+         * \brief Disable GPU profiler moving
+         */
+        GpuProfiler& operator=(GpuProfiler&& p_other) noexcept = delete;
+
+        /**
+         * \brief Creates the query pool in the current context
+         * \return True if the context supports timestamp queries. False otherwise
+         */
+        bool Initialize();
+
+        /**
+         * \brief Destroys the query pool. Must be called before the context is destroyed
+         */
+        void Shutdown();
+
+        /**
+         * \brief Checks whether GPU zones are recorded
+         * \return True if the profiler was initialized with timestamp query support. False otherwise
+         */
+        bool IsSupported() const;
+
+        /**
+         * \brief Closes the current frame and reads back the oldest frame's results if they are available.
+         * Every zone must be closed
+         */
+        void EndFrame();
+
+        /**
+         * \brief Gets the GPU duration of the last resolved frame, from its first zone's start to its last zone's end
+         * \return The last resolved frame's GPU time in milliseconds
+         */
+        double GetFrameTime() const;
+
+        /**
+         * \brief Gets the number of frames skipped because their results weren't available in time
+         * \return The number of skipped frames
+         */
+        size_t GetSkippedFrameCount() const;
+
+        /**
+         * \brief Accessor to the GpuProfiler singleton
+         * \return A reference to the current GpuProfiler instance
+         */
+        static GpuProfiler& GetInstance();
+
+    private:
+        friend class GpuZone;
+
+        struct Zone
+        {
+            const char* m_name;
+            uint32_t    m_startQuery;
+            uint32_t    m_endQuery;
+            uint32_t    m_depth;
+        };
+
+        struct Frame
+        {
+            std::vector<uint32_t> m_queries;
+            std::vector<Zone>     m_zones;
+            size_t                m_queryCount   = 0;
+            int64_t               m_gpuReference = 0;
+            uint64_t              m_cpuReference = 0;
+        };
+
+        std::array<Frame, FRAME_LATENCY> m_frames;
+        std::vector<size_t>              m_openZones;
+        size_t                           m_frameIndex        = 0;
+        size_t                           m_skippedFrameCount = 0;
+        double                           m_frameTime         = 0;
+        uint32_t                         m_track             = UINT32_MAX;
+        bool                             m_isSupported       = false;
+
+        /**
+         * \brief Creates an uninitialized GPU profiler
+         */
+        GpuProfiler() = default;
+
+        /**
+         * \brief Opens a zone in the current frame
+         * \param p_name The zone's name
+         * \return True if the zone is recorded. False otherwise
+         */
+        bool BeginZone(const char* p_name);
+
+        /**
+         * \brief Closes the last opened zone
+         */
+        void EndZone();
+
+        /**
+         * \brief Issues a timestamp query in the current frame
+         * \return The query's index in the frame's pool
+         */
+        uint32_t IssueTimestamp();
+
+        /**
+         * \brief Starts recording a frame in the given slot and samples the GPU clock to correlate it with the CPU's
+         * \param p_frame The frame slot to reset
+         */
+        void BeginFrame(Frame& p_frame) const;
+
+        /**
+         * \brief Reads back the given frame's results and records them in the CPU profiler
+         * \param p_frame The frame slot to resolve
+         * \return True if the frame's results were available. False otherwise
+         */
+        bool Resolve(Frame& p_frame);
+    };
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+namespace SvRendering::Enums
+{
+    /**
+     * \brief Supported texture atlas page layouts
+     */
+    enum class EAtlasLayout : uint8_t
+    {
+        PAGES,
+        ARRAY
+    };
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+namespace SvRendering::Enums
+{
+    /**
+     * \brief Supported mip generation filters
+     */
+    enum class EMipFilter : uint8_t
+    {
+        BOX,
+        KAISER
+    };
+}
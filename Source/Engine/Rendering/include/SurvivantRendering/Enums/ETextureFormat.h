@@ -16,6 +16,11 @@ namespace SvRendering::Enums
         BGRA,
         STENCIL_INDEX,
         DEPTH_COMPONENT,
-        DEPTH_STENCIL
+        DEPTH_STENCIL,
+        BC1,
+        BC3,
+        BC4,
+        BC5,
+        BC7
     };
 }
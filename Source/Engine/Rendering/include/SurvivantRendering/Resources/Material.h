@@ -1,6 +1,7 @@
 #pragma once
 #include "SurvivantCore/Resources/IResource.h"
 #include <string> // Pour std::string
+#include <vector>
 
 class Material : public SvCore::Resources::IResource 
 {
@@ -10,6 +11,9 @@ public:
     virtual bool Load(const std::string& filename) override; 
     virtual bool Init() override; 
 
+    // Requests the material's textures, so the resource loader only initializes the material once they are ready
+    std::vector<SvCore::Resources::LoadTicket> LoadDependencies(SvCore::Resources::ResourceLoader& p_loader) override;
+
     // Setters et getters pour les proprits du matriau
     void SetDiffuseTexture(const std::string& filename); // Dfinition de la texture de diffusion
     void SetSpecularTexture(const std::string& filename); // Dfinition de la texture spculaire
@@ -19,6 +23,10 @@ public:
     void SetSpecularColor(float r, float g, float b); // Dfinition de la couleur spculaire
     void SetShininess(float shininess); // Dfinition de la brillance
 
+    const std::string& GetDiffuseTexture() const;
+    const std::string& GetSpecularTexture() const;
+    const std::string& GetNormalTexture() const;
+
     // Autres fonctions membres pour grer les paramtres du matriau, par exemple, activer/dsactiver les textures, etc.
 
 private:
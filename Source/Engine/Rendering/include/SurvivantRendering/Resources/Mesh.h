@@ -1,4 +1,6 @@
 #pragma once
+#include "SurvivantCore/Memory/ConcurrentObjectPool.h"
+
 #include "SurvivantRendering/Geometry/Vertex.h"
 #include "SurvivantRendering/Geometry/BoundingBox.h"
 #include "SurvivantRendering/Core/VertexArray.h"
@@ -74,14 +76,20 @@ namespace SvRendering::Resources
          */
         Geometry::BoundingBox GetBoundingBox() const;
 
+        /**
+         * \brief Gets the memory held by the mesh's vertices and indices
+         * \return The mesh's CPU memory footprint in bytes
+         */
+        size_t GetMemorySize() const;
+
     private:
         std::vector<Geometry::Vertex> m_vertices;
         std::vector<uint32_t>         m_indices;
 
         Geometry::BoundingBox m_boundingBox;
 
-        std::unique_ptr<Core::Buffers::VertexBuffer> m_vbo;
-        std::unique_ptr<Core::Buffers::IndexBuffer>  m_ebo;
-        std::unique_ptr<Core::VertexArray>           m_vao;
+        SvCore::Memory::ConcurrentObjectPool<Core::Buffers::VertexBuffer>::Ptr m_vbo;
+        SvCore::Memory::ConcurrentObjectPool<Core::Buffers::IndexBuffer>::Ptr  m_ebo;
+        SvCore::Memory::ConcurrentObjectPool<Core::VertexArray>::Ptr           m_vao;
     };
 }
@@ -67,6 +67,12 @@ namespace SvRendering::Resources
          */
         bool Init() override;
 
+        /**
+         * \brief Gets the memory held by the model's meshes
+         * \return The model's CPU memory footprint in bytes
+         */
+        size_t GetMemorySize() const override;
+
         /**
          * \brief Gets the model's mesh at the given index
          * \return The model's mesh at the given index
@@ -4,6 +4,8 @@
 #include "SurvivantRendering/Enums/ETextureFilter.h"
 #include "SurvivantRendering/Enums/ETextureFormat.h"
 #include "SurvivantRendering/Enums/ETextureWrapMode.h"
+#include "SurvivantRendering/Resources/TextureMip.h"
+#include "SurvivantRendering/Utility/MipGenerator.h"
 
 #include "Vector/Vector2.h"
 
@@ -67,7 +69,8 @@ namespace SvRendering::Resources
         Texture& operator=(Texture&& p_other) noexcept;
 
         /**
-         * \brief Loads a texture from the given file
+         * \brief Loads a texture from the given file.\n
+         * Cooked textures (.svtex) are loaded with their compressed mip chain
          * \param p_path The texture's file path
          * \return True if the texture was successfully loaded. False otherwise.
          */
@@ -79,6 +82,12 @@ namespace SvRendering::Resources
          */
         bool Init() override;
 
+        /**
+         * \brief Gets the memory held by the texture's loaded pixels and mips
+         * \return The texture's CPU memory footprint in bytes
+         */
+        size_t GetMemorySize() const override;
+
         /**
          * \brief Binds the texture to the given slot
          * \param p_slot The slot the texture should be bound to
@@ -92,10 +101,20 @@ namespace SvRendering::Resources
         void Unbind(uint8_t p_slot) const;
 
         /**
-         * \brief Generates the texture's mipmap
+         * \brief Generates the texture's mipmap on the GPU.\n
+         * Does nothing if the texture's mips were precomputed
          */
         void GenerateMipmap();
 
+        /**
+         * \brief Computes the texture's mip chain on the CPU from the loaded pixels.\n
+         * Doesn't need a graphics context so it can run on a loader thread between Load and Init.\n
+         * Only the levels below the base one are stored since the base level is kept in the pixels
+         * \param p_settings The mip generation settings
+         * \return True on success. False otherwise
+         */
+        bool ComputeMips(const Utility::MipGenerationSettings& p_settings = {});
+
         /**
          * \brief Gets the texture's id
          * \return The texture's id
@@ -114,6 +133,18 @@ namespace SvRendering::Resources
          */
         uint8_t GetChannelCount() const;
 
+        /**
+         * \brief Gets the texture's loaded pixels
+         * \return The texture's uncompressed base level pixels. nullptr if none are loaded
+         */
+        const unsigned char* GetPixels() const;
+
+        /**
+         * \brief Gets the texture's pixel format
+         * \return The texture's pixel format
+         */
+        Enums::ETextureFormat GetFormat() const;
+
         /**
          * \brief Sets the texture's minification and magnification filters
          * \param p_minFilter The texture's minification filter
@@ -134,11 +165,20 @@ namespace SvRendering::Resources
         int                     m_width     = 0;
         int                     m_height    = 0;
         uint8_t                 m_channels  = 0;
+        Enums::ETextureFormat   m_format    = Enums::ETextureFormat::RGBA;
+        // Every level of block compressed textures, only the levels below the pixels otherwise
+        std::vector<TextureMip> m_mips;
         Enums::ETextureFilter   m_minFilter = Enums::ETextureFilter::LINEAR;
         Enums::ETextureFilter   m_magFilter = Enums::ETextureFilter::LINEAR;
         Enums::ETextureWrapMode m_wrapModeS = Enums::ETextureWrapMode::REPEAT;
         Enums::ETextureWrapMode m_wrapModeT = Enums::ETextureWrapMode::REPEAT;
 
         void Copy(const Texture& p_other);
+
+        /**
+         * \brief Uploads the texture's compressed mip chain
+         * \return True on success. False otherwise
+         */
+        bool InitCompressed();
     };
 }
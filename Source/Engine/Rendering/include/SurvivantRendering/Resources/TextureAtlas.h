@@ -0,0 +1,200 @@
+#pragma once
+#include "SurvivantRendering/Enums/EAtlasLayout.h"
+#include "SurvivantRendering/Enums/ETextureFilter.h"
+#include "SurvivantRendering/Resources/Texture.h"
+#include "SurvivantRendering/Resources/TextureMip.h"
+#include "SurvivantRendering/Utility/MipGenerator.h"
+#include "SurvivantRendering/Utility/SkylinePacker.h"
+
+#include "Vector/Vector2.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SvRendering::Resources
+{
+    /**
+     * \brief The location of a packed texture inside its atlas.\n
+     * Remap a texture coordinate with `uv * m_uvScale + m_uvOffset`, then sample page/layer `m_page`
+     */
+    struct AtlasRegion
+    {
+        LibMath::Vector2 m_uvOffset;
+        LibMath::Vector2 m_uvScale;
+        uint32_t         m_page = 0;
+    };
+
+    struct TextureAtlasSettings
+    {
+        Enums::EAtlasLayout m_layout   = Enums::EAtlasLayout::ARRAY;
+        int                 m_pageSize = 2048;
+
+        /**
+         * \brief The border, in texels, duplicated around each packed texture to avoid filtering bleed.\n
+         * Mips are only kept while the border is at least one texel wide
+         */
+        int m_padding = 4;
+
+        bool                           m_generateMips = true;
+        Utility::MipGenerationSettings m_mipSettings;
+    };
+
+    /**
+     * \brief Packs many small textures into a few RGBA8 pages so draws differing only by texture can share one binding.\n
+     * In the ARRAY layout every page is a layer of a single GL_TEXTURE_2D_ARRAY. In the PAGES layout every page is its
+     * own GL_TEXTURE_2D
+     */
+    class TextureAtlas
+    {
+    public:
+        static constexpr size_t INVALID_REGION = static_cast<size_t>(-1);
+
+        /**
+         * \brief Creates an empty texture atlas with the given settings
+         * \param p_settings The atlas' settings
+         */
+        explicit TextureAtlas(const TextureAtlasSettings& p_settings = {});
+
+        /**
+         * \brief Disable texture atlas copying
+         */
+        TextureAtlas(const TextureAtlas& p_other) = delete;
+
+        /**
+         * \brief Creates a move copy of the given texture atlas
+         * \param p_other The moved texture atlas
+         */
+        TextureAtlas(TextureAtlas&& p_other) noexcept;
+
+        /**
+         * \brief Releases resources allocated for the texture atlas
+         */
+        ~TextureAtlas();
+
+        /**
+         * \brief Disable texture atlas copying
+         */
+        TextureAtlas& operator=(const TextureAtlas& p_other) = delete;
+
+        /**
+         * \brief Moves the given texture atlas into this one
+         * \param p_other The moved texture atlas
+         * \return A reference to the modified texture atlas
+         */
+        TextureAtlas& operator=(TextureAtlas&& p_other) noexcept;
+
+        /**
+         * \brief Packs the given image in the atlas.\n
+         * Packing is online so adding the largest images first gives denser pages
+         * \param p_pixels The image's pixels
+         * \param p_width The image's width
+         * \param p_height The image's height
+         * \param p_channels The image's number of channels (1-4)
+         * \return The packed image's region index. INVALID_REGION on failure
+         */
+        size_t Add(const uint8_t* p_pixels, int p_width, int p_height, uint8_t p_channels);
+
+        /**
+         * \brief Packs the given loaded texture in the atlas
+         * \param p_texture The texture to pack. Must have been loaded from an uncompressed image
+         * \return The packed texture's region index. INVALID_REGION on failure
+         */
+        size_t Add(const Texture& p_texture);
+
+        /**
+         * \brief Uploads the atlas' pages to the GPU and releases their pixels
+         * \return True on success. False otherwise
+         */
+        bool Init();
+
+        /**
+         * \brief Binds the given atlas page to the given slot
+         * \param p_slot The slot the page should be bound to
+         * \param p_page The page to bind. Ignored in the ARRAY layout
+         */
+        void Bind(uint8_t p_slot, uint32_t p_page = 0) const;
+
+        /**
+         * \brief Unbinds the current atlas page from the given slot
+         * \param p_slot The slot the page is bound to
+         */
+        void Unbind(uint8_t p_slot) const;
+
+        /**
+         * \brief Gets the region of the packed texture with the given index
+         * \param p_index The packed texture's region index
+         * \return The packed texture's region
+         */
+        const AtlasRegion& GetRegion(size_t p_index) const;
+
+        /**
+         * \brief Gets the number of packed textures
+         * \return The number of regions in the atlas
+         */
+        size_t GetRegionCount() const;
+
+        /**
+         * \brief Gets the number of pages in the atlas
+         * \return The atlas' page count
+         */
+        uint32_t GetPageCount() const;
+
+        /**
+         * \brief Gets the opengl id of the given page
+         * \param p_page The page's index. Ignored in the ARRAY layout
+         * \return The page's texture id
+         */
+        uint32_t GetId(uint32_t p_page = 0) const;
+
+        /**
+         * \brief Gets the atlas' layout
+         * \return The atlas' layout
+         */
+        Enums::EAtlasLayout GetLayout() const;
+
+        /**
+         * \brief Sets the pages' minification and magnification filters
+         * \param p_minFilter The pages' minification filter
+         * \param p_magFilter The pages' magnification filter
+         */
+        void SetFilters(Enums::ETextureFilter p_minFilter, Enums::ETextureFilter p_magFilter);
+
+    private:
+        struct Page
+        {
+            Utility::SkylinePacker m_packer;
+            std::vector<uint8_t>   m_pixels;
+        };
+
+        TextureAtlasSettings     m_settings;
+        std::vector<Page>        m_pages;
+        std::vector<AtlasRegion> m_regions;
+        std::vector<uint32_t>    m_ids;
+        Enums::ETextureFilter    m_minFilter = Enums::ETextureFilter::LINEAR_MIPMAP_LINEAR;
+        Enums::ETextureFilter    m_magFilter = Enums::ETextureFilter::LINEAR;
+
+        /**
+         * \brief Copies the given image in the given page, extending its edges over the padding
+         * \param p_page The target page
+         * \param p_position The padded rectangle's bottom left corner
+         * \param p_pixels The image's pixels
+         * \param p_width The image's width
+         * \param p_height The image's height
+         * \param p_channels The image's number of channels
+         */
+        void Blit(Page& p_page, LibMath::Vector2I p_position, const uint8_t* p_pixels, int p_width, int p_height,
+                  uint8_t p_channels) const;
+
+        /**
+         * \brief Builds the mip chain uploaded for the given page
+         * \param p_page The page to build the mip chain of
+         * \return The page's mip chain
+         */
+        std::vector<TextureMip> BuildMips(const Page& p_page) const;
+
+        /**
+         * \brief Releases the atlas' opengl textures
+         */
+        void Release();
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "SurvivantRendering/Enums/ETextureFormat.h"
+#include "SurvivantRendering/Resources/TextureMip.h"
+#include "SurvivantRendering/Utility/MipGenerator.h"
+
+#include <string>
+#include <vector>
+
+namespace SvRendering::Resources
+{
+    constexpr const char* SV_COOKED_TEXTURE_EXTENSION = ".svtex";
+
+    /**
+     * \brief Checks whether the given path points to a cooked texture file
+     * \param p_path The path to check
+     * \return True if the path has the cooked texture extension. False otherwise
+     */
+    bool IsCookedTexture(const std::string& p_path);
+
+    /**
+     * \brief Converts the given source image to a block compressed texture with its full mip chain
+     * and saves the result at the given output path
+     * \param p_sourcePath The source image's path (any format supported by stb_image)
+     * \param p_outputPath The cooked texture's output path
+     * \param p_format The target block compressed format (BC1, BC3, BC4, BC5 or BC7)
+     * \param p_generateMips Whether the mip chain should be generated or only the base level
+     * \param p_mipSettings The settings used to generate the mip chain
+     * \return True on success. False otherwise
+     */
+    bool CookTexture(const std::string& p_sourcePath, const std::string& p_outputPath, Enums::ETextureFormat p_format,
+                     bool p_generateMips = true, const Utility::MipGenerationSettings& p_mipSettings = {});
+
+    /**
+     * \brief Saves the given compressed mip chain in the cooked texture container
+     * \param p_path The output file's path
+     * \param p_format The mips' block compressed format
+     * \param p_mips The mip chain to save, starting with the base level
+     * \return True on success. False otherwise
+     */
+    bool SaveCookedTexture(const std::string& p_path, Enums::ETextureFormat p_format, const std::vector<TextureMip>& p_mips);
+
+    /**
+     * \brief Loads the compressed mip chain from the given cooked texture file
+     * \param p_path The cooked texture's path
+     * \param p_format The output block compressed format
+     * \param p_mips The output mip chain, starting with the base level
+     * \return True on success. False otherwise
+     */
+    bool LoadCookedTexture(const std::string& p_path, Enums::ETextureFormat& p_format, std::vector<TextureMip>& p_mips);
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace SvRendering::Resources
+{
+    struct TextureMip
+    {
+        std::vector<uint8_t> m_data;
+        int                  m_width  = 0;
+        int                  m_height = 0;
+    };
+}
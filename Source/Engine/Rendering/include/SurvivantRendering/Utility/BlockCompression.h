@@ -0,0 +1,84 @@
+#pragma once
+#include "SurvivantRendering/Enums/ETextureFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SvRendering::Utility
+{
+    constexpr uint8_t BC_BLOCK_DIM         = 4;
+    constexpr uint8_t BC_BLOCK_TEXEL_COUNT = BC_BLOCK_DIM * BC_BLOCK_DIM;
+
+    /**
+     * \brief Checks whether the given texture format is a block compressed format
+     * \param p_format The texture format to check
+     * \return True if the format is block compressed. False otherwise
+     */
+    bool IsBlockCompressed(Enums::ETextureFormat p_format);
+
+    /**
+     * \brief Gets the size of a single 4x4 block in the given format
+     * \param p_format The target block compressed format
+     * \return The size in bytes of one block. 0 if the format isn't block compressed
+     */
+    uint8_t GetBlockSize(Enums::ETextureFormat p_format);
+
+    /**
+     * \brief Computes the size of an image of the given dimensions in the given block compressed format
+     * \param p_format The target block compressed format
+     * \param p_width The image's width in pixels
+     * \param p_height The image's height in pixels
+     * \return The size of the compressed image in bytes
+     */
+    size_t GetCompressedSize(Enums::ETextureFormat p_format, int p_width, int p_height);
+
+    /**
+     * \brief Encodes a 4x4 block of RGBA8 texels as an opaque BC1 block (8 bytes)
+     * \param p_rgba The block's 16 RGBA8 texels in row order
+     * \param p_output The output block
+     */
+    void EncodeBC1Block(const uint8_t* p_rgba, uint8_t* p_output);
+
+    /**
+     * \brief Encodes a 4x4 block of RGBA8 texels as a BC3 block (16 bytes)
+     * \param p_rgba The block's 16 RGBA8 texels in row order
+     * \param p_output The output block
+     */
+    void EncodeBC3Block(const uint8_t* p_rgba, uint8_t* p_output);
+
+    /**
+     * \brief Encodes one channel of a 4x4 block of RGBA8 texels as a BC4 block (8 bytes)
+     * \param p_rgba The block's 16 RGBA8 texels in row order
+     * \param p_channel The index of the channel to encode (0-3)
+     * \param p_output The output block
+     */
+    void EncodeBC4Block(const uint8_t* p_rgba, uint8_t p_channel, uint8_t* p_output);
+
+    /**
+     * \brief Encodes the red and green channels of a 4x4 block of RGBA8 texels as a BC5 block (16 bytes)
+     * \param p_rgba The block's 16 RGBA8 texels in row order
+     * \param p_output The output block
+     */
+    void EncodeBC5Block(const uint8_t* p_rgba, uint8_t* p_output);
+
+    /**
+     * \brief Encodes a 4x4 block of RGBA8 texels as a BC7 block (16 bytes) using mode 6
+     * \param p_rgba The block's 16 RGBA8 texels in row order
+     * \param p_output The output block
+     */
+    void EncodeBC7Block(const uint8_t* p_rgba, uint8_t* p_output);
+
+    /**
+     * \brief Compresses the given image to the given block compressed format.\n
+     * Rows of blocks are encoded in parallel
+     * \param p_pixels The source image's pixels
+     * \param p_width The source image's width
+     * \param p_height The source image's height
+     * \param p_channels The source image's number of channels (1-4)
+     * \param p_format The target block compressed format
+     * \return The compressed image data. Empty on failure
+     */
+    std::vector<uint8_t> CompressImage(const uint8_t* p_pixels, int p_width, int p_height, uint8_t p_channels,
+                                       Enums::ETextureFormat p_format);
+}
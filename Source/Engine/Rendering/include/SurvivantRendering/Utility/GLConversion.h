@@ -0,0 +1,20 @@
+#pragma once
+#include "SurvivantRendering/Enums/ETextureFilter.h"
+#include "SurvivantRendering/Enums/ETextureWrapMode.h"
+
+namespace SvRendering::Utility
+{
+    /**
+     * \brief Converts the given texture filter to its OpenGL value
+     * \param p_filter The texture filter to convert
+     * \return The filter's OpenGL value. GL_INVALID_ENUM if the filter is invalid
+     */
+    int ToGLInt(Enums::ETextureFilter p_filter);
+
+    /**
+     * \brief Converts the given texture wrap mode to its OpenGL value
+     * \param p_wrapMode The wrap mode to convert
+     * \return The wrap mode's OpenGL value. GL_INVALID_ENUM if the wrap mode is invalid
+     */
+    int ToGLInt(Enums::ETextureWrapMode p_wrapMode);
+}
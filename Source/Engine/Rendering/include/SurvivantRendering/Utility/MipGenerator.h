@@ -0,0 +1,40 @@
+#pragma once
+#include "SurvivantRendering/Enums/EMipFilter.h"
+#include "SurvivantRendering/Resources/TextureMip.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SvRendering::Utility
+{
+    struct MipGenerationSettings
+    {
+        Enums::EMipFilter m_filter = Enums::EMipFilter::BOX;
+
+        /**
+         * \brief Whether the color channels are sRGB encoded and should be filtered in linear space.
+         * Only applies to RGB and RGBA images
+         */
+        bool m_isSrgb = true;
+
+        /**
+         * \brief Whether the alpha of each mip should be rescaled to keep the base level's alpha test coverage
+         */
+        bool  m_preserveAlphaCoverage = false;
+        float m_alphaCutoff           = .5f;
+    };
+
+    /**
+     * \brief Generates the full mip chain of the given 8 bits per channel image on the CPU.\n
+     * Safe to call from any thread since it doesn't need a graphics context.\n
+     * Odd sizes are halved with a 3 texel box filter, whatever the filter setting, so the last row or column is kept
+     * \param p_pixels The base level's pixels
+     * \param p_width The base level's width
+     * \param p_height The base level's height
+     * \param p_channels The image's number of channels (1-4). The 4th channel is treated as alpha
+     * \param p_settings The mip generation settings
+     * \return The mip chain, starting with a copy of the base level and ending with the 1x1 level
+     */
+    std::vector<Resources::TextureMip> GenerateMips(const uint8_t* p_pixels, int p_width, int p_height, uint8_t p_channels,
+                                                    const MipGenerationSettings& p_settings = {});
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "Vector/Vector2.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SvRendering::Utility
+{
+    /**
+     * \brief Online rectangle packer using the skyline bottom-left heuristic
+     */
+    class SkylinePacker
+    {
+    public:
+        /**
+         * \brief Creates a packer for a bin of the given dimensions
+         * \param p_width The bin's width
+         * \param p_height The bin's height
+         */
+        SkylinePacker(int p_width, int p_height);
+
+        /**
+         * \brief Finds a free spot for a rectangle of the given dimensions and reserves it
+         * \param p_width The rectangle's width
+         * \param p_height The rectangle's height
+         * \param p_position The output position of the rectangle's bottom left corner
+         * \return True if the rectangle fits in the bin. False otherwise
+         */
+        bool Insert(int p_width, int p_height, LibMath::Vector2I& p_position);
+
+        /**
+         * \brief Frees all the reserved space
+         */
+        void Clear();
+
+        /**
+         * \brief Gets the ratio of the bin's area used by the packed rectangles
+         * \return The bin's occupancy between 0 and 1
+         */
+        float GetOccupancy() const;
+
+    private:
+        struct Node
+        {
+            int m_x;
+            int m_y;
+            int m_width;
+        };
+
+        std::vector<Node> m_skyline;
+        int               m_width;
+        int               m_height;
+        int64_t           m_usedArea = 0;
+
+        /**
+         * \brief Computes the lowest height at which a rectangle starting at the given skyline node fits
+         * \param p_index The index of the skyline node the rectangle starts at
+         * \param p_width The rectangle's width
+         * \param p_height The rectangle's height
+         * \param p_y The output height of the rectangle's bottom edge
+         * \return True if the rectangle fits. False otherwise
+         */
+        bool Fit(size_t p_index, int p_width, int p_height, int& p_y) const;
+
+        /**
+         * \brief Raises the skyline over the given rectangle
+         * \param p_index The index of the skyline node the rectangle starts at
+         * \param p_x The rectangle's left edge
+         * \param p_y The rectangle's bottom edge
+         * \param p_width The rectangle's width
+         * \param p_height The rectangle's height
+         */
+        void AddLevel(size_t p_index, int p_x, int p_y, int p_width, int p_height);
+    };
+}
@@ -1,5 +1,7 @@
 #include "SurvivantRendering/Core/Camera.h"
 
+#include "SurvivantRendering/Core/GpuProfiler.h"
+
 #include <glad/gl.h>
 
 namespace SvRendering::Core
@@ -34,6 +36,8 @@ namespace SvRendering::Core
 
     void Camera::Clear() const
     {
+        SV_GPU_PROFILE_SCOPE("Clear");
+
         glClearColor(m_clearColor.m_r, m_clearColor.m_g, m_clearColor.m_b, m_clearColor.m_a);
 
         bool clearColor, clearDepth, clearStencil;
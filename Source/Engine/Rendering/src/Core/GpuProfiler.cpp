@@ -0,0 +1,214 @@
+#include "SurvivantRendering/Core/GpuProfiler.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+
+#include <glad/gl.h>
+
+#include <algorithm>
+
+using namespace SvCore::Debug;
+
+namespace SvRendering::Core
+{
+    namespace
+    {
+        constexpr uint32_t NO_QUERY         = UINT32_MAX;
+        constexpr GLsizei  QUERY_BATCH_SIZE = 32;
+    }
+
+    GpuZone::GpuZone(const char* p_name)
+        : m_isRecording(GpuProfiler::GetInstance().BeginZone(p_name))
+    {
+    }
+
+    GpuZone::~GpuZone()
+    {
+        if (m_isRecording)
+            GpuProfiler::GetInstance().EndZone();
+    }
+
+    bool GpuProfiler::Initialize()
+    {
+        Shutdown();
+
+        // Software implementations may not expose the queries, or expose them without a timer
+        m_isSupported = GLAD_GL_VERSION_3_3 && glQueryCounter && glGetQueryObjectui64v && glGetInteger64v;
+
+        if (m_isSupported)
+        {
+            GLint counterBits = 0;
+            glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+            m_isSupported = counterBits > 0;
+        }
+
+        if (!m_isSupported)
+        {
+            SV_LOG_WARNING("GPU timestamp queries aren't supported - GPU profiling is disabled");
+            return false;
+        }
+
+        if (m_track == UINT32_MAX)
+            m_track = Profiler::GetInstance().AddTrack("GPU");
+
+        m_frameIndex = 0;
+        BeginFrame(m_frames[0]);
+
+        return true;
+    }
+
+    void GpuProfiler::Shutdown()
+    {
+        for (Frame& frame : m_frames)
+        {
+            if (!frame.m_queries.empty())
+                glDeleteQueries(static_cast<GLsizei>(frame.m_queries.size()), frame.m_queries.data());
+
+            frame.m_queries.clear();
+            frame.m_zones.clear();
+            frame.m_queryCount = 0;
+        }
+
+        m_openZones.clear();
+        m_isSupported = false;
+    }
+
+    bool GpuProfiler::IsSupported() const
+    {
+        return m_isSupported;
+    }
+
+    void GpuProfiler::EndFrame()
+    {
+        if (!m_isSupported)
+            return;
+
+        if (!CHECK(m_openZones.empty(), "GPU profiler frame ended with %zu open zones", m_openZones.size()))
+        {
+            Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+
+            for (const size_t zone : m_openZones)
+                frame.m_zones[zone].m_endQuery = NO_QUERY;
+
+            m_openZones.clear();
+        }
+
+        Frame& oldestFrame = m_frames[++m_frameIndex % FRAME_LATENCY];
+
+        if (oldestFrame.m_queryCount > 0 && !Resolve(oldestFrame))
+            ++m_skippedFrameCount;
+
+        BeginFrame(oldestFrame);
+    }
+
+    double GpuProfiler::GetFrameTime() const
+    {
+        return m_frameTime;
+    }
+
+    size_t GpuProfiler::GetSkippedFrameCount() const
+    {
+        return m_skippedFrameCount;
+    }
+
+    GpuProfiler& GpuProfiler::GetInstance()
+    {
+        static GpuProfiler instance;
+        return instance;
+    }
+
+    bool GpuProfiler::BeginZone(const char* p_name)
+    {
+        if (!m_isSupported || !Profiler::IsEnabled())
+            return false;
+
+        Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+
+        if (frame.m_zones.size() >= MAX_FRAME_ZONES || m_openZones.size() >= MAX_ZONE_DEPTH)
+            return false;
+
+        m_openZones.push_back(frame.m_zones.size());
+        frame.m_zones.push_back({ p_name, IssueTimestamp(), NO_QUERY, static_cast<uint32_t>(m_openZones.size() - 1) });
+
+        return true;
+    }
+
+    void GpuProfiler::EndZone()
+    {
+        // The zone was dropped by an unbalanced frame end
+        if (m_openZones.empty())
+            return;
+
+        Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+
+        frame.m_zones[m_openZones.back()].m_endQuery = IssueTimestamp();
+        m_openZones.pop_back();
+    }
+
+    uint32_t GpuProfiler::IssueTimestamp()
+    {
+        Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+
+        if (frame.m_queryCount == frame.m_queries.size())
+        {
+            frame.m_queries.resize(frame.m_queries.size() + QUERY_BATCH_SIZE);
+            glGenQueries(QUERY_BATCH_SIZE, frame.m_queries.data() + frame.m_queryCount);
+        }
+
+        glQueryCounter(frame.m_queries[frame.m_queryCount], GL_TIMESTAMP);
+        return static_cast<uint32_t>(frame.m_queryCount++);
+    }
+
+    void GpuProfiler::BeginFrame(Frame& p_frame) const
+    {
+        p_frame.m_zones.clear();
+        p_frame.m_queryCount = 0;
+
+        // Reading the GPU clock doesn't wait for the queued commands
+        GLint64 gpuTime = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+
+        p_frame.m_gpuReference = gpuTime;
+        p_frame.m_cpuReference = Profiler::GetTimestamp();
+    }
+
+    bool GpuProfiler::Resolve(Frame& p_frame)
+    {
+        // Timestamps are written in order - if the last one is available, every one is
+        GLint isAvailable = GL_FALSE;
+        glGetQueryObjectiv(p_frame.m_queries[p_frame.m_queryCount - 1], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+
+        if (!isAvailable)
+            return false;
+
+        Profiler& profiler = Profiler::GetInstance();
+
+        const auto toCpuTicks = [&p_frame, &profiler](const GLuint64 p_gpuTime)
+        {
+            const double elapsedMs = static_cast<double>(static_cast<int64_t>(p_gpuTime) - p_frame.m_gpuReference) / 1e6;
+            return p_frame.m_cpuReference + static_cast<uint64_t>(profiler.ToTicks(elapsedMs));
+        };
+
+        GLuint64 frameStart = UINT64_MAX;
+        GLuint64 frameEnd   = 0;
+
+        for (const Zone& zone : p_frame.m_zones)
+        {
+            if (zone.m_endQuery == NO_QUERY)
+                continue;
+
+            GLuint64 start = 0, end = 0;
+            glGetQueryObjectui64v(p_frame.m_queries[zone.m_startQuery], GL_QUERY_RESULT, &start);
+            glGetQueryObjectui64v(p_frame.m_queries[zone.m_endQuery], GL_QUERY_RESULT, &end);
+
+            profiler.RecordEvent(m_track, zone.m_name, toCpuTicks(start), toCpuTicks(end), zone.m_depth);
+
+            frameStart = std::min(frameStart, start);
+            frameEnd   = std::max(frameEnd, end);
+        }
+
+        if (frameEnd > frameStart)
+            m_frameTime = static_cast<double>(frameEnd - frameStart) / 1e6;
+
+        return true;
+    }
+}
@@ -1,8 +1,15 @@
 #include "SurvivantRendering/Resources/Material.h"
+#include "SurvivantRendering/Resources/Texture.h"
 #include "SurvivantCore/Debug/Logger.h"
+#include "SurvivantCore/Resources/ResourceLoader.h"
 
 #include <fstream>
 
+Material::Material()
+    : m_ambientColor{ 1.f, 1.f, 1.f }, m_diffuseColor{ 1.f, 1.f, 1.f }, m_specularColor{ 1.f, 1.f, 1.f }, m_shininess(0.f)
+{
+}
+
 bool Material::Load(const std::string& filename) 
 {
     // Opening the materials file
@@ -30,6 +37,24 @@ bool Material::Load(const std::string& filename)
     return true;
 }
 
+bool Material::Init()
+{
+    return true;
+}
+
+std::vector<SvCore::Resources::LoadTicket> Material::LoadDependencies(SvCore::Resources::ResourceLoader& p_loader)
+{
+    std::vector<SvCore::Resources::LoadTicket> textures;
+
+    for (const std::string* path : { &m_diffuseTexture, &m_specularTexture, &m_normalTexture })
+    {
+        if (!path->empty())
+            textures.push_back(p_loader.LoadAsync<SvRendering::Resources::Texture>(*path));
+    }
+
+    return textures;
+}
+
 void Material::SetDiffuseTexture(const std::string& filename) 
 {
     // Checking if the path is absolute
@@ -88,6 +113,21 @@ void Material::SetSpecularColor(float r, float g, float b) {
     m_specularColor[2] = b;
 }
 
+const std::string& Material::GetDiffuseTexture() const
+{
+    return m_diffuseTexture;
+}
+
+const std::string& Material::GetSpecularTexture() const
+{
+    return m_specularTexture;
+}
+
+const std::string& Material::GetNormalTexture() const
+{
+    return m_normalTexture;
+}
+
 void Material::SetShininess(float shininess) 
 {
     // Dfinir la brillance
@@ -1,12 +1,35 @@
 #include "SurvivantRendering/Resources/Mesh.h"
 
 using namespace LibMath;
+using namespace SvCore::Memory;
 using namespace SvRendering::Core;
 using namespace SvRendering::Core::Buffers;
 using namespace SvRendering::Geometry;
 
 namespace SvRendering::Resources
 {
+    namespace
+    {
+        // Never destroyed - meshes owned by other singletons can outlive them
+        ConcurrentObjectPool<VertexBuffer>& GetVertexBufferPool()
+        {
+            static auto* pool = new ConcurrentObjectPool<VertexBuffer>("VertexBuffer");
+            return *pool;
+        }
+
+        ConcurrentObjectPool<IndexBuffer>& GetIndexBufferPool()
+        {
+            static auto* pool = new ConcurrentObjectPool<IndexBuffer>("IndexBuffer");
+            return *pool;
+        }
+
+        ConcurrentObjectPool<VertexArray>& GetVertexArrayPool()
+        {
+            static auto* pool = new ConcurrentObjectPool<VertexArray>("VertexArray");
+            return *pool;
+        }
+    }
+
     Mesh::Mesh(std::vector<Vertex> vertices, std::vector<uint32_t> indices)
         : m_vertices(std::move(vertices)), m_indices(std::move(indices))
     {
@@ -44,9 +67,12 @@ namespace SvRendering::Resources
 
     bool Mesh::Init()
     {
-        m_vbo = std::make_unique<VertexBuffer>(m_vertices);
-        m_ebo = std::make_unique<IndexBuffer>(m_indices);
-        m_vao = std::make_unique<VertexArray>(*m_vbo, *m_ebo);
+        // Release the previous vertex array before the buffers it references
+        m_vao.reset();
+
+        m_vbo = GetVertexBufferPool().MakeUnique(m_vertices);
+        m_ebo = GetIndexBufferPool().MakeUnique(m_indices);
+        m_vao = GetVertexArrayPool().MakeUnique(*m_vbo, *m_ebo);
 
         return true;
     }
@@ -72,4 +98,9 @@ namespace SvRendering::Resources
     {
         return m_boundingBox;
     }
+
+    size_t Mesh::GetMemorySize() const
+    {
+        return m_vertices.size() * sizeof(Vertex) + m_indices.size() * sizeof(uint32_t);
+    }
 }
@@ -2,6 +2,8 @@
 
 #include <SurvivantCore/Debug/Assertion.h>
 #include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/Memory/MemoryTracker.h>
+#include <SurvivantCore/Memory/ScratchArena.h>
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -37,6 +39,8 @@ namespace SvRendering::Resources
 
     bool Model::Load(const std::string& p_path)
     {
+        SV_MEMORY_TAG(SvCore::Enums::EMemoryTag::MESHES);
+
         Assimp::Importer importer;
         importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE,
             aiPrimitiveType_POINT | aiPrimitiveType_LINE | aiPrimitiveType_POLYGON);
@@ -72,8 +76,11 @@ namespace SvRendering::Resources
             if (!mesh || mesh->mNumVertices == 0)
                 continue;
 
-            std::vector<Vertex> vertices;
-            vertices.reserve(vertices.size() + mesh->mNumVertices);
+            // Built in the thread's scratch buffer, the mesh keeps exactly sized copies
+            const SvCore::Memory::ScratchArena scratch;
+
+            std::pmr::vector<Vertex> vertices(scratch.GetResource());
+            vertices.reserve(mesh->mNumVertices);
 
             for (unsigned int idx = 0; idx < mesh->mNumVertices; ++idx)
             {
@@ -86,7 +93,7 @@ namespace SvRendering::Resources
                 vertices.emplace_back(position, normal, Vector2(uv.x, uv.y), tangent, bitangent);
             }
 
-            std::vector<uint32_t> indices;
+            std::pmr::vector<uint32_t> indices(scratch.GetResource());
             indices.reserve(static_cast<size_t>(mesh->mNumFaces) * 3);
             for (unsigned int faceIdx = 0; faceIdx < mesh->mNumFaces; ++faceIdx)
             {
@@ -97,7 +104,8 @@ namespace SvRendering::Resources
                 indices.push_back(face.mIndices[2]);
             }
 
-            const Mesh& newMesh = m_meshes.emplace_back(vertices, indices);
+            const Mesh& newMesh = m_meshes.emplace_back(std::vector<Vertex>(vertices.begin(), vertices.end()),
+                std::vector<uint32_t>(indices.begin(), indices.end()));
             m_boundingBox.m_min = min(m_boundingBox.m_min, newMesh.GetBoundingBox().m_min);
             m_boundingBox.m_max = max(m_boundingBox.m_max, newMesh.GetBoundingBox().m_max);
         }
@@ -127,6 +135,16 @@ namespace SvRendering::Resources
         return m_meshes.size();
     }
 
+    size_t Model::GetMemorySize() const
+    {
+        size_t size = 0;
+
+        for (const Mesh& mesh : m_meshes)
+            size += mesh.GetMemorySize();
+
+        return size;
+    }
+
     BoundingBox Model::GetBoundingBox() const
     {
         return m_boundingBox;
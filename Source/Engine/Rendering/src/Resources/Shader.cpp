@@ -8,6 +8,7 @@
 
 #include <SurvivantCore/Debug/Assertion.h>
 #include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/Memory/MemoryTracker.h>
 #include <SurvivantCore/Utility/Utility.h>
 
 using namespace SvCore::Utility;
@@ -67,6 +68,8 @@ namespace SvRendering::Resources
 
     bool Shader::Load(const std::string& p_path)
     {
+        SV_MEMORY_TAG(SvCore::Enums::EMemoryTag::SHADERS);
+
         Reset();
         m_source.clear();
 
@@ -1,57 +1,38 @@
 #include "SurvivantRendering/Resources/texture.h"
 
+#include "SurvivantRendering/Resources/TextureCooker.h"
+#include "SurvivantRendering/Utility/BlockCompression.h"
+#include "SurvivantRendering/Utility/GLConversion.h"
+
 #include <SurvivantCore/Debug/Assertion.h>
 #include <SurvivantCore/Debug/Logger.h>
+#include <SurvivantCore/Memory/MemoryTracker.h>
 
 #include <glad/gl.h>
 
+// Route the decoded pixels through the memory tracker
+#define STBI_MALLOC(size)           SvCore::Memory::MemoryTracker::Allocate(size, alignof(std::max_align_t), \
+                                        SvCore::Enums::EMemoryTag::TEXTURES)
+#define STBI_REALLOC(pointer, size) SvCore::Memory::MemoryTracker::Reallocate(pointer, size)
+#define STBI_FREE(pointer)          SvCore::Memory::MemoryTracker::Free(pointer)
+
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+// S3TC is exposed through an extension which isn't part of the generated loader
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif // !GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif // !GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+
 using namespace SvRendering::Enums;
+using namespace SvRendering::Utility;
 
 namespace SvRendering::Resources
 {
-    GLint ToGLInt(const ETextureFilter p_filter)
-    {
-        switch (p_filter)
-        {
-        case ETextureFilter::NEAREST:
-            return GL_NEAREST;
-        case ETextureFilter::LINEAR:
-            return GL_LINEAR;
-        case ETextureFilter::NEAREST_MIPMAP_NEAREST:
-            return GL_NEAREST_MIPMAP_NEAREST;
-        case ETextureFilter::LINEAR_MIPMAP_NEAREST:
-            return GL_LINEAR_MIPMAP_NEAREST;
-        case ETextureFilter::NEAREST_MIPMAP_LINEAR:
-            return GL_NEAREST_MIPMAP_LINEAR;
-        case ETextureFilter::LINEAR_MIPMAP_LINEAR:
-            return GL_LINEAR_MIPMAP_LINEAR;
-        default:
-            ASSERT(false, "Invalid texture filter");
-            return GL_INVALID_ENUM;
-        }
-    }
-
-    GLint ToGLInt(const ETextureWrapMode p_wrapMode)
-    {
-        switch (p_wrapMode)
-        {
-        case ETextureWrapMode::REPEAT:
-            return GL_REPEAT;
-        case ETextureWrapMode::MIRRORED_REPEAT:
-            return GL_MIRRORED_REPEAT;
-        case ETextureWrapMode::CLAMP_TO_EDGE:
-            return GL_CLAMP_TO_EDGE;
-        case ETextureWrapMode::CLAMP_TO_BORDER:
-            return GL_CLAMP_TO_BORDER;
-        default:
-            ASSERT(false, "Invalid wrap mode");
-            return GL_INVALID_ENUM;
-        }
-    }
-
     GLenum ToGLEnum(const ETextureFormat p_format)
     {
         switch (p_format)
@@ -74,6 +55,16 @@ namespace SvRendering::Resources
             return GL_DEPTH_COMPONENT;
         case ETextureFormat::DEPTH_STENCIL:
             return GL_DEPTH_STENCIL;
+        case ETextureFormat::BC1:
+            return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case ETextureFormat::BC3:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case ETextureFormat::BC4:
+            return GL_COMPRESSED_RED_RGTC1;
+        case ETextureFormat::BC5:
+            return GL_COMPRESSED_RG_RGTC2;
+        case ETextureFormat::BC7:
+            return GL_COMPRESSED_RGBA_BPTC_UNORM;
         default:
             ASSERT(false, "Invalid texture format");
             return GL_INVALID_ENUM;
@@ -98,6 +89,21 @@ namespace SvRendering::Resources
         }
     }
 
+    ETextureFormat ToTextureFormat(const uint8_t p_channels)
+    {
+        switch (p_channels)
+        {
+        case 1:
+            return ETextureFormat::RED;
+        case 2:
+            return ETextureFormat::RG;
+        case 3:
+            return ETextureFormat::RGB;
+        default:
+            return ETextureFormat::RGBA;
+        }
+    }
+
     uint8_t ToChannelCount(const ETextureFormat p_format)
     {
         switch (p_format)
@@ -105,15 +111,20 @@ namespace SvRendering::Resources
         case ETextureFormat::RED:
         case ETextureFormat::STENCIL_INDEX:
         case ETextureFormat::DEPTH_COMPONENT:
+        case ETextureFormat::BC4:
             return 1;
         case ETextureFormat::RG:
         case ETextureFormat::DEPTH_STENCIL:
+        case ETextureFormat::BC5:
             return 2;
         case ETextureFormat::RGB:
         case ETextureFormat::BGR:
+        case ETextureFormat::BC1:
             return 3;
         case ETextureFormat::RGBA:
         case ETextureFormat::BGRA:
+        case ETextureFormat::BC3:
+        case ETextureFormat::BC7:
             return 4;
         default:
             return 0;
@@ -139,6 +150,7 @@ namespace SvRendering::Resources
         glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(texFormat), m_width, m_height, 0, texFormat, GL_FLOAT, nullptr);
 
         m_channels = ToChannelCount(p_format);
+        m_format   = p_format;
     }
 
     Texture::Texture(const Texture& p_other)
@@ -149,7 +161,7 @@ namespace SvRendering::Resources
 
     Texture::Texture(Texture&& p_other) noexcept
         : IResource(std::forward<IResource&&>(p_other)), m_id(p_other.m_id), m_pixels(p_other.m_pixels), m_width(p_other.m_width),
-        m_height(p_other.m_height), m_channels(p_other.m_channels)
+        m_height(p_other.m_height), m_channels(p_other.m_channels), m_format(p_other.m_format), m_mips(std::move(p_other.m_mips))
     {
         p_other.m_id     = 0;
         p_other.m_pixels = nullptr;
@@ -193,6 +205,8 @@ namespace SvRendering::Resources
         m_height   = p_other.m_height;
         m_channels = p_other.m_channels;
         m_pixels   = p_other.m_pixels;
+        m_format   = p_other.m_format;
+        m_mips     = std::move(p_other.m_mips);
 
         m_minFilter = p_other.m_minFilter;
         m_magFilter = p_other.m_magFilter;
@@ -207,12 +221,31 @@ namespace SvRendering::Resources
 
     bool Texture::Load(const std::string& p_path)
     {
+        SV_MEMORY_TAG(SvCore::Enums::EMemoryTag::TEXTURES);
+
+        stbi_image_free(m_pixels);
+        m_pixels = nullptr;
+        m_mips.clear();
+
+        if (IsCookedTexture(p_path))
+        {
+            if (!LoadCookedTexture(p_path, m_format, m_mips))
+                return false;
+
+            m_width    = m_mips.front().m_width;
+            m_height   = m_mips.front().m_height;
+            m_channels = ToChannelCount(m_format);
+
+            return true;
+        }
+
         stbi_set_flip_vertically_on_load(true);
 
         int channels;
         m_pixels = stbi_load(p_path.c_str(), &m_width, &m_height, &channels, 0);
 
         m_channels = static_cast<uint8_t>(channels);
+        m_format   = ToTextureFormat(m_channels);
 
         if (!m_pixels)
         {
@@ -225,6 +258,9 @@ namespace SvRendering::Resources
 
     bool Texture::Init()
     {
+        if (IsBlockCompressed(m_format))
+            return InitCompressed();
+
         if (!CHECK(m_pixels != nullptr, "Unable to initialize opengl texture - no pixels"))
             return false;
 
@@ -239,10 +275,38 @@ namespace SvRendering::Resources
         glBindTexture(GL_TEXTURE_2D, m_id);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GetGLFormat(m_channels), GL_UNSIGNED_BYTE, m_pixels);
 
+        if (!m_mips.empty())
+        {
+            // Mip rows aren't padded
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+            // The base level is uploaded from the pixels, so the first stored mip is level 1
+            for (size_t i = 0; i < m_mips.size(); ++i)
+            {
+                const TextureMip& mip = m_mips[i];
+
+                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i + 1), GL_RGBA, mip.m_width, mip.m_height, 0,
+                    GetGLFormat(m_channels), GL_UNSIGNED_BYTE, mip.m_data.data());
+            }
+
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(m_mips.size()));
+        }
+
         glBindTexture(GL_TEXTURE_2D, 0);
         return true;
     }
 
+    size_t Texture::GetMemorySize() const
+    {
+        size_t size = m_pixels ? static_cast<size_t>(m_width) * m_height * m_channels : 0;
+
+        for (const TextureMip& mip : m_mips)
+            size += mip.m_data.size();
+
+        return size;
+    }
+
     void Texture::Bind(const uint8_t p_slot) const
     {
         glBindTextureUnit(p_slot, m_id);
@@ -260,9 +324,29 @@ namespace SvRendering::Resources
 
     void Texture::GenerateMipmap()
     {
+        if (!m_mips.empty() || IsBlockCompressed(m_format))
+            return;
+
         glGenerateMipmap(GL_TEXTURE_2D);
     }
 
+    bool Texture::ComputeMips(const MipGenerationSettings& p_settings)
+    {
+        if (!CHECK(m_pixels != nullptr, "Unable to compute texture mips - no pixels"))
+            return false;
+
+        std::vector<TextureMip> mips = GenerateMips(m_pixels, m_width, m_height, m_channels, p_settings);
+
+        if (mips.empty())
+            return false;
+
+        // The base level is already held by the pixels
+        mips.erase(mips.begin());
+        m_mips = std::move(mips);
+
+        return true;
+    }
+
     uint32_t Texture::GetId() const
     {
         return m_id;
@@ -278,6 +362,16 @@ namespace SvRendering::Resources
         return m_channels;
     }
 
+    const unsigned char* Texture::GetPixels() const
+    {
+        return m_pixels;
+    }
+
+    ETextureFormat Texture::GetFormat() const
+    {
+        return m_format;
+    }
+
     void Texture::SetFilters(const ETextureFilter p_minFilter, const ETextureFilter p_magFilter)
     {
         m_minFilter = p_minFilter;
@@ -296,12 +390,24 @@ namespace SvRendering::Resources
         m_width    = p_other.m_width;
         m_height   = p_other.m_height;
         m_channels = p_other.m_channels;
+        m_format   = p_other.m_format;
+        m_mips     = p_other.m_mips;
 
         m_minFilter = p_other.m_minFilter;
         m_magFilter = p_other.m_magFilter;
         m_wrapModeS = p_other.m_wrapModeS;
         m_wrapModeT = p_other.m_wrapModeT;
 
+        if (IsBlockCompressed(m_format))
+        {
+            m_pixels = nullptr;
+
+            if (p_other.m_id != 0)
+                InitCompressed();
+
+            return;
+        }
+
         if (p_other.m_pixels == nullptr)
         {
             m_pixels = nullptr;
@@ -324,4 +430,36 @@ namespace SvRendering::Resources
             m_width, m_height, 1
         );
     }
+
+    bool Texture::InitCompressed()
+    {
+        if (!CHECK(!m_mips.empty(), "Unable to initialize compressed opengl texture - no mips"))
+            return false;
+
+        if (m_id == 0)
+        {
+            glGenTextures(1, &m_id);
+
+            if (!CHECK(m_id != 0, "Unable to generate opengl texture id."))
+                return false;
+        }
+
+        const GLenum internalFormat = ToGLEnum(m_format);
+
+        glBindTexture(GL_TEXTURE_2D, m_id);
+
+        for (size_t level = 0; level < m_mips.size(); ++level)
+        {
+            const TextureMip& mip = m_mips[level];
+
+            glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, mip.m_width, mip.m_height, 0,
+                static_cast<GLsizei>(mip.m_data.size()), mip.m_data.data());
+        }
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(m_mips.size() - 1));
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return true;
+    }
 }
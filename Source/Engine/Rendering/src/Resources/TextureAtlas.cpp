@@ -0,0 +1,285 @@
+#include "SurvivantRendering/Resources/TextureAtlas.h"
+
+#include "SurvivantRendering/Utility/GLConversion.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+
+#include <glad/gl.h>
+
+#include <algorithm>
+#include <bit>
+
+using namespace LibMath;
+using namespace SvRendering::Enums;
+using namespace SvRendering::Utility;
+
+namespace SvRendering::Resources
+{
+    constexpr uint8_t ATLAS_CHANNELS = 4;
+
+    TextureAtlas::TextureAtlas(const TextureAtlasSettings& p_settings)
+        : m_settings(p_settings)
+    {
+        ASSERT(p_settings.m_pageSize > 0, "Invalid texture atlas page size %d", p_settings.m_pageSize);
+        ASSERT(p_settings.m_padding >= 0, "Invalid texture atlas padding %d", p_settings.m_padding);
+    }
+
+    TextureAtlas::TextureAtlas(TextureAtlas&& p_other) noexcept
+        : m_settings(p_other.m_settings), m_pages(std::move(p_other.m_pages)), m_regions(std::move(p_other.m_regions)),
+        m_ids(std::move(p_other.m_ids)), m_minFilter(p_other.m_minFilter), m_magFilter(p_other.m_magFilter)
+    {
+        p_other.m_ids.clear();
+    }
+
+    TextureAtlas::~TextureAtlas()
+    {
+        Release();
+    }
+
+    TextureAtlas& TextureAtlas::operator=(TextureAtlas&& p_other) noexcept
+    {
+        if (&p_other == this)
+            return *this;
+
+        Release();
+
+        m_settings  = p_other.m_settings;
+        m_pages     = std::move(p_other.m_pages);
+        m_regions   = std::move(p_other.m_regions);
+        m_ids       = std::move(p_other.m_ids);
+        m_minFilter = p_other.m_minFilter;
+        m_magFilter = p_other.m_magFilter;
+
+        p_other.m_ids.clear();
+
+        return *this;
+    }
+
+    size_t TextureAtlas::Add(const uint8_t* p_pixels, const int p_width, const int p_height, const uint8_t p_channels)
+    {
+        if (!CHECK(m_ids.empty(), "Unable to add texture to atlas - pages were already uploaded"))
+            return INVALID_REGION;
+
+        if (!CHECK(p_pixels != nullptr && p_channels >= 1 && p_channels <= 4, "Unable to add texture to atlas - invalid image"))
+            return INVALID_REGION;
+
+        if (!CHECK(p_width > 0 && p_height > 0, "Unable to add %dx%d texture to atlas - invalid size",
+                p_width, p_height))
+            return INVALID_REGION;
+
+        const int paddedWidth  = p_width + 2 * m_settings.m_padding;
+        const int paddedHeight = p_height + 2 * m_settings.m_padding;
+
+        if (!CHECK(paddedWidth <= m_settings.m_pageSize && paddedHeight <= m_settings.m_pageSize,
+                "Unable to add %dx%d texture to atlas - larger than a page", p_width, p_height))
+            return INVALID_REGION;
+
+        Vector2I position;
+        uint32_t pageIndex = 0;
+
+        while (pageIndex < m_pages.size() && !m_pages[pageIndex].m_packer.Insert(paddedWidth, paddedHeight, position))
+            ++pageIndex;
+
+        if (pageIndex == m_pages.size())
+        {
+            const size_t pageBytes = static_cast<size_t>(m_settings.m_pageSize) * m_settings.m_pageSize * ATLAS_CHANNELS;
+            m_pages.push_back({ SkylinePacker(m_settings.m_pageSize, m_settings.m_pageSize), std::vector<uint8_t>(pageBytes) });
+
+            if (!m_pages.back().m_packer.Insert(paddedWidth, paddedHeight, position))
+                return INVALID_REGION;
+        }
+
+        Blit(m_pages[pageIndex], position, p_pixels, p_width, p_height, p_channels);
+
+        const float pageSize = static_cast<float>(m_settings.m_pageSize);
+
+        AtlasRegion region;
+        region.m_uvOffset = {
+            static_cast<float>(position.m_x + m_settings.m_padding) / pageSize,
+            static_cast<float>(position.m_y + m_settings.m_padding) / pageSize
+        };
+        region.m_uvScale = { static_cast<float>(p_width) / pageSize, static_cast<float>(p_height) / pageSize };
+        region.m_page    = pageIndex;
+
+        m_regions.push_back(region);
+        return m_regions.size() - 1;
+    }
+
+    size_t TextureAtlas::Add(const Texture& p_texture)
+    {
+        const Vector2I size = p_texture.GetSize();
+        return Add(p_texture.GetPixels(), size.m_x, size.m_y, p_texture.GetChannelCount());
+    }
+
+    bool TextureAtlas::Init()
+    {
+        if (!CHECK(!m_pages.empty(), "Unable to initialize texture atlas - no textures were added"))
+            return false;
+
+        if (!CHECK(m_ids.empty(), "Unable to initialize texture atlas - already initialized"))
+            return false;
+
+        const int    pageSize  = m_settings.m_pageSize;
+        const auto   pageCount = static_cast<GLsizei>(m_pages.size());
+        const GLenum target    = m_settings.m_layout == EAtlasLayout::ARRAY ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+        GLsizei      levels    = 0;
+
+        m_ids.resize(m_settings.m_layout == EAtlasLayout::ARRAY ? 1 : m_pages.size());
+        glGenTextures(static_cast<GLsizei>(m_ids.size()), m_ids.data());
+
+        // Mip rows aren't padded
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        for (GLsizei page = 0; page < pageCount; ++page)
+        {
+            const std::vector<TextureMip> mips = BuildMips(m_pages[page]);
+            const GLuint                  id   = m_ids[m_settings.m_layout == EAtlasLayout::ARRAY ? 0 : page];
+
+            glBindTexture(target, id);
+
+            if (page == 0 || target == GL_TEXTURE_2D)
+            {
+                levels = static_cast<GLsizei>(mips.size());
+
+                if (target == GL_TEXTURE_2D_ARRAY)
+                    glTexStorage3D(target, levels, GL_RGBA8, pageSize, pageSize, pageCount);
+                else
+                    glTexStorage2D(target, levels, GL_RGBA8, pageSize, pageSize);
+
+                glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                glTexParameteri(target, GL_TEXTURE_MIN_FILTER, ToGLInt(m_minFilter));
+                glTexParameteri(target, GL_TEXTURE_MAG_FILTER, ToGLInt(m_magFilter));
+                glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+            }
+
+            for (GLsizei level = 0; level < levels; ++level)
+            {
+                const TextureMip& mip = mips[level];
+
+                if (target == GL_TEXTURE_2D_ARRAY)
+                {
+                    glTexSubImage3D(target, level, 0, 0, page, mip.m_width, mip.m_height, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                        mip.m_data.data());
+                }
+                else
+                {
+                    glTexSubImage2D(target, level, 0, 0, mip.m_width, mip.m_height, GL_RGBA, GL_UNSIGNED_BYTE,
+                        mip.m_data.data());
+                }
+            }
+
+            // The pixels live on the GPU from now on
+            std::vector<uint8_t>().swap(m_pages[page].m_pixels);
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(target, 0);
+
+        return true;
+    }
+
+    void TextureAtlas::Bind(const uint8_t p_slot, const uint32_t p_page) const
+    {
+        glBindTextureUnit(p_slot, GetId(p_page));
+    }
+
+    void TextureAtlas::Unbind(const uint8_t p_slot) const
+    {
+        glBindTextureUnit(p_slot, 0);
+    }
+
+    const AtlasRegion& TextureAtlas::GetRegion(const size_t p_index) const
+    {
+        ASSERT(p_index < m_regions.size(), "Invalid atlas region index %llu", static_cast<unsigned long long>(p_index));
+        return m_regions[p_index];
+    }
+
+    size_t TextureAtlas::GetRegionCount() const
+    {
+        return m_regions.size();
+    }
+
+    uint32_t TextureAtlas::GetPageCount() const
+    {
+        return static_cast<uint32_t>(m_pages.size());
+    }
+
+    uint32_t TextureAtlas::GetId(const uint32_t p_page) const
+    {
+        if (m_ids.empty())
+            return 0;
+
+        return m_settings.m_layout == EAtlasLayout::ARRAY ? m_ids.front() : m_ids[p_page];
+    }
+
+    EAtlasLayout TextureAtlas::GetLayout() const
+    {
+        return m_settings.m_layout;
+    }
+
+    void TextureAtlas::SetFilters(const ETextureFilter p_minFilter, const ETextureFilter p_magFilter)
+    {
+        m_minFilter = p_minFilter;
+        m_magFilter = p_magFilter;
+
+        for (const uint32_t id : m_ids)
+        {
+            glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, ToGLInt(m_minFilter));
+            glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, ToGLInt(m_magFilter));
+        }
+    }
+
+    void TextureAtlas::Blit(Page& p_page, const Vector2I p_position, const uint8_t* p_pixels, const int p_width,
+                            const int p_height, const uint8_t p_channels) const
+    {
+        const int padding = m_settings.m_padding;
+
+        for (int y = 0; y < p_height + 2 * padding; ++y)
+        {
+            const int      srcY   = std::clamp(y - padding, 0, p_height - 1);
+            const uint8_t* srcRow = p_pixels + static_cast<size_t>(srcY) * p_width * p_channels;
+            uint8_t*       dstRow = p_page.m_pixels.data()
+                + (static_cast<size_t>(p_position.m_y + y) * m_settings.m_pageSize + p_position.m_x) * ATLAS_CHANNELS;
+
+            for (int x = 0; x < p_width + 2 * padding; ++x)
+            {
+                const uint8_t* src = srcRow + static_cast<size_t>(std::clamp(x - padding, 0, p_width - 1)) * p_channels;
+                uint8_t*       dst = dstRow + static_cast<size_t>(x) * ATLAS_CHANNELS;
+
+                // Match what sampling a RED, RG or RGB texture returns
+                dst[0] = src[0];
+                dst[1] = p_channels > 1 ? src[1] : 0;
+                dst[2] = p_channels > 2 ? src[2] : 0;
+                dst[3] = p_channels > 3 ? src[3] : UINT8_MAX;
+            }
+        }
+    }
+
+    std::vector<TextureMip> TextureAtlas::BuildMips(const Page& p_page) const
+    {
+        const int pageSize = m_settings.m_pageSize;
+
+        if (!m_settings.m_generateMips || m_settings.m_padding == 0)
+            return { { p_page.m_pixels, pageSize, pageSize } };
+
+        std::vector<TextureMip> mips = GenerateMips(p_page.m_pixels.data(), pageSize, pageSize, ATLAS_CHANNELS,
+            m_settings.m_mipSettings);
+
+        // Past this level the padding is less than a texel wide and neighbours would bleed into each other
+        const auto maxMipCount = static_cast<size_t>(std::bit_width(static_cast<unsigned>(m_settings.m_padding)));
+
+        if (mips.size() > maxMipCount)
+            mips.resize(maxMipCount);
+
+        return mips;
+    }
+
+    void TextureAtlas::Release()
+    {
+        if (!m_ids.empty())
+            glDeleteTextures(static_cast<GLsizei>(m_ids.size()), m_ids.data());
+
+        m_ids.clear();
+    }
+}
@@ -0,0 +1,194 @@
+#include "SurvivantRendering/Resources/TextureCooker.h"
+
+#include "SurvivantRendering/Utility/BlockCompression.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+#include <SurvivantCore/Debug/Logger.h>
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <stb_image.h>
+
+using namespace SvRendering::Enums;
+using namespace SvRendering::Utility;
+
+namespace SvRendering::Resources
+{
+    namespace
+    {
+        constexpr char     COOKED_TEXTURE_MAGIC[4] = { 'S', 'V', 'T', 'X' };
+        constexpr uint32_t COOKED_TEXTURE_VERSION  = 1;
+        constexpr uint32_t MAX_MIP_COUNT           = 32;
+
+        struct CookedTextureHeader
+        {
+            char     m_magic[4];
+            uint32_t m_version;
+            uint32_t m_mipCount;
+            uint8_t  m_format;
+            uint8_t  m_padding[3];
+        };
+
+        struct CookedMipHeader
+        {
+            uint32_t m_width;
+            uint32_t m_height;
+            uint64_t m_size;
+        };
+    }
+
+    bool IsCookedTexture(const std::string& p_path)
+    {
+        return std::filesystem::path(p_path).extension() == SV_COOKED_TEXTURE_EXTENSION;
+    }
+
+    bool CookTexture(const std::string& p_sourcePath, const std::string& p_outputPath, const ETextureFormat p_format,
+                     const bool p_generateMips, const MipGenerationSettings& p_mipSettings)
+    {
+        if (!CHECK(IsBlockCompressed(p_format), "Unable to cook texture \"%s\" - unsupported format", p_sourcePath.c_str()))
+            return false;
+
+        // Match the orientation of textures loaded at runtime
+        stbi_set_flip_vertically_on_load(true);
+
+        int      width, height, channels;
+        stbi_uc* pixels = stbi_load(p_sourcePath.c_str(), &width, &height, &channels, 0);
+
+        if (!CHECK(pixels != nullptr, "Unable to cook texture - failed to load \"%s\"", p_sourcePath.c_str()))
+            return false;
+
+        const auto              channelCount = static_cast<uint8_t>(channels);
+        std::vector<TextureMip> mips;
+
+        if (p_generateMips)
+            mips = GenerateMips(pixels, width, height, channelCount, p_mipSettings);
+        else
+            mips.push_back({ std::vector<uint8_t>(pixels, pixels + static_cast<size_t>(width) * height * channelCount), width,
+                height });
+
+        stbi_image_free(pixels);
+
+        if (mips.empty())
+            return false;
+
+        for (TextureMip& mip : mips)
+        {
+            mip.m_data = CompressImage(mip.m_data.data(), mip.m_width, mip.m_height, channelCount, p_format);
+
+            if (mip.m_data.empty())
+                return false;
+        }
+
+        return SaveCookedTexture(p_outputPath, p_format, mips);
+    }
+
+    bool SaveCookedTexture(const std::string& p_path, const ETextureFormat p_format, const std::vector<TextureMip>& p_mips)
+    {
+        if (!CHECK(!p_mips.empty(), "Unable to save cooked texture \"%s\" - no mips", p_path.c_str()))
+            return false;
+
+        std::ofstream file(p_path, std::ios::binary | std::ios::trunc);
+
+        if (!CHECK(file.is_open(), "Unable to save cooked texture - couldn't open file at path \"%s\"", p_path.c_str()))
+            return false;
+
+        CookedTextureHeader header{};
+        std::memcpy(header.m_magic, COOKED_TEXTURE_MAGIC, sizeof(COOKED_TEXTURE_MAGIC));
+        header.m_version  = COOKED_TEXTURE_VERSION;
+        header.m_mipCount = static_cast<uint32_t>(p_mips.size());
+        header.m_format   = static_cast<uint8_t>(p_format);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (const TextureMip& mip : p_mips)
+        {
+            const CookedMipHeader mipHeader
+            {
+                static_cast<uint32_t>(mip.m_width),
+                static_cast<uint32_t>(mip.m_height),
+                mip.m_data.size()
+            };
+
+            file.write(reinterpret_cast<const char*>(&mipHeader), sizeof(mipHeader));
+        }
+
+        for (const TextureMip& mip : p_mips)
+            file.write(reinterpret_cast<const char*>(mip.m_data.data()), static_cast<std::streamsize>(mip.m_data.size()));
+
+        return CHECK(file.good(), "Unable to save cooked texture - failed to write \"%s\"", p_path.c_str());
+    }
+
+    bool LoadCookedTexture(const std::string& p_path, ETextureFormat& p_format, std::vector<TextureMip>& p_mips)
+    {
+        std::ifstream file(p_path, std::ios::binary);
+
+        if (!CHECK(file.is_open(), "Unable to load cooked texture - couldn't open file at path \"%s\"", p_path.c_str()))
+            return false;
+
+        CookedTextureHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if (!CHECK(file.good() && std::memcmp(header.m_magic, COOKED_TEXTURE_MAGIC, sizeof(COOKED_TEXTURE_MAGIC)) == 0,
+            "Unable to load cooked texture - \"%s\" is not a cooked texture", p_path.c_str()))
+            return false;
+
+        if (!CHECK(header.m_version == COOKED_TEXTURE_VERSION && header.m_mipCount > 0,
+            "Unable to load cooked texture - unsupported version or empty file \"%s\"", p_path.c_str()))
+            return false;
+
+        p_format = static_cast<ETextureFormat>(header.m_format);
+
+        if (!CHECK(IsBlockCompressed(p_format), "Unable to load cooked texture - unsupported format %u in \"%s\"",
+            static_cast<unsigned>(header.m_format), p_path.c_str()))
+            return false;
+
+        // Mip dimensions are 32 bits wide, so a valid chain never has more levels than that
+        if (!CHECK(header.m_mipCount <= MAX_MIP_COUNT, "Unable to load cooked texture - too many mips in \"%s\"",
+            p_path.c_str()))
+            return false;
+
+        std::vector<CookedMipHeader> mipHeaders(header.m_mipCount);
+        const auto tableSize = static_cast<std::streamsize>(mipHeaders.size() * sizeof(CookedMipHeader));
+        file.read(reinterpret_cast<char*>(mipHeaders.data()), tableSize);
+
+        const uint32_t baseWidth  = mipHeaders.front().m_width;
+        const uint32_t baseHeight = mipHeaders.front().m_height;
+
+        if (!CHECK(file.good() && baseWidth > 0 && baseHeight > 0
+            && baseWidth <= INT_MAX && baseHeight <= INT_MAX
+            && header.m_mipCount <= static_cast<uint32_t>(std::bit_width(std::max(baseWidth, baseHeight))),
+            "Unable to load cooked texture - invalid mip chain in \"%s\"", p_path.c_str()))
+            return false;
+
+        // Sizes are checked against the rest of the file before allocating the mips
+        std::error_code error;
+        const uintmax_t fileSize  = std::filesystem::file_size(p_path, error);
+        uintmax_t       remaining = error ? 0 : fileSize - std::min<uintmax_t>(fileSize, file.tellg());
+
+        p_mips.clear();
+        p_mips.reserve(mipHeaders.size());
+
+        for (const CookedMipHeader& mipHeader : mipHeaders)
+        {
+            const int width  = static_cast<int>(mipHeader.m_width);
+            const int height = static_cast<int>(mipHeader.m_height);
+
+            if (!CHECK(mipHeader.m_width <= baseWidth && mipHeader.m_height <= baseHeight
+                && mipHeader.m_size == GetCompressedSize(p_format, width, height) && mipHeader.m_size <= remaining,
+                "Unable to load cooked texture - corrupted mip in \"%s\"", p_path.c_str()))
+                return false;
+
+            remaining -= mipHeader.m_size;
+
+            TextureMip& mip = p_mips.emplace_back(std::vector<uint8_t>(mipHeader.m_size), width, height);
+            file.read(reinterpret_cast<char*>(mip.m_data.data()), static_cast<std::streamsize>(mipHeader.m_size));
+        }
+
+        return CHECK(file.good(), "Unable to load cooked texture - unexpected end of file \"%s\"", p_path.c_str());
+    }
+}
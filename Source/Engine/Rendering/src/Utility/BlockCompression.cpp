@@ -0,0 +1,534 @@
+#include "SurvivantRendering/Utility/BlockCompression.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+#include <SurvivantCore/Threading/JobSystem.h>
+#include <SurvivantCore/Utility/Simd.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace SvCore::Threading;
+using namespace SvRendering::Enums;
+
+namespace SvRendering::Utility
+{
+    namespace
+    {
+        constexpr uint8_t RGBA_CHANNELS       = 4;
+        constexpr uint8_t POWER_ITERATIONS    = 8;
+        constexpr uint8_t BC7_MODE_6          = 1 << 6;
+        constexpr uint8_t BC7_MODE_6_BITS     = 7;
+        constexpr uint8_t BC7_ENDPOINT_BITS   = 7;
+        constexpr uint8_t BC7_INDEX_BITS      = 4;
+        constexpr uint8_t BC7_INDEX_COUNT     = 1 << BC7_INDEX_BITS;
+        constexpr uint8_t BC7_ANCHOR_MASK     = 1 << (BC7_INDEX_BITS - 1);
+        constexpr uint8_t BC7_WEIGHTS[16]     = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+        constexpr uint8_t BC7_WEIGHT_SHIFT    = 6;
+        constexpr uint8_t BC7_WEIGHT_ROUNDING = 32;
+
+        using Palette = float[BC7_INDEX_COUNT][RGBA_CHANNELS];
+
+        struct BlockTexels
+        {
+            alignas(16) float m_channels[RGBA_CHANNELS][BC_BLOCK_TEXEL_COUNT];
+        };
+
+        BlockTexels LoadTexels(const uint8_t* p_rgba)
+        {
+            BlockTexels texels;
+
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+            {
+                for (uint8_t c = 0; c < RGBA_CHANNELS; ++c)
+                    texels.m_channels[c][i] = p_rgba[i * RGBA_CHANNELS + c];
+            }
+
+            return texels;
+        }
+
+        /**
+         * \brief Finds the block's extremities along its principal axis (PCA using power iterations)
+         * \param p_texels The block's texels
+         * \param p_channelCount The number of channels to take into account
+         * \param p_min The output minimum endpoint
+         * \param p_max The output maximum endpoint
+         */
+        void ComputeEndpoints(const BlockTexels& p_texels, const uint8_t p_channelCount, float (&p_min)[RGBA_CHANNELS],
+                              float (&p_max)[RGBA_CHANNELS])
+        {
+            float mean[RGBA_CHANNELS]                      = {};
+            float covariance[RGBA_CHANNELS][RGBA_CHANNELS] = {};
+
+            for (uint8_t c = 0; c < p_channelCount; ++c)
+            {
+                for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+                    mean[c] += p_texels.m_channels[c][i];
+
+                mean[c] /= BC_BLOCK_TEXEL_COUNT;
+            }
+
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+            {
+                for (uint8_t a = 0; a < p_channelCount; ++a)
+                {
+                    for (uint8_t b = 0; b < p_channelCount; ++b)
+                    {
+                        covariance[a][b] += (p_texels.m_channels[a][i] - mean[a]) * (p_texels.m_channels[b][i] - mean[b]);
+                    }
+                }
+            }
+
+            // Seeded with the axis of the widest channel, so anti-correlated channels (e.g. a red to green gradient)
+            // can't leave the seed orthogonal to the principal axis. The seed is kept if the iterations vanish
+            uint8_t widestChannel = 0;
+
+            for (uint8_t c = 1; c < p_channelCount; ++c)
+            {
+                if (covariance[c][c] > covariance[widestChannel][widestChannel])
+                    widestChannel = c;
+            }
+
+            float axis[RGBA_CHANNELS] = {};
+            axis[widestChannel]       = 1.f;
+
+            for (uint8_t iteration = 0; iteration < POWER_ITERATIONS; ++iteration)
+            {
+                float next[RGBA_CHANNELS] = {};
+                float norm                = 0.f;
+
+                for (uint8_t a = 0; a < p_channelCount; ++a)
+                {
+                    for (uint8_t b = 0; b < p_channelCount; ++b)
+                        next[a] += covariance[a][b] * axis[b];
+
+                    norm = std::max(norm, std::abs(next[a]));
+                }
+
+                if (norm < FLT_EPSILON)
+                    break;
+
+                for (uint8_t c = 0; c < p_channelCount; ++c)
+                    axis[c] = next[c] / norm;
+            }
+
+            float lengthSquared = 0.f;
+
+            for (uint8_t c = 0; c < p_channelCount; ++c)
+                lengthSquared += axis[c] * axis[c];
+
+            const float invLength = 1.f / std::sqrt(lengthSquared);
+            float       minT      = FLT_MAX;
+            float       maxT      = -FLT_MAX;
+
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+            {
+                float t = 0.f;
+
+                for (uint8_t c = 0; c < p_channelCount; ++c)
+                    t += (p_texels.m_channels[c][i] - mean[c]) * axis[c] * invLength;
+
+                minT = std::min(minT, t);
+                maxT = std::max(maxT, t);
+            }
+
+            for (uint8_t c = 0; c < p_channelCount; ++c)
+            {
+                p_min[c] = std::clamp(mean[c] + axis[c] * invLength * minT, 0.f, 255.f);
+                p_max[c] = std::clamp(mean[c] + axis[c] * invLength * maxT, 0.f, 255.f);
+            }
+        }
+
+        /**
+         * \brief Finds the closest palette entry for each texel of the block
+         * \param p_texels The block's texels
+         * \param p_palette The candidate colors
+         * \param p_paletteSize The number of colors in the palette
+         * \param p_channelCount The number of channels to take into account
+         * \param p_indices The output palette indices
+         */
+        void FindClosestIndices(const BlockTexels& p_texels, const Palette& p_palette, const uint8_t p_paletteSize,
+                                const uint8_t p_channelCount, uint8_t (&p_indices)[BC_BLOCK_TEXEL_COUNT])
+        {
+#ifdef SV_SIMD_SSE2
+            // Process 4 texels at once - one lane per texel
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; i += 4)
+            {
+                __m128  bestDistance = _mm_set1_ps(FLT_MAX);
+                __m128i bestIndex    = _mm_setzero_si128();
+
+                for (uint8_t p = 0; p < p_paletteSize; ++p)
+                {
+                    __m128 distance = _mm_setzero_ps();
+
+                    for (uint8_t c = 0; c < p_channelCount; ++c)
+                    {
+                        const __m128 delta = _mm_sub_ps(_mm_load_ps(&p_texels.m_channels[c][i]), _mm_set1_ps(p_palette[p][c]));
+                        distance           = _mm_add_ps(distance, _mm_mul_ps(delta, delta));
+                    }
+
+                    const __m128i isCloser = _mm_castps_si128(_mm_cmplt_ps(distance, bestDistance));
+
+                    bestDistance = _mm_min_ps(distance, bestDistance);
+                    bestIndex    = _mm_or_si128(_mm_andnot_si128(isCloser, bestIndex),
+                        _mm_and_si128(isCloser, _mm_set1_epi32(p)));
+                }
+
+                alignas(16) int32_t indices[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(indices), bestIndex);
+
+                for (uint8_t lane = 0; lane < 4; ++lane)
+                    p_indices[i + lane] = static_cast<uint8_t>(indices[lane]);
+            }
+#else
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+            {
+                float bestDistance = FLT_MAX;
+
+                for (uint8_t p = 0; p < p_paletteSize; ++p)
+                {
+                    float distance = 0.f;
+
+                    for (uint8_t c = 0; c < p_channelCount; ++c)
+                    {
+                        const float delta = p_texels.m_channels[c][i] - p_palette[p][c];
+                        distance += delta * delta;
+                    }
+
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        p_indices[i] = p;
+                    }
+                }
+            }
+#endif // SV_SIMD_SSE2
+        }
+
+        uint16_t ToRGB565(const float (&p_color)[RGBA_CHANNELS])
+        {
+            const auto r = static_cast<uint16_t>(std::lround(p_color[0] * 31.f / 255.f));
+            const auto g = static_cast<uint16_t>(std::lround(p_color[1] * 63.f / 255.f));
+            const auto b = static_cast<uint16_t>(std::lround(p_color[2] * 31.f / 255.f));
+
+            return static_cast<uint16_t>(r << 11 | g << 5 | b);
+        }
+
+        void FromRGB565(const uint16_t p_color, float (&p_out)[RGBA_CHANNELS])
+        {
+            const uint16_t r = p_color >> 11 & 0x1F;
+            const uint16_t g = p_color >> 5 & 0x3F;
+            const uint16_t b = p_color & 0x1F;
+
+            p_out[0] = static_cast<float>(r << 3 | r >> 2);
+            p_out[1] = static_cast<float>(g << 2 | g >> 4);
+            p_out[2] = static_cast<float>(b << 3 | b >> 2);
+            p_out[3] = 255.f;
+        }
+
+        void WriteLittleEndian(uint8_t* p_output, const uint64_t p_value, const uint8_t p_byteCount)
+        {
+            for (uint8_t i = 0; i < p_byteCount; ++i)
+                p_output[i] = static_cast<uint8_t>(p_value >> (i * 8) & 0xFF);
+        }
+
+        void WriteBits(uint8_t* p_output, uint32_t& p_bitOffset, const uint32_t p_value, const uint8_t p_bitCount)
+        {
+            for (uint8_t bit = 0; bit < p_bitCount; ++bit, ++p_bitOffset)
+            {
+                if (p_value >> bit & 1)
+                    p_output[p_bitOffset >> 3] |= static_cast<uint8_t>(1 << (p_bitOffset & 7));
+            }
+        }
+
+        /**
+         * \brief Quantizes the given endpoint to 7 bits per channel with a shared p-bit
+         * \param p_color The endpoint to quantize
+         * \param p_quantized The output quantized channels
+         * \param p_pBit The output shared p-bit
+         */
+        void QuantizeBC7Endpoint(const float (&p_color)[RGBA_CHANNELS], uint8_t (&p_quantized)[RGBA_CHANNELS],
+                                 uint8_t& p_pBit)
+        {
+            float bestError = FLT_MAX;
+
+            for (uint8_t pBit = 0; pBit < 2; ++pBit)
+            {
+                uint8_t quantized[RGBA_CHANNELS];
+                float   error = 0.f;
+
+                for (uint8_t c = 0; c < RGBA_CHANNELS; ++c)
+                {
+                    const long value = std::clamp(std::lround((p_color[c] - pBit) / 2.f), 0l, 127l);
+                    const float delta = static_cast<float>(value << 1 | pBit) - p_color[c];
+
+                    quantized[c] = static_cast<uint8_t>(value);
+                    error += delta * delta;
+                }
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    p_pBit    = pBit;
+                    std::copy_n(quantized, RGBA_CHANNELS, p_quantized);
+                }
+            }
+        }
+
+        void FetchBlock(const uint8_t* p_pixels, const int p_width, const int p_height, const uint8_t p_channels,
+                        const int p_blockX, const int p_blockY, uint8_t (&p_rgba)[BC_BLOCK_TEXEL_COUNT * RGBA_CHANNELS])
+        {
+            for (int y = 0; y < BC_BLOCK_DIM; ++y)
+            {
+                // Clamp to the image's edge for partial blocks
+                const int srcY = std::min(p_blockY * BC_BLOCK_DIM + y, p_height - 1);
+
+                for (int x = 0; x < BC_BLOCK_DIM; ++x)
+                {
+                    const int      srcX  = std::min(p_blockX * BC_BLOCK_DIM + x, p_width - 1);
+                    const uint8_t* src   = p_pixels + (static_cast<size_t>(srcY) * p_width + srcX) * p_channels;
+                    uint8_t*       texel = p_rgba + (y * BC_BLOCK_DIM + x) * RGBA_CHANNELS;
+
+                    texel[0] = src[0];
+                    texel[1] = p_channels > 1 ? src[1] : 0;
+                    texel[2] = p_channels > 2 ? src[2] : 0;
+                    texel[3] = p_channels > 3 ? src[3] : 255;
+                }
+            }
+        }
+
+        void EncodeBlock(const ETextureFormat p_format, const uint8_t* p_rgba, uint8_t* p_output)
+        {
+            switch (p_format)
+            {
+            case ETextureFormat::BC1:
+                EncodeBC1Block(p_rgba, p_output);
+                break;
+            case ETextureFormat::BC3:
+                EncodeBC3Block(p_rgba, p_output);
+                break;
+            case ETextureFormat::BC4:
+                EncodeBC4Block(p_rgba, 0, p_output);
+                break;
+            case ETextureFormat::BC5:
+                EncodeBC5Block(p_rgba, p_output);
+                break;
+            case ETextureFormat::BC7:
+                EncodeBC7Block(p_rgba, p_output);
+                break;
+            default:
+                ASSERT(false, "Invalid block compressed format");
+                break;
+            }
+        }
+    }
+
+    bool IsBlockCompressed(const ETextureFormat p_format)
+    {
+        return GetBlockSize(p_format) != 0;
+    }
+
+    uint8_t GetBlockSize(const ETextureFormat p_format)
+    {
+        switch (p_format)
+        {
+        case ETextureFormat::BC1:
+        case ETextureFormat::BC4:
+            return 8;
+        case ETextureFormat::BC3:
+        case ETextureFormat::BC5:
+        case ETextureFormat::BC7:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    size_t GetCompressedSize(const ETextureFormat p_format, const int p_width, const int p_height)
+    {
+        const size_t blocksX = (static_cast<size_t>(p_width) + BC_BLOCK_DIM - 1) / BC_BLOCK_DIM;
+        const size_t blocksY = (static_cast<size_t>(p_height) + BC_BLOCK_DIM - 1) / BC_BLOCK_DIM;
+
+        return blocksX * blocksY * GetBlockSize(p_format);
+    }
+
+    void EncodeBC1Block(const uint8_t* p_rgba, uint8_t* p_output)
+    {
+        const BlockTexels texels = LoadTexels(p_rgba);
+
+        float minColor[RGBA_CHANNELS], maxColor[RGBA_CHANNELS];
+        ComputeEndpoints(texels, 3, minColor, maxColor);
+
+        uint16_t color0 = ToRGB565(maxColor);
+        uint16_t color1 = ToRGB565(minColor);
+
+        // color0 > color1 selects the opaque 4 colors mode
+        if (color0 < color1)
+            std::swap(color0, color1);
+
+        uint32_t indices = 0;
+
+        if (color0 != color1)
+        {
+            Palette palette;
+            FromRGB565(color0, palette[0]);
+            FromRGB565(color1, palette[1]);
+
+            for (uint8_t c = 0; c < 3; ++c)
+            {
+                palette[2][c] = (2.f * palette[0][c] + palette[1][c]) / 3.f;
+                palette[3][c] = (palette[0][c] + 2.f * palette[1][c]) / 3.f;
+            }
+
+            uint8_t closest[BC_BLOCK_TEXEL_COUNT];
+            FindClosestIndices(texels, palette, 4, 3, closest);
+
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+                indices |= static_cast<uint32_t>(closest[i]) << (i * 2);
+        }
+
+        WriteLittleEndian(p_output, color0, 2);
+        WriteLittleEndian(p_output + 2, color1, 2);
+        WriteLittleEndian(p_output + 4, indices, 4);
+    }
+
+    void EncodeBC3Block(const uint8_t* p_rgba, uint8_t* p_output)
+    {
+        EncodeBC4Block(p_rgba, 3, p_output);
+        EncodeBC1Block(p_rgba, p_output + 8);
+    }
+
+    void EncodeBC4Block(const uint8_t* p_rgba, const uint8_t p_channel, uint8_t* p_output)
+    {
+        uint8_t minValue = UINT8_MAX;
+        uint8_t maxValue = 0;
+
+        for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+        {
+            minValue = std::min(minValue, p_rgba[i * RGBA_CHANNELS + p_channel]);
+            maxValue = std::max(maxValue, p_rgba[i * RGBA_CHANNELS + p_channel]);
+        }
+
+        // value0 > value1 selects the 8 values mode
+        p_output[0] = maxValue;
+        p_output[1] = minValue;
+
+        uint64_t indices = 0;
+
+        if (maxValue != minValue)
+        {
+            const float scale = 7.f / static_cast<float>(maxValue - minValue);
+
+            for (uint8_t i = 0; i < BC_BLOCK_TEXEL_COUNT; ++i)
+            {
+                // The palette is evenly spaced so the closest entry is the rounded position between the endpoints
+                const long     step  = std::lround((p_rgba[i * RGBA_CHANNELS + p_channel] - minValue) * scale);
+                const uint64_t index = step == 7 ? 0 : step == 0 ? 1 : static_cast<uint64_t>(8 - step);
+
+                indices |= index << (i * 3);
+            }
+        }
+
+        WriteLittleEndian(p_output + 2, indices, 6);
+    }
+
+    void EncodeBC5Block(const uint8_t* p_rgba, uint8_t* p_output)
+    {
+        EncodeBC4Block(p_rgba, 0, p_output);
+        EncodeBC4Block(p_rgba, 1, p_output + 8);
+    }
+
+    void EncodeBC7Block(const uint8_t* p_rgba, uint8_t* p_output)
+    {
+        const BlockTexels texels = LoadTexels(p_rgba);
+
+        float minColor[RGBA_CHANNELS], maxColor[RGBA_CHANNELS];
+        ComputeEndpoints(texels, RGBA_CHANNELS, minColor, maxColor);
+
+        uint8_t endpoints[2][RGBA_CHANNELS];
+        uint8_t pBits[2];
+        QuantizeBC7Endpoint(minColor, endpoints[0], pBits[0]);
+        QuantizeBC7Endpoint(maxColor, endpoints[1], pBits[1]);
+
+        Palette palette;
+
+        for (uint8_t i = 0; i < BC7_INDEX_COUNT; ++i)
+        {
+            for (uint8_t c = 0; c < RGBA_CHANNELS; ++c)
+            {
+                const int e0 = endpoints[0][c] << 1 | pBits[0];
+                const int e1 = endpoints[1][c] << 1 | pBits[1];
+
+                palette[i][c] = static_cast<float>(((64 - BC7_WEIGHTS[i]) * e0 + BC7_WEIGHTS[i] * e1 + BC7_WEIGHT_ROUNDING)
+                    >> BC7_WEIGHT_SHIFT);
+            }
+        }
+
+        uint8_t indices[BC_BLOCK_TEXEL_COUNT];
+        FindClosestIndices(texels, palette, BC7_INDEX_COUNT, RGBA_CHANNELS, indices);
+
+        // The anchor index's most significant bit is implicitly 0 - swap the endpoints if needed
+        if (indices[0] & BC7_ANCHOR_MASK)
+        {
+            std::swap(endpoints[0], endpoints[1]);
+            std::swap(pBits[0], pBits[1]);
+
+            for (uint8_t& index : indices)
+                index = static_cast<uint8_t>(BC7_INDEX_COUNT - 1 - index);
+        }
+
+        std::fill_n(p_output, 16, static_cast<uint8_t>(0));
+        uint32_t bitOffset = 0;
+
+        WriteBits(p_output, bitOffset, BC7_MODE_6, BC7_MODE_6_BITS);
+
+        for (uint8_t c = 0; c < RGBA_CHANNELS; ++c)
+        {
+            WriteBits(p_output, bitOffset, endpoints[0][c], BC7_ENDPOINT_BITS);
+            WriteBits(p_output, bitOffset, endpoints[1][c], BC7_ENDPOINT_BITS);
+        }
+
+        WriteBits(p_output, bitOffset, pBits[0], 1);
+        WriteBits(p_output, bitOffset, pBits[1], 1);
+
+        WriteBits(p_output, bitOffset, indices[0], BC7_INDEX_BITS - 1);
+
+        for (uint8_t i = 1; i < BC_BLOCK_TEXEL_COUNT; ++i)
+            WriteBits(p_output, bitOffset, indices[i], BC7_INDEX_BITS);
+    }
+
+    std::vector<uint8_t> CompressImage(const uint8_t* p_pixels, const int p_width, const int p_height, const uint8_t p_channels,
+                                       const ETextureFormat p_format)
+    {
+        if (!CHECK(p_pixels != nullptr && p_width > 0 && p_height > 0, "Unable to compress image - invalid source"))
+            return {};
+
+        if (!CHECK(p_channels >= 1 && p_channels <= 4, "Unable to compress image - invalid channel count \"%d\"", p_channels))
+            return {};
+
+        const uint8_t blockSize = GetBlockSize(p_format);
+
+        if (!CHECK(blockSize != 0, "Unable to compress image - format is not block compressed"))
+            return {};
+
+        const int blocksX = (p_width + BC_BLOCK_DIM - 1) / BC_BLOCK_DIM;
+        const int blocksY = (p_height + BC_BLOCK_DIM - 1) / BC_BLOCK_DIM;
+
+        std::vector<uint8_t> output(static_cast<size_t>(blocksX) * blocksY * blockSize);
+
+        JobSystem::GetInstance().ParallelFor(0, static_cast<size_t>(blocksY), [&](const size_t p_blockRow)
+        {
+            const int blockY = static_cast<int>(p_blockRow);
+            uint8_t*  outRow = output.data() + p_blockRow * blocksX * blockSize;
+            uint8_t   rgba[BC_BLOCK_TEXEL_COUNT * RGBA_CHANNELS];
+
+            for (int blockX = 0; blockX < blocksX; ++blockX)
+            {
+                FetchBlock(p_pixels, p_width, p_height, p_channels, blockX, blockY, rgba);
+                EncodeBlock(p_format, rgba, outRow + static_cast<size_t>(blockX) * blockSize);
+            }
+        });
+
+        return output;
+    }
+}
@@ -0,0 +1,50 @@
+#include "SurvivantRendering/Utility/GLConversion.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+
+#include <glad/gl.h>
+
+using namespace SvRendering::Enums;
+
+namespace SvRendering::Utility
+{
+    int ToGLInt(const ETextureFilter p_filter)
+    {
+        switch (p_filter)
+        {
+        case ETextureFilter::NEAREST:
+            return GL_NEAREST;
+        case ETextureFilter::LINEAR:
+            return GL_LINEAR;
+        case ETextureFilter::NEAREST_MIPMAP_NEAREST:
+            return GL_NEAREST_MIPMAP_NEAREST;
+        case ETextureFilter::LINEAR_MIPMAP_NEAREST:
+            return GL_LINEAR_MIPMAP_NEAREST;
+        case ETextureFilter::NEAREST_MIPMAP_LINEAR:
+            return GL_NEAREST_MIPMAP_LINEAR;
+        case ETextureFilter::LINEAR_MIPMAP_LINEAR:
+            return GL_LINEAR_MIPMAP_LINEAR;
+        default:
+            ASSERT(false, "Invalid texture filter");
+            return GL_INVALID_ENUM;
+        }
+    }
+
+    int ToGLInt(const ETextureWrapMode p_wrapMode)
+    {
+        switch (p_wrapMode)
+        {
+        case ETextureWrapMode::REPEAT:
+            return GL_REPEAT;
+        case ETextureWrapMode::MIRRORED_REPEAT:
+            return GL_MIRRORED_REPEAT;
+        case ETextureWrapMode::CLAMP_TO_EDGE:
+            return GL_CLAMP_TO_EDGE;
+        case ETextureWrapMode::CLAMP_TO_BORDER:
+            return GL_CLAMP_TO_BORDER;
+        default:
+            ASSERT(false, "Invalid wrap mode");
+            return GL_INVALID_ENUM;
+        }
+    }
+}
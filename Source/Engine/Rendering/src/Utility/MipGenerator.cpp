@@ -0,0 +1,411 @@
+#include "SurvivantRendering/Utility/MipGenerator.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+#include <SurvivantCore/Threading/JobSystem.h>
+#include <SurvivantCore/Utility/Simd.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+using namespace SvRendering::Enums;
+using namespace SvRendering::Resources;
+using namespace SvCore::Threading;
+
+namespace SvRendering::Utility
+{
+    namespace
+    {
+        constexpr uint8_t ALPHA_CHANNEL         = 3;
+        constexpr int     KAISER_RADIUS         = 4;
+        constexpr float   KAISER_ALPHA          = 4.f;
+        constexpr int     COVERAGE_SEARCH_STEPS = 10;
+        constexpr float   MAX_COVERAGE_SCALE    = 4.f;
+        constexpr size_t  MIN_ROWS_PER_JOB      = 16;
+        constexpr size_t  SRGB_ENCODE_LUT_SIZE  = 4096;
+
+        struct FloatImage
+        {
+            std::vector<float> m_data;
+            int                m_width  = 0;
+            int                m_height = 0;
+        };
+
+        struct FilterKernel
+        {
+            std::vector<float> m_weights;
+            int                m_firstOffset = 0;
+        };
+
+        float SrgbToLinear(const float p_value)
+        {
+            return p_value <= .04045f ? p_value / 12.92f : std::pow((p_value + .055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(const float p_value)
+        {
+            return p_value <= .0031308f ? p_value * 12.92f : 1.055f * std::pow(p_value, 1.f / 2.4f) - .055f;
+        }
+
+        const std::array<float, 256>& GetSrgbDecodeTable()
+        {
+            static const std::array<float, 256> table = []
+            {
+                std::array<float, 256> values{};
+
+                for (size_t i = 0; i < values.size(); ++i)
+                    values[i] = SrgbToLinear(static_cast<float>(i) / 255.f);
+
+                return values;
+            }();
+
+            return table;
+        }
+
+        const std::array<uint8_t, SRGB_ENCODE_LUT_SIZE>& GetSrgbEncodeTable()
+        {
+            static const std::array<uint8_t, SRGB_ENCODE_LUT_SIZE> table = []
+            {
+                std::array<uint8_t, SRGB_ENCODE_LUT_SIZE> values{};
+
+                for (size_t i = 0; i < values.size(); ++i)
+                {
+                    const float linear = static_cast<float>(i) / static_cast<float>(SRGB_ENCODE_LUT_SIZE - 1);
+                    values[i]          = static_cast<uint8_t>(std::lround(LinearToSrgb(linear) * 255.f));
+                }
+
+                return values;
+            }();
+
+            return table;
+        }
+
+        bool IsGammaEncoded(const uint8_t p_channel, const uint8_t p_channelCount, const MipGenerationSettings& p_settings)
+        {
+            // Single and dual channel images hold data (e.g. roughness, height or normal XY) rather than colors
+            return p_settings.m_isSrgb && p_channelCount >= 3 && p_channel != ALPHA_CHANNEL;
+        }
+
+        /**
+         * \brief Computes the modified Bessel function of the first kind of order 0
+         * \param p_x The function's parameter
+         * \return I0(x)
+         */
+        float BesselI0(const float p_x)
+        {
+            float sum  = 1.f;
+            float term = 1.f;
+
+            for (int k = 1; k < 16; ++k)
+            {
+                const float factor = p_x / (2.f * static_cast<float>(k));
+                term *= factor * factor;
+                sum += term;
+            }
+
+            return sum;
+        }
+
+        /**
+         * \brief Creates the normalized 1D kernel used to halve an image along one axis
+         * \param p_filter The mip filter
+         * \return The filter's kernel. Offsets are relative to twice the destination coordinate
+         */
+        FilterKernel MakeKernel(const EMipFilter p_filter)
+        {
+            if (p_filter == EMipFilter::BOX)
+                return { { .5f, .5f }, 0 };
+
+            FilterKernel kernel{ {}, 1 - KAISER_RADIUS };
+            float        sum = 0.f;
+
+            for (int offset = kernel.m_firstOffset; offset <= KAISER_RADIUS; ++offset)
+            {
+                // The destination texel's center lies between the two source texels
+                const float t      = static_cast<float>(offset) - .5f;
+                const float x      = t * .5f * std::numbers::pi_v<float>;
+                const float sinc   = std::abs(x) < 1e-5f ? 1.f : std::sin(x) / x;
+                const float ratio  = t / static_cast<float>(KAISER_RADIUS);
+                const float window = BesselI0(KAISER_ALPHA * std::sqrt(std::max(0.f, 1.f - ratio * ratio)))
+                    / BesselI0(KAISER_ALPHA);
+
+                kernel.m_weights.push_back(sinc * window);
+                sum += sinc * window;
+            }
+
+            for (float& weight : kernel.m_weights)
+                weight /= sum;
+
+            return kernel;
+        }
+
+        /**
+         * \brief Computes the weights of the 3 source texels covered by a destination texel when halving an odd size.\n
+         * The n destination texels each cover (2n + 1) / n source texels so the last row or column isn't dropped
+         * \param p_index The destination texel's coordinate along the halved axis
+         * \param p_targetSize The destination size along the halved axis
+         * \return The weights of the source texels at twice the destination coordinate and the next 2
+         */
+        std::array<float, 3> GetOddBoxWeights(const int p_index, const int p_targetSize)
+        {
+            const float scale = 1.f / static_cast<float>(2 * p_targetSize + 1);
+
+            return {
+                static_cast<float>(p_targetSize - p_index) * scale, static_cast<float>(p_targetSize) * scale,
+                static_cast<float>(p_index + 1) * scale
+            };
+        }
+
+        void AccumulateRow(float* p_dstRow, const float* p_srcRow, const float p_weight, const size_t p_rowSize)
+        {
+            size_t i = 0;
+
+#ifdef SV_SIMD_SSE2
+            const __m128 weights = _mm_set1_ps(p_weight);
+
+            for (; i + 4 <= p_rowSize; i += 4)
+            {
+                const __m128 weighted = _mm_mul_ps(weights, _mm_loadu_ps(p_srcRow + i));
+                _mm_storeu_ps(p_dstRow + i, _mm_add_ps(_mm_loadu_ps(p_dstRow + i), weighted));
+            }
+#endif // SV_SIMD_SSE2
+
+            for (; i < p_rowSize; ++i)
+                p_dstRow[i] += p_weight * p_srcRow[i];
+        }
+
+        /**
+         * \brief Calls the given function for every row index, spreading rows across the job system's workers
+         * \param p_rowCount The number of rows to process
+         * \param p_func The function to call for each row
+         */
+        template <class Func>
+        void ParallelForRows(const int p_rowCount, Func p_func)
+        {
+            JobSystem::GetInstance().ParallelFor(0, static_cast<size_t>(p_rowCount), [&p_func](const size_t p_row)
+            {
+                p_func(static_cast<int>(p_row));
+            }, MIN_ROWS_PER_JOB);
+        }
+
+        void DownsampleHorizontal(const FloatImage& p_source, FloatImage& p_target, const FilterKernel& p_kernel,
+                                  const uint8_t p_channels)
+        {
+            const bool isOdd = p_source.m_width > 1 && p_source.m_width % 2 != 0;
+
+            ParallelForRows(p_target.m_height, [&](const int p_y)
+            {
+                const float* srcRow = p_source.m_data.data() + static_cast<size_t>(p_y) * p_source.m_width * p_channels;
+                float*       dstRow = p_target.m_data.data() + static_cast<size_t>(p_y) * p_target.m_width * p_channels;
+
+                for (int x = 0; x < p_target.m_width; ++x)
+                {
+                    float* dst = dstRow + static_cast<size_t>(x) * p_channels;
+
+                    if (isOdd)
+                    {
+                        const std::array<float, 3> weights = GetOddBoxWeights(x, p_target.m_width);
+                        const float*               src     = srcRow + static_cast<size_t>(x) * 2 * p_channels;
+
+                        for (uint8_t c = 0; c < p_channels; ++c)
+                        {
+                            dst[c] = weights[0] * src[c] + weights[1] * src[p_channels + c]
+                                + weights[2] * src[2 * p_channels + c];
+                        }
+
+                        continue;
+                    }
+
+#ifdef SV_SIMD_SSE2
+                    if (p_channels == 4)
+                    {
+                        __m128 sum = _mm_setzero_ps();
+
+                        for (size_t k = 0; k < p_kernel.m_weights.size(); ++k)
+                        {
+                            const int srcX = std::clamp(x * 2 + p_kernel.m_firstOffset + static_cast<int>(k), 0,
+                                p_source.m_width - 1);
+
+                            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(p_kernel.m_weights[k]), _mm_loadu_ps(srcRow + srcX * 4)));
+                        }
+
+                        _mm_storeu_ps(dst, sum);
+                        continue;
+                    }
+#endif // SV_SIMD_SSE2
+
+                    std::fill_n(dst, p_channels, 0.f);
+
+                    for (size_t k = 0; k < p_kernel.m_weights.size(); ++k)
+                    {
+                        const int srcX = std::clamp(x * 2 + p_kernel.m_firstOffset + static_cast<int>(k), 0, p_source.m_width - 1);
+
+                        for (uint8_t c = 0; c < p_channels; ++c)
+                            dst[c] += p_kernel.m_weights[k] * srcRow[static_cast<size_t>(srcX) * p_channels + c];
+                    }
+                }
+            });
+        }
+
+        void DownsampleVertical(const FloatImage& p_source, FloatImage& p_target, const FilterKernel& p_kernel,
+                                const uint8_t p_channels)
+        {
+            const size_t rowSize = static_cast<size_t>(p_target.m_width) * p_channels;
+            const bool   isOdd   = p_source.m_height > 1 && p_source.m_height % 2 != 0;
+
+            ParallelForRows(p_target.m_height, [&](const int p_y)
+            {
+                float* dstRow = p_target.m_data.data() + static_cast<size_t>(p_y) * rowSize;
+                std::fill_n(dstRow, rowSize, 0.f);
+
+                if (isOdd)
+                {
+                    const std::array<float, 3> weights = GetOddBoxWeights(p_y, p_target.m_height);
+
+                    for (int k = 0; k < 3; ++k)
+                    {
+                        const float* srcRow = p_source.m_data.data() + static_cast<size_t>(p_y * 2 + k) * rowSize;
+                        AccumulateRow(dstRow, srcRow, weights[static_cast<size_t>(k)], rowSize);
+                    }
+
+                    return;
+                }
+
+                for (size_t k = 0; k < p_kernel.m_weights.size(); ++k)
+                {
+                    const int    offset = p_kernel.m_firstOffset + static_cast<int>(k);
+                    const int    srcY   = std::clamp(p_y * 2 + offset, 0, p_source.m_height - 1);
+                    const float* srcRow = p_source.m_data.data() + static_cast<size_t>(srcY) * rowSize;
+
+                    AccumulateRow(dstRow, srcRow, p_kernel.m_weights[k], rowSize);
+                }
+            });
+        }
+
+        float ComputeAlphaCoverage(const FloatImage& p_image, const float p_cutoff, const float p_scale)
+        {
+            const size_t texelCount = static_cast<size_t>(p_image.m_width) * p_image.m_height;
+            size_t       covered    = 0;
+
+            for (size_t i = 0; i < texelCount; ++i)
+            {
+                if (p_image.m_data[i * 4 + ALPHA_CHANNEL] * p_scale > p_cutoff)
+                    ++covered;
+            }
+
+            return static_cast<float>(covered) / static_cast<float>(texelCount);
+        }
+
+        /**
+         * \brief Finds the alpha scale for which the given image's coverage matches the target coverage
+         * \param p_image The image to scale
+         * \param p_cutoff The alpha test's cutoff value
+         * \param p_targetCoverage The coverage to reach
+         * \return The alpha scale to apply
+         */
+        float FindAlphaScale(const FloatImage& p_image, const float p_cutoff, const float p_targetCoverage)
+        {
+            float minScale = 0.f;
+            float maxScale = MAX_COVERAGE_SCALE;
+
+            for (int step = 0; step < COVERAGE_SEARCH_STEPS; ++step)
+            {
+                const float scale = (minScale + maxScale) * .5f;
+
+                if (ComputeAlphaCoverage(p_image, p_cutoff, scale) < p_targetCoverage)
+                    minScale = scale;
+                else
+                    maxScale = scale;
+            }
+
+            return (minScale + maxScale) * .5f;
+        }
+
+        FloatImage ToFloatImage(const uint8_t* p_pixels, const int p_width, const int p_height, const uint8_t p_channels,
+                                const MipGenerationSettings& p_settings)
+        {
+            const std::array<float, 256>& decodeTable = GetSrgbDecodeTable();
+
+            FloatImage image{ std::vector<float>(static_cast<size_t>(p_width) * p_height * p_channels), p_width, p_height };
+
+            for (size_t i = 0; i < image.m_data.size(); ++i)
+            {
+                const auto channel = static_cast<uint8_t>(i % p_channels);
+
+                image.m_data[i] = IsGammaEncoded(channel, p_channels, p_settings)
+                    ? decodeTable[p_pixels[i]] : static_cast<float>(p_pixels[i]) / 255.f;
+            }
+
+            return image;
+        }
+
+        TextureMip ToMip(const FloatImage& p_image, const uint8_t p_channels, const MipGenerationSettings& p_settings,
+                         const float p_alphaScale)
+        {
+            const std::array<uint8_t, SRGB_ENCODE_LUT_SIZE>& encodeTable = GetSrgbEncodeTable();
+
+            TextureMip mip{ std::vector<uint8_t>(p_image.m_data.size()), p_image.m_width, p_image.m_height };
+
+            for (size_t i = 0; i < p_image.m_data.size(); ++i)
+            {
+                const auto channel = static_cast<uint8_t>(i % p_channels);
+                float      value   = p_image.m_data[i];
+
+                if (p_channels == 4 && channel == ALPHA_CHANNEL)
+                    value *= p_alphaScale;
+
+                value = std::clamp(value, 0.f, 1.f);
+
+                mip.m_data[i] = IsGammaEncoded(channel, p_channels, p_settings)
+                    ? encodeTable[static_cast<size_t>(std::lround(value * static_cast<float>(SRGB_ENCODE_LUT_SIZE - 1)))]
+                    : static_cast<uint8_t>(std::lround(value * 255.f));
+            }
+
+            return mip;
+        }
+    }
+
+    std::vector<TextureMip> GenerateMips(const uint8_t* p_pixels, const int p_width, const int p_height, const uint8_t p_channels,
+                                         const MipGenerationSettings& p_settings)
+    {
+        if (!CHECK(p_pixels != nullptr && p_width > 0 && p_height > 0, "Unable to generate mips - invalid source image"))
+            return {};
+
+        if (!CHECK(p_channels >= 1 && p_channels <= 4, "Unable to generate mips - invalid channel count \"%d\"", p_channels))
+            return {};
+
+        const FilterKernel kernel        = MakeKernel(p_settings.m_filter);
+        const bool         keepCoverage  = p_settings.m_preserveAlphaCoverage && p_channels == 4;
+        const size_t       baseLevelSize = static_cast<size_t>(p_width) * p_height * p_channels;
+
+        std::vector<TextureMip> mips;
+        mips.push_back({ std::vector<uint8_t>(p_pixels, p_pixels + baseLevelSize), p_width, p_height });
+
+        FloatImage level          = ToFloatImage(p_pixels, p_width, p_height, p_channels, p_settings);
+        const float targetCoverage = keepCoverage ? ComputeAlphaCoverage(level, p_settings.m_alphaCutoff, 1.f) : 0.f;
+
+        while (level.m_width > 1 || level.m_height > 1)
+        {
+            const int width  = std::max(level.m_width / 2, 1);
+            const int height = std::max(level.m_height / 2, 1);
+
+            // Separable filter - halve the width, then the height
+            const size_t halfWidthSize = static_cast<size_t>(width) * level.m_height * p_channels;
+
+            FloatImage halfWidth{ std::vector<float>(halfWidthSize), width, level.m_height };
+            DownsampleHorizontal(level, halfWidth, level.m_width > 1 ? kernel : FilterKernel{ { 1.f }, 0 }, p_channels);
+
+            FloatImage next{ std::vector<float>(static_cast<size_t>(width) * height * p_channels), width, height };
+            DownsampleVertical(halfWidth, next, level.m_height > 1 ? kernel : FilterKernel{ { 1.f }, 0 }, p_channels);
+
+            // Coverage is only corrected on the output to avoid accumulating the scaling error across levels
+            const float alphaScale = keepCoverage ? FindAlphaScale(next, p_settings.m_alphaCutoff, targetCoverage) : 1.f;
+
+            mips.push_back(ToMip(next, p_channels, p_settings, alphaScale));
+            level = std::move(next);
+        }
+
+        return mips;
+    }
+}
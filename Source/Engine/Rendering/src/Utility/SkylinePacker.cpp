@@ -0,0 +1,131 @@
+#include "SurvivantRendering/Utility/SkylinePacker.h"
+
+#include <SurvivantCore/Debug/Assertion.h>
+
+#include <algorithm>
+#include <climits>
+
+namespace SvRendering::Utility
+{
+    SkylinePacker::SkylinePacker(const int p_width, const int p_height)
+        : m_width(p_width), m_height(p_height)
+    {
+        ASSERT(p_width > 0 && p_height > 0, "Invalid skyline packer size %dx%d", p_width, p_height);
+        Clear();
+    }
+
+    bool SkylinePacker::Insert(const int p_width, const int p_height, LibMath::Vector2I& p_position)
+    {
+        if (p_width <= 0 || p_height <= 0 || p_width > m_width || p_height > m_height)
+            return false;
+
+        size_t bestIndex  = m_skyline.size();
+        int    bestTop    = INT_MAX;
+        int    bestWidth  = INT_MAX;
+        int    bestBottom = 0;
+
+        for (size_t i = 0; i < m_skyline.size(); ++i)
+        {
+            int y;
+
+            if (!Fit(i, p_width, p_height, y))
+                continue;
+
+            // Bottom-left: lowest top edge first, then the narrowest supporting node to limit wasted space
+            const int top = y + p_height;
+
+            if (top < bestTop || (top == bestTop && m_skyline[i].m_width < bestWidth))
+            {
+                bestIndex  = i;
+                bestTop    = top;
+                bestWidth  = m_skyline[i].m_width;
+                bestBottom = y;
+            }
+        }
+
+        if (bestIndex == m_skyline.size())
+            return false;
+
+        p_position = { m_skyline[bestIndex].m_x, bestBottom };
+        AddLevel(bestIndex, p_position.m_x, bestBottom, p_width, p_height);
+
+        m_usedArea += static_cast<int64_t>(p_width) * p_height;
+        return true;
+    }
+
+    void SkylinePacker::Clear()
+    {
+        m_skyline.clear();
+        m_skyline.push_back({ 0, 0, m_width });
+        m_usedArea = 0;
+    }
+
+    float SkylinePacker::GetOccupancy() const
+    {
+        return static_cast<float>(m_usedArea) / (static_cast<float>(m_width) * static_cast<float>(m_height));
+    }
+
+    bool SkylinePacker::Fit(const size_t p_index, const int p_width, const int p_height, int& p_y) const
+    {
+        const int x = m_skyline[p_index].m_x;
+
+        if (x + p_width > m_width)
+            return false;
+
+        int remainingWidth = p_width;
+        p_y                = m_skyline[p_index].m_y;
+
+        for (size_t i = p_index; remainingWidth > 0; ++i)
+        {
+            p_y = std::max(p_y, m_skyline[i].m_y);
+
+            if (p_y + p_height > m_height)
+                return false;
+
+            remainingWidth -= m_skyline[i].m_width;
+        }
+
+        return true;
+    }
+
+    void SkylinePacker::AddLevel(const size_t p_index, const int p_x, const int p_y, const int p_width, const int p_height)
+    {
+        m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(p_index), { p_x, p_y + p_height, p_width });
+
+        // Shrink or remove the nodes now covered by the new one
+        const int right = p_x + p_width;
+
+        for (size_t i = p_index + 1; i < m_skyline.size();)
+        {
+            Node& node = m_skyline[i];
+
+            if (node.m_x >= right)
+                break;
+
+            const int overlap = right - node.m_x;
+
+            if (node.m_width <= overlap)
+            {
+                m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+
+            node.m_x += overlap;
+            node.m_width -= overlap;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < m_skyline.size();)
+        {
+            if (m_skyline[i].m_y == m_skyline[i + 1].m_y)
+            {
+                m_skyline[i].m_width += m_skyline[i + 1].m_width;
+                m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+                continue;
+            }
+
+            ++i;
+        }
+    }
+}
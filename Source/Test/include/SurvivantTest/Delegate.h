@@ -0,0 +1,236 @@
+//Delegate.h
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Core
+{
+	template <typename Signature>
+	class Delegate;
+
+	//callable wrapper storing small callables (lambdas with a few captures, function pointers) inline
+	//instead of on the heap, called through a single function pointer
+	template <typename R, typename ...Args>
+	class Delegate<R(Args...)>
+	{
+	public:
+		static constexpr size_t BUFFER_SIZE = 4 * sizeof(void*);
+
+	public:
+		Delegate() = default;
+		Delegate(std::nullptr_t);
+
+		template <class F, typename = std::enable_if_t<
+			!std::is_same_v<std::decay_t<F>, Delegate> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+		Delegate(F&& p_callable);
+
+		Delegate(const Delegate& p_other);
+		Delegate(Delegate&& p_other) noexcept;
+		~Delegate();
+
+		Delegate& operator=(const Delegate& p_other);
+		Delegate& operator=(Delegate&& p_other) noexcept;
+
+	public:
+		R operator()(Args... p_parameters) const;
+
+		explicit operator bool() const;
+
+	private:
+		using InvokeFunc = R(*)(void*, Args&&...);
+
+		struct Operations
+		{
+			void (*m_copy)(void* p_destination, const void* p_source);
+			void (*m_move)(void* p_destination, void* p_source) noexcept;
+			void (*m_destroy)(void* p_storage) noexcept;
+		};
+
+		template <class F>
+		static constexpr bool IsStoredInline =
+			sizeof(F) <= BUFFER_SIZE && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+		template <class F>
+		static F& GetCallable(void* p_storage);
+
+		template <class F>
+		static const Operations s_operations;
+
+	private:
+		void Reset();
+
+	private:
+		alignas(std::max_align_t) unsigned char m_storage[BUFFER_SIZE];
+		InvokeFunc                              m_invoke = nullptr;
+		const Operations*                       m_operations = nullptr;
+	};
+
+	template<typename R, typename ...Args>
+	template<class F>
+	inline F& Delegate<R(Args...)>::GetCallable(void* p_storage)
+	{
+		//callables too big for the buffer are stored on the heap, the buffer holding their pointer
+		if constexpr (IsStoredInline<F>)
+			return *std::launder(static_cast<F*>(p_storage));
+		else
+			return **static_cast<F**>(p_storage);
+	}
+
+	template<typename R, typename ...Args>
+	template<class F>
+	const typename Delegate<R(Args...)>::Operations Delegate<R(Args...)>::s_operations =
+	{
+		[](void* p_destination, const void* p_source)
+		{
+			const F& source = GetCallable<F>(const_cast<void*>(p_source));
+
+			if constexpr (IsStoredInline<F>)
+				new(p_destination) F(source);
+			else
+				*static_cast<F**>(p_destination) = new F(source);
+		},
+		[](void* p_destination, void* p_source) noexcept
+		{
+			if constexpr (IsStoredInline<F>)
+			{
+				new(p_destination) F(std::move(GetCallable<F>(p_source)));
+				GetCallable<F>(p_source).~F();
+			}
+			else
+			{
+				*static_cast<F**>(p_destination) = *static_cast<F**>(p_source);
+			}
+		},
+		[](void* p_storage) noexcept
+		{
+			if constexpr (IsStoredInline<F>)
+				GetCallable<F>(p_storage).~F();
+			else
+				delete *static_cast<F**>(p_storage);
+		}
+	};
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>::Delegate(std::nullptr_t)
+	{
+	}
+
+	template<typename R, typename ...Args>
+	template<class F, typename>
+	inline Delegate<R(Args...)>::Delegate(F&& p_callable)
+	{
+		using Callable = std::decay_t<F>;
+
+		if constexpr (std::is_pointer_v<Callable> || std::is_member_pointer_v<Callable>)
+		{
+			if (!p_callable)
+				return;
+		}
+
+		if constexpr (IsStoredInline<Callable>)
+			new(m_storage) Callable(std::forward<F>(p_callable));
+		else
+			*reinterpret_cast<Callable**>(m_storage) = new Callable(std::forward<F>(p_callable));
+
+		m_invoke = [](void* p_storage, Args&&... p_parameters) -> R
+		{
+			return std::invoke(GetCallable<Callable>(p_storage), std::forward<Args>(p_parameters)...);
+		};
+
+		m_operations = &s_operations<Callable>;
+	}
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>::Delegate(const Delegate& p_other)
+	{
+		if (!p_other.m_operations)
+			return;
+
+		p_other.m_operations->m_copy(m_storage, p_other.m_storage);
+		m_invoke     = p_other.m_invoke;
+		m_operations = p_other.m_operations;
+	}
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>::Delegate(Delegate&& p_other) noexcept
+	{
+		if (!p_other.m_operations)
+			return;
+
+		p_other.m_operations->m_move(m_storage, p_other.m_storage);
+		m_invoke     = p_other.m_invoke;
+		m_operations = p_other.m_operations;
+
+		p_other.m_invoke     = nullptr;
+		p_other.m_operations = nullptr;
+	}
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>::~Delegate()
+	{
+		Reset();
+	}
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>& Delegate<R(Args...)>::operator=(const Delegate& p_other)
+	{
+		if (this != &p_other)
+		{
+			Delegate copy(p_other);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>& Delegate<R(Args...)>::operator=(Delegate&& p_other) noexcept
+	{
+		if (this == &p_other)
+			return *this;
+
+		Reset();
+
+		if (!p_other.m_operations)
+			return *this;
+
+		p_other.m_operations->m_move(m_storage, p_other.m_storage);
+		m_invoke     = p_other.m_invoke;
+		m_operations = p_other.m_operations;
+
+		p_other.m_invoke     = nullptr;
+		p_other.m_operations = nullptr;
+
+		return *this;
+	}
+
+	template<typename R, typename ...Args>
+	inline R Delegate<R(Args...)>::operator()(Args... p_parameters) const
+	{
+		if (!m_invoke)
+			throw std::bad_function_call();
+
+		return m_invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(p_parameters)...);
+	}
+
+	template<typename R, typename ...Args>
+	inline Delegate<R(Args...)>::operator bool() const
+	{
+		return m_invoke != nullptr;
+	}
+
+	template<typename R, typename ...Args>
+	inline void Delegate<R(Args...)>::Reset()
+	{
+		if (m_operations)
+			m_operations->m_destroy(m_storage);
+
+		m_invoke     = nullptr;
+		m_operations = nullptr;
+	}
+}
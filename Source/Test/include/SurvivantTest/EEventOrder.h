@@ -0,0 +1,11 @@
+#pragma once
+
+namespace Core
+{
+    //order in which EventManager::FlushQueue dispatches queued events
+    enum class EEventOrder
+    {
+        BATCHED    = 0, //one batch per event type, each producer thread's events in publish order
+        SEQUENTIAL = 1  //one event at a time in global publish order, batch listeners receive batches of one
+    };
+}
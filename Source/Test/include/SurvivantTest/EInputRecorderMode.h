@@ -0,0 +1,11 @@
+#pragma once
+
+namespace App
+{
+    enum class EInputRecorderMode
+    {
+        NONE      = 0,
+        RECORDING = 1,
+        REPLAYING = 2
+    };
+}
@@ -2,11 +2,16 @@
 
 #pragma once
 
+#include "Delegate.h"
 #include "EventBase.h"
 
-#include <functional>
-#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <tuple>
+#include <vector>
 
 namespace Core
 {
@@ -14,67 +19,243 @@ namespace Core
 	class Event : public EventBase
 	{
 	public:
-		typedef std::function<void(Args&...)> EventDelegate;
+		typedef Delegate<void(Args&...)> EventDelegate;
+		typedef std::span<const std::tuple<Args...>> EventBatch;
+		typedef Delegate<void(EventBatch)> BatchDelegate;
 
 	public:
 		Event() = default;
-		~Event() = default;
+		~Event() override = default;
 
 	public:
 		void ClearListeners() override;
 
 	public:
-		void AddListener(EventDelegate p_delegate);
+		//listeners can be added and removed from inside a listener,
+		//the changes only apply to the next invoke
+		ListenerId AddListener(EventDelegate p_delegate);
 		void AddListeners(std::vector<EventDelegate> p_delegates);
-		void RemoveListener(EventDelegate p_delegate);
-	
+		bool RemoveListener(ListenerId p_id);
+
+		//batch listeners receive every queued occurrence of the event at once when the queue is flushed
+		ListenerId AddBatchListener(BatchDelegate p_delegate);
+
 		void Invoke(Args... p_parameters);
+		void InvokeBatch(EventBatch p_batch);
 
 	public:
 		template<class T>
 		void Combine(const T& p_other);
 
 	private:
-		std::vector<EventDelegate> m_listeners;
+		template <class D>
+		struct Listener
+		{
+			ListenerId m_id;
+			D m_delegate;
+			bool m_isRemoved = false;
+		};
+
+		template <class D>
+		struct ListenerList
+		{
+			std::vector<Listener<D>> m_listeners;
+			std::vector<Listener<D>> m_addedListeners;
+			bool m_hasRemovedListeners = false;
+
+			void Add(ListenerId p_id, D p_delegate, bool p_isDispatching);
+			bool Remove(ListenerId p_id, bool p_isDispatching);
+			void Clear(bool p_isDispatching);
+			void ApplyChanges();
+		};
+
+	private:
+		void EndDispatch();
+
+	private:
+		ListenerList<EventDelegate> m_listeners;
+		ListenerList<BatchDelegate> m_batchListeners;
+		uint32_t m_dispatchDepth = 0;
 	};
 
+	template<typename ...Args>
+	template<class D>
+	inline void Event<Args...>::ListenerList<D>::Add(ListenerId p_id, D p_delegate, bool p_isDispatching)
+	{
+		//the listeners can't grow while iterated
+		if (p_isDispatching)
+			m_addedListeners.push_back({ p_id, std::move(p_delegate) });
+		else
+			m_listeners.push_back({ p_id, std::move(p_delegate) });
+	}
+
+	template<typename ...Args>
+	template<class D>
+	inline bool Event<Args...>::ListenerList<D>::Remove(ListenerId p_id, bool p_isDispatching)
+	{
+		auto isMatch = [p_id](const Listener<D>& p_listener)
+		{
+			return p_listener.m_id == p_id && !p_listener.m_isRemoved;
+		};
+
+		if (std::erase_if(m_addedListeners, isMatch) > 0)
+			return true;
+
+		auto listener = std::find_if(m_listeners.begin(), m_listeners.end(), isMatch);
+
+		if (listener == m_listeners.end())
+			return false;
+
+		//a listener can remove itself, so it is only destroyed once the dispatch is over
+		if (p_isDispatching)
+		{
+			listener->m_isRemoved = true;
+			m_hasRemovedListeners = true;
+		}
+		else
+		{
+			m_listeners.erase(listener);
+		}
+
+		return true;
+	}
+
+	template<typename ...Args>
+	template<class D>
+	inline void Event<Args...>::ListenerList<D>::Clear(bool p_isDispatching)
+	{
+		m_addedListeners.clear();
+
+		if (!p_isDispatching)
+		{
+			m_listeners.clear();
+			return;
+		}
+
+		for (Listener<D>& listener : m_listeners)
+			listener.m_isRemoved = true;
+
+		m_hasRemovedListeners = !m_listeners.empty();
+	}
+
+	template<typename ...Args>
+	template<class D>
+	inline void Event<Args...>::ListenerList<D>::ApplyChanges()
+	{
+		if (m_hasRemovedListeners)
+		{
+			std::erase_if(m_listeners, [](const Listener<D>& p_listener) { return p_listener.m_isRemoved; });
+			m_hasRemovedListeners = false;
+		}
+
+		if (!m_addedListeners.empty())
+		{
+			std::move(m_addedListeners.begin(), m_addedListeners.end(), std::back_inserter(m_listeners));
+			m_addedListeners.clear();
+		}
+	}
+
 	template<typename ...Args>
 	inline void Event<Args...>::ClearListeners()
 	{
-		m_listeners.clear();
+		m_listeners.Clear(m_dispatchDepth > 0);
+		m_batchListeners.Clear(m_dispatchDepth > 0);
 	}
 
 	template<typename ...Args>
-	inline void Event<Args...>::AddListener(EventDelegate p_delegate)
+	inline EventBase::ListenerId Event<Args...>::AddListener(EventDelegate p_delegate)
 	{
-		m_listeners.push_back(p_delegate);
+		ListenerId id = NextListenerId();
+		m_listeners.Add(id, std::move(p_delegate), m_dispatchDepth > 0);
+
+		return id;
 	}
 
 	template<typename ...Args>
 	inline void Event<Args...>::AddListeners(std::vector<EventDelegate> p_delegates)
 	{
-		m_listeners.insert(m_listeners.end(), p_delegates.begin(), p_delegates.end());
+		for (EventDelegate& eventDelegate : p_delegates)
+			AddListener(std::move(eventDelegate));
 	}
 
 	template<typename ...Args>
-	inline void Event<Args...>::RemoveListener(EventDelegate p_delegate)
+	inline bool Event<Args...>::RemoveListener(ListenerId p_id)
 	{
-		m_listeners.push_back(p_delegate);
+		return m_listeners.Remove(p_id, m_dispatchDepth > 0) || m_batchListeners.Remove(p_id, m_dispatchDepth > 0);
+	}
+
+	template<typename ...Args>
+	inline EventBase::ListenerId Event<Args...>::AddBatchListener(BatchDelegate p_delegate)
+	{
+		ListenerId id = NextListenerId();
+		m_batchListeners.Add(id, std::move(p_delegate), m_dispatchDepth > 0);
+
+		return id;
 	}
 
 	template<typename ...Args>
 	void Event<Args...>::Invoke(Args... p_parameters)
 	{
-		for (EventDelegate& eventDelegate : m_listeners)
+		++m_dispatchDepth;
+
+		//indexed since listeners can be flagged as removed during the loop
+		for (size_t i = 0, count = m_listeners.m_listeners.size(); i < count; ++i)
+		{
+			Listener<EventDelegate>& listener = m_listeners.m_listeners[i];
+
+			if (!listener.m_isRemoved)
+				listener.m_delegate(p_parameters...);
+		}
+
+		EndDispatch();
+	}
+
+	template<typename ...Args>
+	void Event<Args...>::InvokeBatch(EventBatch p_batch)
+	{
+		if (p_batch.empty())
+			return;
+
+		++m_dispatchDepth;
+
+		for (size_t i = 0, count = m_batchListeners.m_listeners.size(); i < count; ++i)
 		{
-			eventDelegate(p_parameters...);
+			Listener<BatchDelegate>& listener = m_batchListeners.m_listeners[i];
+
+			if (!listener.m_isRemoved)
+				listener.m_delegate(p_batch);
 		}
+
+		if (!m_listeners.m_listeners.empty())
+		{
+			for (const std::tuple<Args...>& parameters : p_batch)
+			{
+				std::apply([this](const Args&... p_parameters) { this->Invoke(p_parameters...); }, parameters);
+			}
+		}
+
+		EndDispatch();
 	}
 
 	template<typename ...Args>
 	template<class T>
 	inline void Event<Args...>::Combine(const T& p_other)
 	{
-		this->AddListeners(p_other.m_listeners);
+		//listener ids are unique across events, so the other event's ids stay valid
+		for (const Listener<EventDelegate>& listener : p_other.m_listeners.m_listeners)
+			m_listeners.Add(listener.m_id, listener.m_delegate, m_dispatchDepth > 0);
+
+		for (const Listener<BatchDelegate>& listener : p_other.m_batchListeners.m_listeners)
+			m_batchListeners.Add(listener.m_id, listener.m_delegate, m_dispatchDepth > 0);
+	}
+
+	template<typename ...Args>
+	inline void Event<Args...>::EndDispatch()
+	{
+		if (--m_dispatchDepth > 0)
+			return;
+
+		m_listeners.ApplyChanges();
+		m_batchListeners.ApplyChanges();
 	}
-}
\ No newline at end of file
+}
@@ -2,17 +2,24 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace Core
 {
 	class EventBase
 	{
 	public:
+		using ListenerId = uint32_t;
 
 	public:
 		EventBase() = default;
-		~EventBase() = default;
+		virtual ~EventBase() = default;
 
 	public:
 		virtual void ClearListeners() = 0;
+
+	protected:
+		//unique across all events, so listeners keep their id when events are combined
+		static ListenerId NextListenerId();
 	};
-}
\ No newline at end of file
+}
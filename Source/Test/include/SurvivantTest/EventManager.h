@@ -1,24 +1,31 @@
 //EventManager.h
 
 #pragma once
+#include "EEventOrder.h"
 #include "EventBase.h"
 #include "Event.h"
+#include "EventProducer.h"
+#include "EventQueue.h"
 
-#include <unordered_map>
-#include <vector>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
 namespace Core
 {
 	class EventManager
 	{
 	private:
+		//dense index assigned to each event type on first use
 		using EventId = size_t;
-		using EventMap = std::unordered_map<EventId, std::shared_ptr<EventBase>>;
+		using EventList = std::vector<std::unique_ptr<EventBase>>;
+		using QueueList = std::vector<std::unique_ptr<EventQueueBase>>;
 
 	public:
-		EventManager() {}
+		EventManager();
+		~EventManager();
 		EventManager(EventManager const&) = delete;
 		void operator=(EventManager const&) = delete;
 
@@ -26,21 +33,54 @@ namespace Core
 		static EventManager& GetInstance();
 
 	public:
+		//invokes the listeners right away, must be called from the main thread
 		template <class T, typename ...Args>
 		void Invoke(Args... p_paramaters);
 
 		template <class T, typename ...Args>
 		void Invoke(const std::tuple<Args...>& p_paramaters);
 
+		//queues the event until the next FlushQueue, can be called from any thread without locking
+		template <class T, typename ...Args>
+		void Enqueue(Args... p_paramaters);
+
+		template <class T, typename ...Args>
+		void Enqueue(const std::tuple<Args...>& p_paramaters);
+
+		//dispatches every queued event in the current order, must be called from the main thread
+		void FlushQueue();
+
+		void SetOrder(EEventOrder p_order);
+		EEventOrder GetOrder() const;
+
 		template <class T>
 		T* AddEvent(std::shared_ptr<EventBase> p_event);
 
 	private:
 		template <class T>
-		friend EventId GetEventId();
+		static EventId GetEventId();
+
+		static EventId NextEventId();
+
+		//gets the calling thread's producer, registering it on first use
+		EventProducer& GetProducer();
+
+		void DispatchBatched();
+		void DispatchSequential();
 
 	private:
-		EventMap m_events;
+		EventList m_events;
+		QueueList m_queues;
+		std::vector<EventId> m_queuedIds;
+
+		const uint64_t m_managerId;
+		std::vector<std::unique_ptr<EventProducer>> m_producers;
+		std::vector<EventProducer*> m_flushedProducers;
+		std::vector<EventRecord*> m_flushedRecords;
+		std::mutex m_producerMutex;
+
+		std::atomic<uint64_t> m_sequence = 0;
+		std::atomic<EEventOrder> m_order = EEventOrder::BATCHED;
 	};
 
 	template<class T, typename ...Args>
@@ -51,21 +91,44 @@ namespace Core
 
 		EventId id = GetEventId<T>();
 
-		if (m_events.contains(id))
-			dynamic_cast<T*>(m_events[id].get())->Invoke(p_paramaters...);
-
+		if (id < m_events.size() && m_events[id])
+			static_cast<T*>(m_events[id].get())->Invoke(p_paramaters...);
 	}
+
 	template<class T, typename ...Args>
 	inline void EventManager::Invoke(const std::tuple<Args...>& p_paramaters)
 	{
 		if constexpr (!std::is_base_of_v<Event<Args...>, T> || !std::is_same_v<Event<Args...>, T>)
 			return;
-		//std::apply([](auto &&... args) { my_func(args...); }, my_tuple);
+
 		std::apply([this](auto &&... args) { this->Invoke<T>(args...); }, p_paramaters);
-		//std::apply(&EventManager::Invoke<T, ...Args>, p_paramaters);
 	}
 
 
+	template<class T, typename ...Args>
+	void EventManager::Enqueue(Args... p_paramaters)
+	{
+		if constexpr (!std::is_base_of_v<Event<Args...>, T> || !std::is_same_v<Event<Args...>, T>)
+			return;
+
+		EventId id = GetEventId<T>();
+
+		//the shared counter is only touched when the global order is needed
+		uint64_t sequence = m_order.load(std::memory_order_relaxed) == EEventOrder::SEQUENTIAL
+			? m_sequence.fetch_add(1, std::memory_order_relaxed) : 0;
+
+		GetProducer().Push(id, sequence, std::move(p_paramaters)...);
+	}
+
+	template<class T, typename ...Args>
+	inline void EventManager::Enqueue(const std::tuple<Args...>& p_paramaters)
+	{
+		if constexpr (!std::is_base_of_v<Event<Args...>, T> || !std::is_same_v<Event<Args...>, T>)
+			return;
+
+		std::apply([this](auto &&... args) { this->Enqueue<T>(args...); }, p_paramaters);
+	}
+
 	template<class T>
 	T* EventManager::AddEvent(std::shared_ptr<EventBase> p_event)
 	{
@@ -74,19 +137,23 @@ namespace Core
 
 		EventId id = GetEventId<T>();
 
-		m_events.try_emplace(id, std::make_shared<T>());
+		if (id >= m_events.size())
+			m_events.resize(id + 1);
 
-		T* eventPtr = dynamic_cast<T*>(m_events[id].get());
-		eventPtr->Combine<T>(*dynamic_cast<T*>(p_event.get()));
+		if (!m_events[id])
+			m_events[id] = std::make_unique<T>();
+
+		T* eventPtr = static_cast<T*>(m_events[id].get());
+		eventPtr->template Combine<T>(*static_cast<T*>(p_event.get()));
 
 		return eventPtr;
 	}
 
 	template<class T>
-	EventManager::EventId GetEventId()
+	EventManager::EventId EventManager::GetEventId()
 	{
-		return typeid(T).hash_code();
+		static const EventId s_id = NextEventId();
+
+		return s_id;
 	}
 }
-
-
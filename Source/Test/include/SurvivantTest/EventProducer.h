@@ -0,0 +1,177 @@
+//EventProducer.h
+
+#pragma once
+
+#include "Event.h"
+#include "EventBase.h"
+#include "EventQueue.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <vector>
+
+namespace Core
+{
+	struct EventRecord;
+
+	struct EventRecordOperations
+	{
+		//moves the record's parameters to the event's queue, creating the queue if needed
+		void (*m_push)(std::unique_ptr<EventQueueBase>& p_queue, EventRecord& p_record);
+
+		//dispatches the record's parameters to the event as a batch of one
+		void (*m_dispatch)(EventBase* p_event, EventRecord& p_record);
+
+		//destroys the record's parameters without dispatching them
+		void (*m_destroy)(EventRecord& p_record);
+	};
+
+	//type-erased queued event, small parameter lists are stored inline
+	struct EventRecord
+	{
+		static constexpr size_t STORAGE_SIZE = 48;
+
+		const EventRecordOperations* m_operations = nullptr;
+		size_t m_eventId = 0;
+		uint64_t m_sequence = 0;
+		alignas(std::max_align_t) unsigned char m_storage[STORAGE_SIZE];
+
+		template <typename ...Args>
+		void Emplace(size_t p_eventId, uint64_t p_sequence, Args&&... p_parameters);
+
+		template <typename ...Args>
+		std::tuple<Args...>& GetParameters();
+
+		template <typename ...Args>
+		void DestroyParameters();
+
+		template <typename ...Args>
+		static constexpr bool IsStoredInline =
+			sizeof(std::tuple<Args...>) <= STORAGE_SIZE && alignof(std::tuple<Args...>) <= alignof(std::max_align_t);
+
+		template <typename ...Args>
+		static const EventRecordOperations s_operations;
+	};
+
+	//events published by a single thread, pushed without locks into a ring buffer read by the flushing thread.
+	//once the ring is full, events go to a locked overflow list until the next flush so their order is kept
+	class EventProducer
+	{
+	public:
+		static constexpr size_t CAPACITY = 1024;
+
+	public:
+		EventProducer() = default;
+		~EventProducer();
+
+		EventProducer(EventProducer const&) = delete;
+		void operator=(EventProducer const&) = delete;
+
+	public:
+		//must only be called from the owning thread
+		template <typename ...Args>
+		void Push(size_t p_eventId, uint64_t p_sequence, Args&&... p_parameters);
+
+		//adds every record published so far to the given list, oldest first,
+		//they stay valid until Release and must all be consumed before it
+		void Acquire(std::vector<EventRecord*>& p_records);
+		void Release();
+
+	private:
+		std::array<EventRecord, CAPACITY> m_records;
+		alignas(64) std::atomic<size_t> m_head = 0;
+		alignas(64) std::atomic<size_t> m_tail = 0;
+		std::atomic<bool> m_isOverflowing = false;
+
+		std::vector<std::unique_ptr<EventRecord>> m_overflow;
+		std::vector<std::unique_ptr<EventRecord>> m_acquiredOverflow;
+		size_t m_acquiredTail = 0;
+		std::mutex m_overflowMutex;
+	};
+
+	template<typename ...Args>
+	inline void EventRecord::Emplace(size_t p_eventId, uint64_t p_sequence, Args&&... p_parameters)
+	{
+		using Parameters = std::tuple<std::decay_t<Args>...>;
+
+		if constexpr (IsStoredInline<std::decay_t<Args>...>)
+			new(m_storage) Parameters(std::forward<Args>(p_parameters)...);
+		else
+			*reinterpret_cast<Parameters**>(m_storage) = new Parameters(std::forward<Args>(p_parameters)...);
+
+		m_operations = &s_operations<std::decay_t<Args>...>;
+		m_eventId = p_eventId;
+		m_sequence = p_sequence;
+	}
+
+	template<typename ...Args>
+	inline std::tuple<Args...>& EventRecord::GetParameters()
+	{
+		if constexpr (IsStoredInline<Args...>)
+			return *std::launder(reinterpret_cast<std::tuple<Args...>*>(m_storage));
+		else
+			return **reinterpret_cast<std::tuple<Args...>**>(m_storage);
+	}
+
+	template<typename ...Args>
+	inline void EventRecord::DestroyParameters()
+	{
+		if constexpr (IsStoredInline<Args...>)
+			GetParameters<Args...>().~tuple();
+		else
+			delete &GetParameters<Args...>();
+
+		m_operations = nullptr;
+	}
+
+	template<typename ...Args>
+	const EventRecordOperations EventRecord::s_operations =
+	{
+		[](std::unique_ptr<EventQueueBase>& p_queue, EventRecord& p_record)
+		{
+			if (!p_queue)
+				p_queue = std::make_unique<EventQueue<Args...>>();
+
+			static_cast<EventQueue<Args...>&>(*p_queue).Push(std::move(p_record.GetParameters<Args...>()));
+			p_record.DestroyParameters<Args...>();
+		},
+		[](EventBase* p_event, EventRecord& p_record)
+		{
+			if (p_event)
+				static_cast<Event<Args...>*>(p_event)->InvokeBatch({ &p_record.GetParameters<Args...>(), 1 });
+
+			p_record.DestroyParameters<Args...>();
+		},
+		[](EventRecord& p_record)
+		{
+			p_record.DestroyParameters<Args...>();
+		}
+	};
+
+	template<typename ...Args>
+	void EventProducer::Push(size_t p_eventId, uint64_t p_sequence, Args&&... p_parameters)
+	{
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+
+		if (!m_isOverflowing.load(std::memory_order_acquire)
+			&& tail - m_head.load(std::memory_order_acquire) < CAPACITY)
+		{
+			m_records[tail % CAPACITY].Emplace(p_eventId, p_sequence, std::forward<Args>(p_parameters)...);
+			m_tail.store(tail + 1, std::memory_order_release);
+			return;
+		}
+
+		std::unique_ptr<EventRecord> record = std::make_unique<EventRecord>();
+		record->Emplace(p_eventId, p_sequence, std::forward<Args>(p_parameters)...);
+
+		std::scoped_lock lock(m_overflowMutex);
+		m_overflow.push_back(std::move(record));
+		m_isOverflowing.store(true, std::memory_order_relaxed);
+	}
+}
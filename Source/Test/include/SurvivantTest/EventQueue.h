@@ -0,0 +1,56 @@
+//EventQueue.h
+
+#pragma once
+
+#include "Event.h"
+#include "EventBase.h"
+
+#include <tuple>
+#include <vector>
+
+namespace Core
+{
+	class EventQueueBase
+	{
+	public:
+		EventQueueBase() = default;
+		virtual ~EventQueueBase() = default;
+
+	public:
+		//sends the queued events to the given event as a single batch
+		virtual void Dispatch(EventBase* p_event) = 0;
+	};
+
+	//contiguous buffer of queued parameters for a single event type, only used by the flushing thread
+	template <typename ...Args>
+	class EventQueue : public EventQueueBase
+	{
+	public:
+		EventQueue() = default;
+		~EventQueue() override = default;
+
+	public:
+		void Push(std::tuple<Args...>&& p_parameters);
+
+		void Dispatch(EventBase* p_event) override;
+
+	private:
+		std::vector<std::tuple<Args...>> m_events;
+	};
+
+	template<typename ...Args>
+	inline void EventQueue<Args...>::Push(std::tuple<Args...>&& p_parameters)
+	{
+		m_events.push_back(std::move(p_parameters));
+	}
+
+	template<typename ...Args>
+	inline void EventQueue<Args...>::Dispatch(EventBase* p_event)
+	{
+		if (p_event)
+			static_cast<Event<Args...>*>(p_event)->InvokeBatch(m_events);
+
+		//keeps its capacity so a steady flow of events doesn't allocate
+		m_events.clear();
+	}
+}
@@ -10,8 +10,14 @@
 #include "Event.h"
 #include "InputType.h"
 
+#include <Vector/Vector2.h>
+
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace App
 {
@@ -24,10 +30,16 @@ namespace App
 		using GLFWwindow = int;
 		using KeyboardKeyType = InputType<EKey, EKeyState, EInputModifier>;
 		using KeyCallbackParam = char;
-		using KeyCallback = std::function<void(KeyCallbackParam)>;
+		using KeyCallback = Core::Delegate<void(KeyCallbackParam)>;
 		
 		using MouseKeyType = InputType<EMouseButton, EMouseButtonState, EInputModifier>;
-		using MouseCallback = std::function<void(float, float)>;
+		using MouseCallback = Core::Delegate<void(float, float)>;
+
+		//EKey goes from UNKNOWN (-1) to MENU
+		static constexpr size_t KEY_COUNT = static_cast<size_t>(EKey::MENU) + 2;
+		static constexpr size_t KEY_STATE_COUNT = static_cast<size_t>(EKeyState::REPEATED) + 1;
+		static constexpr size_t MOUSE_BUTTON_COUNT = static_cast<size_t>(EMouseButton::MOUSE_8) + 1;
+		static constexpr size_t MOUSE_BUTTON_STATE_COUNT = static_cast<size_t>(EMouseButtonState::PRESSED) + 1;
 
 	public:
 		InputManager() {}
@@ -40,10 +52,13 @@ namespace App
 	public:
 		void CallInput(const KeyboardKeyType& p_type, char p_scancode);
 
+		//several callbacks can be bound to the same input, they are called in the order they were added
 		void AddInputBinding(const KeyboardKeyType& p_type, const KeyCallback& p_callback);
 
+		//queued events are dispatched on the next EventManager::FlushQueue instead of from the input callback
 		template<class Event, typename ...Args>
-		void AddInputEventBinding(const KeyboardKeyType& p_type, std::tuple<Args...> (*p_translate)(KeyCallbackParam));
+		void AddInputEventBinding(const KeyboardKeyType& p_type, std::tuple<Args...> (*p_translate)(KeyCallbackParam),
+			bool p_isQueued = false);
 
 
 		void CallInput(const MouseKeyType& p_type, float p_x, float p_y);
@@ -51,50 +66,103 @@ namespace App
 		void AddInputBinding(const MouseKeyType& p_type, const MouseCallback& p_callback);
 
 		template<class Event, typename ...Args>
-		void AddInputEventBinding(const MouseKeyType& p_type, std::tuple<Args...>(*p_translate)(float, float));
+		void AddInputEventBinding(const MouseKeyType& p_type, std::tuple<Args...>(*p_translate)(float, float),
+			bool p_isQueued = false);
 
-		//void AddInputBinding();
-		//void AddInputBinding();
+		void SetMousePosition(float p_x, float p_y);
 
 	public:
-		//container peripherique
-		std::unordered_map<KeyboardKeyType, KeyCallback> m_keyCallbacks;
-		std::unordered_map<MouseKeyType, MouseCallback> m_mouseKeyCallbacks;
+		//takes a snapshot of the input state for the frame, must be called once per frame after polling the window
+		void Update();
+
+		//polled state as of the last Update, pressed and released are only true for the frame in which it happened
+		bool IsKeyDown(EKey p_key) const;
+		bool IsKeyPressed(EKey p_key) const;
+		bool IsKeyReleased(EKey p_key) const;
+
+		bool IsMouseButtonDown(EMouseButton p_button) const;
+		bool IsMouseButtonPressed(EMouseButton p_button) const;
+		bool IsMouseButtonReleased(EMouseButton p_button) const;
 
+		LibMath::Vector2 GetMousePosition() const;
+		EInputModifier GetModifiers() const;
 
+	private:
+		template <class Callback>
+		struct Binding
+		{
+			EInputModifier m_modifiers;
+			Callback m_callback;
+		};
+
+		template <size_t Count>
+		struct ButtonStates
+		{
+			std::bitset<Count> m_down;
+			std::bitset<Count> m_pressed;
+			std::bitset<Count> m_released;
+		};
+
+		//SIZE_MAX when out of range
+		static size_t GetKeyIndex(EKey p_key);
+		static size_t GetMouseButtonIndex(EMouseButton p_button);
+
+	private:
+		//indexed by key/button then state, the few bindings of each slot are filtered by modifiers
+		std::array<std::vector<Binding<KeyCallback>>, KEY_COUNT * KEY_STATE_COUNT> m_keyBindings;
+		std::array<std::vector<Binding<MouseCallback>>, MOUSE_BUTTON_COUNT * MOUSE_BUTTON_STATE_COUNT> m_mouseBindings;
+
+		//live state written by the window callbacks, copied to the frame state on Update
+		ButtonStates<KEY_COUNT> m_keys;
+		ButtonStates<KEY_COUNT> m_frameKeys;
+		ButtonStates<MOUSE_BUTTON_COUNT> m_mouseButtons;
+		ButtonStates<MOUSE_BUTTON_COUNT> m_frameMouseButtons;
+
+		LibMath::Vector2 m_mousePosition;
+		LibMath::Vector2 m_frameMousePosition;
+		EInputModifier m_modifiers = EInputModifier();
+		EInputModifier m_frameModifiers = EInputModifier();
 	};
 
 	template<class T, typename ...Args>
-	void InputManager::AddInputEventBinding(const KeyboardKeyType& p_type, std::tuple<Args...>(*p_translate)(KeyCallbackParam))
+	void InputManager::AddInputEventBinding(const KeyboardKeyType& p_type, std::tuple<Args...>(*p_translate)(KeyCallbackParam),
+		bool p_isQueued)
 	{
 		if constexpr (!std::is_base_of_v<Core::Event<Args...>, T> || !std::is_same_v<Core::Event<Args...>, T>)
 			return;
 
 		//needs to capture a copy of translate ptr
 		KeyCallback callback = 
-			[p_translate](KeyCallbackParam p_1)
+			[p_translate, p_isQueued](KeyCallbackParam p_1)
 			{ 
-				Core::EventManager::GetInstance().Invoke<T>(p_translate(p_1));
+				if (p_isQueued)
+					Core::EventManager::GetInstance().Enqueue<T>(p_translate(p_1));
+				else
+					Core::EventManager::GetInstance().Invoke<T>(p_translate(p_1));
 			};
 
-		m_keyCallbacks.emplace(p_type, callback);
+		AddInputBinding(p_type, callback);
 
 	}
 
 	template<class T, typename ...Args>
-	inline void InputManager::AddInputEventBinding(const MouseKeyType& p_type, std::tuple<Args...>(*p_translate)(float, float))
+	inline void InputManager::AddInputEventBinding(const MouseKeyType& p_type, std::tuple<Args...>(*p_translate)(float, float),
+		bool p_isQueued)
 	{
 		if constexpr (!std::is_base_of_v<Core::Event<Args...>, T> || !std::is_same_v<Core::Event<Args...>, T>)
 			return;
 
 		//needs to capture a copy of translate ptr
 		MouseCallback callback =
-			[p_translate](float p_1, float p_2)
+			[p_translate, p_isQueued](float p_1, float p_2)
 			{
-				Core::EventManager::GetInstance().Invoke<T>(p_translate(p_1, p_2));
+				if (p_isQueued)
+					Core::EventManager::GetInstance().Enqueue<T>(p_translate(p_1, p_2));
+				else
+					Core::EventManager::GetInstance().Invoke<T>(p_translate(p_1, p_2));
 			};
 
-		m_mouseKeyCallbacks.emplace(p_type, callback);
+		AddInputBinding(p_type, callback);
 	}
 
 	//glfwSetKeyCallback(window, key_callback);
@@ -0,0 +1,76 @@
+//InputRecorder.h
+
+#pragma once
+#include "EInputRecorderMode.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace App
+{
+	//records the window's input events with the frame they happened in, and feeds them back to the InputManager
+	//on the same frames when replaying. with a fixed step timer, every replay of a recording runs the same frames
+	class InputRecorder
+	{
+	public:
+		InputRecorder() {}
+		InputRecorder(InputRecorder const&) = delete;
+		void operator=(InputRecorder const&) = delete;
+
+	public:
+		static InputRecorder& GetInstance();
+
+	public:
+		//the recording is only written to the file once stopped
+		void StartRecording(const std::string& p_path);
+		bool StopRecording();
+
+		//live input must be ignored while replaying, the replay stops on its own after its last frame
+		bool StartReplay(const std::string& p_path);
+		void StopReplay();
+
+		//must be called once per frame, before polling the window.
+		//when replaying, calls the InputManager with the events recorded up to the new frame
+		void NextFrame();
+
+		EInputRecorderMode GetMode() const;
+		bool IsReplaying() const;
+
+	public:
+		//called by the window callbacks with the raw glfw values, ignored when not recording
+		void RecordKey(int p_key, int p_scancode, int p_action, int p_mods);
+		void RecordMouseButton(int p_button, int p_action, int p_mods, float p_x, float p_y);
+		void RecordCursor(float p_x, float p_y);
+
+	private:
+		enum class ERecordType : uint8_t
+		{
+			KEY          = 0,
+			MOUSE_BUTTON = 1,
+			CURSOR       = 2
+		};
+
+		struct Record
+		{
+			uint32_t m_frame;
+			ERecordType m_type;
+			int16_t m_button;
+			int8_t m_scancode;
+			uint8_t m_action;
+			uint8_t m_mods;
+			float m_x;
+			float m_y;
+		};
+
+		static void CallInput(const Record& p_record);
+
+	private:
+		EInputRecorderMode m_mode = EInputRecorderMode::NONE;
+		std::string m_path;
+		std::vector<Record> m_records;
+		size_t m_replayIndex = 0;
+		uint32_t m_frame = 0;
+		uint32_t m_frameCount = 0;
+	};
+}
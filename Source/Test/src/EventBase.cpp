@@ -1,4 +1,12 @@
-//#include "EventBase.h"
 //EventBase.cpp
 
+#include "SurvivantTest/EventBase.h"
 
+#include <atomic>
+
+Core::EventBase::ListenerId Core::EventBase::NextListenerId()
+{
+    static std::atomic<ListenerId> s_nextId = 0;
+
+    return s_nextId.fetch_add(1, std::memory_order_relaxed);
+}
@@ -2,6 +2,9 @@
 
 #include "SurvivantTest/EventManager.h"
 
+#include <algorithm>
+#include <atomic>
+
 using namespace Core;
 
 EventManager& Core::EventManager::GetInstance()
@@ -10,3 +13,117 @@ EventManager& Core::EventManager::GetInstance()
 
     return s_instance;
 }
+
+namespace
+{
+    std::atomic<uint64_t> g_nextManagerId = 0;
+}
+
+Core::EventManager::EventManager()
+    : m_managerId(g_nextManagerId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+Core::EventManager::~EventManager() = default;
+
+void Core::EventManager::FlushQueue()
+{
+    {
+        std::scoped_lock lock(m_producerMutex);
+
+        for (std::unique_ptr<EventProducer>& producer : m_producers)
+            m_flushedProducers.push_back(producer.get());
+    }
+
+    for (EventProducer* producer : m_flushedProducers)
+        producer->Acquire(m_flushedRecords);
+
+    if (m_order.load(std::memory_order_relaxed) == EEventOrder::SEQUENTIAL)
+        DispatchSequential();
+    else
+        DispatchBatched();
+
+    m_flushedProducers.clear();
+}
+
+void Core::EventManager::SetOrder(EEventOrder p_order)
+{
+    m_order.store(p_order, std::memory_order_relaxed);
+}
+
+Core::EEventOrder Core::EventManager::GetOrder() const
+{
+    return m_order.load(std::memory_order_relaxed);
+}
+
+Core::EventProducer& Core::EventManager::GetProducer()
+{
+    //a thread can publish to several managers, which are told apart by id in case one is recreated at the same address
+    thread_local std::vector<std::pair<uint64_t, EventProducer*>> t_producers;
+
+    for (auto& [managerId, producer] : t_producers)
+    {
+        if (managerId == m_managerId)
+            return *producer;
+    }
+
+    std::scoped_lock lock(m_producerMutex);
+
+    EventProducer* producer = m_producers.emplace_back(std::make_unique<EventProducer>()).get();
+    t_producers.emplace_back(m_managerId, producer);
+
+    return *producer;
+}
+
+void Core::EventManager::DispatchBatched()
+{
+    //the parameters are moved to their event's queue so the producers can be released before any listener runs
+    for (EventRecord* record : m_flushedRecords)
+    {
+        EventId id = record->m_eventId;
+
+        if (id >= m_queues.size())
+            m_queues.resize(id + 1);
+
+        if (std::find(m_queuedIds.begin(), m_queuedIds.end(), id) == m_queuedIds.end())
+            m_queuedIds.push_back(id);
+
+        record->m_operations->m_push(m_queues[id], *record);
+    }
+
+    m_flushedRecords.clear();
+
+    for (EventProducer* producer : m_flushedProducers)
+        producer->Release();
+
+    //listeners can queue new events, which are kept for the next flush
+    for (EventId id : m_queuedIds)
+        m_queues[id]->Dispatch(id < m_events.size() ? m_events[id].get() : nullptr);
+
+    m_queuedIds.clear();
+}
+
+void Core::EventManager::DispatchSequential()
+{
+    std::stable_sort(m_flushedRecords.begin(), m_flushedRecords.end(),
+        [](const EventRecord* p_a, const EventRecord* p_b) { return p_a->m_sequence < p_b->m_sequence; });
+
+    //the records stay in the producers' buffers until dispatched, events queued meanwhile are written after them
+    for (EventRecord* record : m_flushedRecords)
+    {
+        EventId id = record->m_eventId;
+        record->m_operations->m_dispatch(id < m_events.size() ? m_events[id].get() : nullptr, *record);
+    }
+
+    m_flushedRecords.clear();
+
+    for (EventProducer* producer : m_flushedProducers)
+        producer->Release();
+}
+
+Core::EventManager::EventId Core::EventManager::NextEventId()
+{
+    static std::atomic<EventId> s_nextId = 0;
+
+    return s_nextId.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,37 @@
+//EventProducer.cpp
+
+#include "SurvivantTest/EventProducer.h"
+
+Core::EventProducer::~EventProducer()
+{
+    for (size_t i = m_head.load(std::memory_order_relaxed); i < m_tail.load(std::memory_order_relaxed); ++i)
+        m_records[i % CAPACITY].m_operations->m_destroy(m_records[i % CAPACITY]);
+
+    for (std::unique_ptr<EventRecord>& record : m_overflow)
+        record->m_operations->m_destroy(*record);
+}
+
+void Core::EventProducer::Acquire(std::vector<EventRecord*>& p_records)
+{
+    {
+        std::scoped_lock lock(m_overflowMutex);
+
+        //the tail is read before the overflow flag is cleared,
+        //so events pushed to the ring afterwards are left for the next flush, after the overflow ones
+        m_acquiredTail = m_tail.load(std::memory_order_acquire);
+        m_acquiredOverflow.swap(m_overflow);
+        m_isOverflowing.store(false, std::memory_order_release);
+    }
+
+    for (size_t i = m_head.load(std::memory_order_relaxed); i < m_acquiredTail; ++i)
+        p_records.push_back(&m_records[i % CAPACITY]);
+
+    for (std::unique_ptr<EventRecord>& record : m_acquiredOverflow)
+        p_records.push_back(record.get());
+}
+
+void Core::EventProducer::Release()
+{
+    m_head.store(m_acquiredTail, std::memory_order_release);
+    m_acquiredOverflow.clear();
+}
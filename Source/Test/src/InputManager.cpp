@@ -13,35 +13,174 @@ InputManager& App::InputManager::GetInstance()
 
 void App::InputManager::CallInput(const KeyboardKeyType& p_type, char p_scancode)
 {
-	auto callback = m_keyCallbacks.find(p_type);
+	const auto& [key, state, modifiers] = p_type.m_inputInfo;
+	const size_t keyIndex = GetKeyIndex(key);
+	const size_t stateIndex = static_cast<size_t>(state);
 
-	if (callback == m_keyCallbacks.end())
+	if (keyIndex == SIZE_MAX || stateIndex >= KEY_STATE_COUNT)
 		return;
 
-	//calls keyboard callback with scancode
-	
-	callback->second(p_scancode);
+	m_modifiers = modifiers;
+
+	if (state == EKeyState::PRESSED)
+	{
+		m_keys.m_down.set(keyIndex);
+		m_keys.m_pressed.set(keyIndex);
+	}
+	else if (state == EKeyState::RELEASED)
+	{
+		m_keys.m_down.reset(keyIndex);
+		m_keys.m_released.set(keyIndex);
+	}
+
+	//calls keyboard callbacks with scancode
+	//indexed and copied in case a callback adds a binding to the same input
+	std::vector<Binding<KeyCallback>>& bindings = m_keyBindings[keyIndex * KEY_STATE_COUNT + stateIndex];
+
+	for (size_t i = 0; i < bindings.size(); ++i)
+	{
+		if (bindings[i].m_modifiers == modifiers)
+		{
+			KeyCallback callback = bindings[i].m_callback;
+			callback(p_scancode);
+		}
+	}
 }
 
 void App::InputManager::AddInputBinding(
 	const KeyboardKeyType& p_type, 
 	const KeyCallback& p_callback)
 {
-	m_keyCallbacks.emplace(p_type, p_callback);
+	const auto& [key, state, modifiers] = p_type.m_inputInfo;
+	const size_t keyIndex = GetKeyIndex(key);
+	const size_t stateIndex = static_cast<size_t>(state);
+
+	if (keyIndex == SIZE_MAX || stateIndex >= KEY_STATE_COUNT)
+		return;
+
+	m_keyBindings[keyIndex * KEY_STATE_COUNT + stateIndex].push_back({ modifiers, p_callback });
 }
 
 void App::InputManager::CallInput(const MouseKeyType& p_type, float p_x, float p_y)
 {
-	auto callback = m_mouseKeyCallbacks.find(p_type);
+	const auto& [button, state, modifiers] = p_type.m_inputInfo;
+	const size_t buttonIndex = GetMouseButtonIndex(button);
+	const size_t stateIndex = static_cast<size_t>(state);
 
-	if (callback == m_mouseKeyCallbacks.end())
+	if (buttonIndex == SIZE_MAX || stateIndex >= MOUSE_BUTTON_STATE_COUNT)
 		return;
 
-	//calls mouse key callback with mous pos (x,y)
-	callback->second(p_x, p_y);
+	m_modifiers = modifiers;
+	m_mousePosition = { p_x, p_y };
+
+	if (state == EMouseButtonState::PRESSED)
+	{
+		m_mouseButtons.m_down.set(buttonIndex);
+		m_mouseButtons.m_pressed.set(buttonIndex);
+	}
+	else
+	{
+		m_mouseButtons.m_down.reset(buttonIndex);
+		m_mouseButtons.m_released.set(buttonIndex);
+	}
+
+	//calls mouse key callbacks with mous pos (x,y)
+	std::vector<Binding<MouseCallback>>& bindings = m_mouseBindings[buttonIndex * MOUSE_BUTTON_STATE_COUNT + stateIndex];
+
+	for (size_t i = 0; i < bindings.size(); ++i)
+	{
+		if (bindings[i].m_modifiers == modifiers)
+		{
+			MouseCallback callback = bindings[i].m_callback;
+			callback(p_x, p_y);
+		}
+	}
 }
 
 void App::InputManager::AddInputBinding(const MouseKeyType& p_type, const MouseCallback& p_callback)
 {
-	m_mouseKeyCallbacks.emplace(p_type, p_callback);
+	const auto& [button, state, modifiers] = p_type.m_inputInfo;
+	const size_t buttonIndex = GetMouseButtonIndex(button);
+	const size_t stateIndex = static_cast<size_t>(state);
+
+	if (buttonIndex == SIZE_MAX || stateIndex >= MOUSE_BUTTON_STATE_COUNT)
+		return;
+
+	m_mouseBindings[buttonIndex * MOUSE_BUTTON_STATE_COUNT + stateIndex].push_back({ modifiers, p_callback });
+}
+
+void App::InputManager::SetMousePosition(float p_x, float p_y)
+{
+	m_mousePosition = { p_x, p_y };
+}
+
+void App::InputManager::Update()
+{
+	m_frameKeys = m_keys;
+	m_frameMouseButtons = m_mouseButtons;
+	m_frameMousePosition = m_mousePosition;
+	m_frameModifiers = m_modifiers;
+
+	m_keys.m_pressed.reset();
+	m_keys.m_released.reset();
+	m_mouseButtons.m_pressed.reset();
+	m_mouseButtons.m_released.reset();
+}
+
+bool App::InputManager::IsKeyDown(EKey p_key) const
+{
+	const size_t index = GetKeyIndex(p_key);
+	return index != SIZE_MAX && m_frameKeys.m_down.test(index);
+}
+
+bool App::InputManager::IsKeyPressed(EKey p_key) const
+{
+	const size_t index = GetKeyIndex(p_key);
+	return index != SIZE_MAX && m_frameKeys.m_pressed.test(index);
+}
+
+bool App::InputManager::IsKeyReleased(EKey p_key) const
+{
+	const size_t index = GetKeyIndex(p_key);
+	return index != SIZE_MAX && m_frameKeys.m_released.test(index);
+}
+
+bool App::InputManager::IsMouseButtonDown(EMouseButton p_button) const
+{
+	const size_t index = GetMouseButtonIndex(p_button);
+	return index != SIZE_MAX && m_frameMouseButtons.m_down.test(index);
+}
+
+bool App::InputManager::IsMouseButtonPressed(EMouseButton p_button) const
+{
+	const size_t index = GetMouseButtonIndex(p_button);
+	return index != SIZE_MAX && m_frameMouseButtons.m_pressed.test(index);
+}
+
+bool App::InputManager::IsMouseButtonReleased(EMouseButton p_button) const
+{
+	const size_t index = GetMouseButtonIndex(p_button);
+	return index != SIZE_MAX && m_frameMouseButtons.m_released.test(index);
+}
+
+LibMath::Vector2 App::InputManager::GetMousePosition() const
+{
+	return m_frameMousePosition;
+}
+
+EInputModifier App::InputManager::GetModifiers() const
+{
+	return m_frameModifiers;
+}
+
+size_t App::InputManager::GetKeyIndex(EKey p_key)
+{
+	const size_t index = static_cast<size_t>(static_cast<int>(p_key) + 1);
+	return index < KEY_COUNT ? index : SIZE_MAX;
+}
+
+size_t App::InputManager::GetMouseButtonIndex(EMouseButton p_button)
+{
+	const size_t index = static_cast<size_t>(p_button);
+	return index < MOUSE_BUTTON_COUNT ? index : SIZE_MAX;
 }
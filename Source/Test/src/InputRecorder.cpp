@@ -0,0 +1,328 @@
+//InputRecorder.cpp
+
+#include "SurvivantTest/InputRecorder.h"
+#include "SurvivantTest/InputManager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace App;
+
+namespace
+{
+	//file layout: header, then one record per event, each starting with its type and the number of frames since
+	//the previous record as a varint, followed by the type's values
+	constexpr char MAGIC[4] = { 'S', 'V', 'I', 'R' };
+	constexpr uint32_t VERSION = 1;
+
+	template <typename T>
+	void Write(std::vector<uint8_t>& p_buffer, T p_value)
+	{
+		const size_t offset = p_buffer.size();
+		p_buffer.resize(offset + sizeof(T));
+		std::memcpy(p_buffer.data() + offset, &p_value, sizeof(T));
+	}
+
+	void WriteVarint(std::vector<uint8_t>& p_buffer, uint32_t p_value)
+	{
+		while (p_value >= 0x80)
+		{
+			p_buffer.push_back(static_cast<uint8_t>(p_value | 0x80));
+			p_value >>= 7;
+		}
+
+		p_buffer.push_back(static_cast<uint8_t>(p_value));
+	}
+
+	template <typename T>
+	bool Read(const std::vector<uint8_t>& p_buffer, size_t& p_offset, T& p_value)
+	{
+		if (p_buffer.size() - p_offset < sizeof(T))
+			return false;
+
+		std::memcpy(&p_value, p_buffer.data() + p_offset, sizeof(T));
+		p_offset += sizeof(T);
+		return true;
+	}
+
+	bool ReadVarint(const std::vector<uint8_t>& p_buffer, size_t& p_offset, uint32_t& p_value)
+	{
+		p_value = 0;
+
+		for (uint32_t shift = 0; shift < 32; shift += 7)
+		{
+			if (p_offset >= p_buffer.size())
+				return false;
+
+			const uint8_t byte = p_buffer[p_offset++];
+			p_value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+
+			if (!(byte & 0x80))
+				return true;
+		}
+
+		return false;
+	}
+}
+
+InputRecorder& App::InputRecorder::GetInstance()
+{
+	static InputRecorder s_instance;
+
+	return s_instance;
+}
+
+void App::InputRecorder::StartRecording(const std::string& p_path)
+{
+	StopReplay();
+
+	m_mode = EInputRecorderMode::RECORDING;
+	m_path = p_path;
+	m_records.clear();
+	m_frame = 0;
+}
+
+bool App::InputRecorder::StopRecording()
+{
+	if (m_mode != EInputRecorderMode::RECORDING)
+		return false;
+
+	m_mode = EInputRecorderMode::NONE;
+
+	std::vector<uint8_t> buffer;
+	buffer.insert(buffer.end(), std::begin(MAGIC), std::end(MAGIC));
+	Write(buffer, VERSION);
+	Write(buffer, m_frame);
+	Write(buffer, static_cast<uint32_t>(m_records.size()));
+
+	uint32_t previousFrame = 0;
+
+	for (const Record& record : m_records)
+	{
+		Write(buffer, record.m_type);
+		WriteVarint(buffer, record.m_frame - previousFrame);
+		previousFrame = record.m_frame;
+
+		switch (record.m_type)
+		{
+		case ERecordType::KEY:
+			Write(buffer, record.m_button);
+			Write(buffer, record.m_scancode);
+			Write(buffer, record.m_action);
+			Write(buffer, record.m_mods);
+			break;
+		case ERecordType::MOUSE_BUTTON:
+			Write(buffer, static_cast<uint8_t>(record.m_button));
+			Write(buffer, record.m_action);
+			Write(buffer, record.m_mods);
+			Write(buffer, record.m_x);
+			Write(buffer, record.m_y);
+			break;
+		case ERecordType::CURSOR:
+			Write(buffer, record.m_x);
+			Write(buffer, record.m_y);
+			break;
+		}
+	}
+
+	m_records.clear();
+
+	std::ofstream file(m_path, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open())
+		return false;
+
+	file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+	return file.good();
+}
+
+bool App::InputRecorder::StartReplay(const std::string& p_path)
+{
+	if (m_mode == EInputRecorderMode::RECORDING)
+		StopRecording();
+
+	StopReplay();
+
+	std::ifstream file(p_path, std::ios::binary);
+
+	if (!file.is_open())
+		return false;
+
+	const std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	size_t offset = 0;
+	char magic[4];
+	uint32_t version, frameCount, recordCount;
+
+	for (char& c : magic)
+	{
+		if (!Read(buffer, offset, c))
+			return false;
+	}
+
+	if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || !Read(buffer, offset, version) || version != VERSION
+		|| !Read(buffer, offset, frameCount) || !Read(buffer, offset, recordCount))
+		return false;
+
+	std::vector<Record> records;
+	uint32_t frame = 0;
+
+	//the count isn't trusted for the reserve, a record takes at least 2 bytes
+	records.reserve(std::min<size_t>(recordCount, (buffer.size() - offset) / 2));
+
+	for (uint32_t i = 0; i < recordCount; ++i)
+	{
+		Record record = {};
+		uint32_t frameDelta;
+		uint8_t button;
+
+		if (!Read(buffer, offset, record.m_type) || !ReadVarint(buffer, offset, frameDelta))
+			return false;
+
+		frame += frameDelta;
+		record.m_frame = frame;
+
+		bool isValid;
+
+		switch (record.m_type)
+		{
+		case ERecordType::KEY:
+			isValid = Read(buffer, offset, record.m_button) && Read(buffer, offset, record.m_scancode)
+				&& Read(buffer, offset, record.m_action) && Read(buffer, offset, record.m_mods);
+			break;
+		case ERecordType::MOUSE_BUTTON:
+			isValid = Read(buffer, offset, button) && Read(buffer, offset, record.m_action)
+				&& Read(buffer, offset, record.m_mods) && Read(buffer, offset, record.m_x) && Read(buffer, offset, record.m_y);
+			record.m_button = button;
+			break;
+		case ERecordType::CURSOR:
+			isValid = Read(buffer, offset, record.m_x) && Read(buffer, offset, record.m_y);
+			break;
+		default:
+			isValid = false;
+			break;
+		}
+
+		if (!isValid)
+			return false;
+
+		records.push_back(record);
+	}
+
+	m_mode = EInputRecorderMode::REPLAYING;
+	m_records = std::move(records);
+	m_replayIndex = 0;
+	m_frame = 0;
+	m_frameCount = frameCount;
+
+	return true;
+}
+
+void App::InputRecorder::StopReplay()
+{
+	if (m_mode != EInputRecorderMode::REPLAYING)
+		return;
+
+	m_mode = EInputRecorderMode::NONE;
+	m_records.clear();
+	m_replayIndex = 0;
+}
+
+void App::InputRecorder::NextFrame()
+{
+	if (m_mode == EInputRecorderMode::NONE)
+		return;
+
+	++m_frame;
+
+	if (m_mode != EInputRecorderMode::REPLAYING)
+		return;
+
+	if (m_frame > m_frameCount)
+	{
+		StopReplay();
+		return;
+	}
+
+	for (; m_replayIndex < m_records.size() && m_records[m_replayIndex].m_frame <= m_frame; ++m_replayIndex)
+		CallInput(m_records[m_replayIndex]);
+}
+
+EInputRecorderMode App::InputRecorder::GetMode() const
+{
+	return m_mode;
+}
+
+bool App::InputRecorder::IsReplaying() const
+{
+	return m_mode == EInputRecorderMode::REPLAYING;
+}
+
+void App::InputRecorder::RecordKey(int p_key, int p_scancode, int p_action, int p_mods)
+{
+	if (m_mode != EInputRecorderMode::RECORDING)
+		return;
+
+	m_records.push_back({
+		m_frame, ERecordType::KEY, static_cast<int16_t>(p_key), static_cast<int8_t>(p_scancode),
+		static_cast<uint8_t>(p_action), static_cast<uint8_t>(p_mods), 0.f, 0.f
+	});
+}
+
+void App::InputRecorder::RecordMouseButton(int p_button, int p_action, int p_mods, float p_x, float p_y)
+{
+	if (m_mode != EInputRecorderMode::RECORDING)
+		return;
+
+	m_records.push_back({
+		m_frame, ERecordType::MOUSE_BUTTON, static_cast<int16_t>(p_button), 0,
+		static_cast<uint8_t>(p_action), static_cast<uint8_t>(p_mods), p_x, p_y
+	});
+}
+
+void App::InputRecorder::RecordCursor(float p_x, float p_y)
+{
+	if (m_mode != EInputRecorderMode::RECORDING)
+		return;
+
+	//only the last position of a frame is seen by the input state, the previous moves in the frame are dropped
+	if (!m_records.empty() && m_records.back().m_type == ERecordType::CURSOR && m_records.back().m_frame == m_frame)
+	{
+		m_records.back().m_x = p_x;
+		m_records.back().m_y = p_y;
+		return;
+	}
+
+	m_records.push_back({ m_frame, ERecordType::CURSOR, 0, 0, 0, 0, p_x, p_y });
+}
+
+void App::InputRecorder::CallInput(const Record& p_record)
+{
+	InputManager& inputManager = InputManager::GetInstance();
+
+	switch (p_record.m_type)
+	{
+	case ERecordType::KEY:
+		inputManager.CallInput(
+			InputManager::KeyboardKeyType(
+				static_cast<EKey>(p_record.m_button),
+				static_cast<EKeyState>(p_record.m_action),
+				static_cast<EInputModifier>(p_record.m_mods)),
+			static_cast<char>(p_record.m_scancode));
+		break;
+	case ERecordType::MOUSE_BUTTON:
+		inputManager.CallInput(
+			InputManager::MouseKeyType(
+				static_cast<EMouseButton>(p_record.m_button),
+				static_cast<EMouseButtonState>(p_record.m_action),
+				static_cast<EInputModifier>(p_record.m_mods)),
+			p_record.m_x,
+			p_record.m_y);
+		break;
+	case ERecordType::CURSOR:
+		inputManager.SetMousePosition(p_record.m_x, p_record.m_y);
+		break;
+	}
+}
@@ -3,6 +3,7 @@
 #include "SurvivantCore/Debug/Assertion.h"
 #include "SurvivantTest/Window.h"
 #include "SurvivantTest/InputManager.h"
+#include "SurvivantTest/InputRecorder.h"
 
 #include "GLFW/glfw3.h"
 //#include "glad/gl.h"
@@ -13,6 +14,15 @@ using namespace App;
 void InputManagerKeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
     window;
+
+    //live input is ignored while replaying a recording
+    InputRecorder& recorder = InputRecorder::GetInstance();
+
+    if (recorder.IsReplaying())
+        return;
+
+    recorder.RecordKey(key, scancode, action, mods);
+
     //key;
     //scancode;
     //action;
@@ -35,8 +45,14 @@ void InputManagerKeyCallback(GLFWwindow* window, int key, int scancode, int acti
 void InputManagerMousCallback(GLFWwindow* window, int button, int action, int mods)
 {
     window;
+    InputRecorder& recorder = InputRecorder::GetInstance();
+
+    if (recorder.IsReplaying())
+        return;
+
     double xpos, ypos;
     glfwGetCursorPos(window, &xpos, &ypos);
+    recorder.RecordMouseButton(button, action, mods, static_cast<float>(xpos), static_cast<float>(ypos));
 
     InputManager::GetInstance().CallInput(
         InputManager::MouseKeyType(
@@ -47,6 +63,18 @@ void InputManagerMousCallback(GLFWwindow* window, int button, int action, int mo
         static_cast<float>(ypos));
 }
 
+void InputManagerCursorCallback(GLFWwindow* window, double xpos, double ypos)
+{
+    window;
+    InputRecorder& recorder = InputRecorder::GetInstance();
+
+    if (recorder.IsReplaying())
+        return;
+
+    recorder.RecordCursor(static_cast<float>(xpos), static_cast<float>(ypos));
+    InputManager::GetInstance().SetMousePosition(static_cast<float>(xpos), static_cast<float>(ypos));
+}
+
 Window::Window()
 {
 
@@ -74,5 +102,6 @@ void App::Window::SetupInputManager(GLFWwindow* p_window)
 {
     glfwSetKeyCallback(p_window, InputManagerKeyCallback);
     glfwSetMouseButtonCallback(p_window, InputManagerMousCallback);
+    glfwSetCursorPosCallback(p_window, InputManagerCursorCallback);
 }
 
@@ -1,24 +1,48 @@
 #include "SurvivantTest/EventManager.h"
 #include "SurvivantTest/InputManager.h"
+#include "SurvivantTest/InputRecorder.h"
 
 #include <SurvivantCore/Debug/Assertion.h>
+#include <SurvivantCore/Debug/Profiler.h>
+#include <SurvivantCore/ECS/Prefab.h>
+#include <SurvivantCore/ECS/World.h>
+#include <SurvivantCore/Memory/FrameAllocator.h>
+#include <SurvivantCore/Memory/IObjectPool.h>
+#include <SurvivantCore/Memory/MemoryTracker.h>
+#include <SurvivantCore/Resources/ResourceLoader.h>
+#include <SurvivantCore/Resources/ResourceManager.h>
+#include <SurvivantCore/Threading/JobSystem.h>
 #include <SurvivantCore/Utility/FileSystem.h>
+#include <SurvivantCore/Utility/FrameStats.h>
 #include <SurvivantCore/Utility/Timer.h>
 
 #include <SurvivantRendering/Core/Camera.h>
 #include <SurvivantRendering/Core/Color.h>
+#include <SurvivantRendering/Core/GpuProfiler.h>
 #include <SurvivantRendering/Resources/Model.h>
 #include <SurvivantRendering/Resources/Shader.h>
 #include <SurvivantRendering/Resources/Texture.h>
 
 #include <Transform.h>
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <vector>
+
 // TODO: Implement relevant parts in corresponding libs to get rid of glad dependency
 #include <glad/gl.h>
 
 #include "SurvivantTest/Window.h"
 
 using namespace LibMath;
+using namespace SvCore::Debug;
+using namespace SvCore::ECS;
+using namespace SvCore::Enums;
+using namespace SvCore::Memory;
+using namespace SvCore::Resources;
+using namespace SvCore::Threading;
 using namespace SvCore::Utility;
 using namespace SvRendering::Core;
 using namespace SvRendering::Core::Buffers;
@@ -26,27 +50,36 @@ using namespace SvRendering::Enums;
 using namespace SvRendering::Geometry;
 using namespace SvRendering::Resources;
 
-constexpr const char* UNLIT_SHADER_PATH  = "assets/shaders/Unlit.glsl";
-constexpr float       CAM_MOVE_SPEED     = 3.f;
-constexpr Radian      CAM_ROTATION_SPEED = 90_deg;
+constexpr const char* UNLIT_SHADER_PATH     = "assets/shaders/Unlit.glsl";
+constexpr const char* GRID_TEXTURE_PATH     = "assets/textures/grid.png";
+constexpr const char* CUBE_MODEL_PATH       = "assets/models/cube.obj";
+constexpr const char* PROFILER_CAPTURE_PATH = "profile.json";
+constexpr const char* FRAME_STATS_PATH      = "frame_stats.csv";
+constexpr const char* FRAME_SUMMARY_PATH    = "frame_summary.csv";
+constexpr size_t      TEXTURE_BUDGET        = 256ull << 20;
+constexpr size_t      MESH_BUDGET           = 64ull << 20;
+constexpr float       INPUT_RECORD_STEP     = 1.f / 60.f;
+constexpr float       CAM_MOVE_SPEED        = 3.f;
+constexpr Radian      CAM_ROTATION_SPEED    = 90_deg;
+constexpr size_t      RING_CUBE_COUNT       = 64;
+constexpr float       RING_RADIUS           = 3.f;
 
 Texture& GetTexture()
 {
-    static Texture texture;
-    static bool    isLoaded = false;
+    ResourceManager&        resourceManager = ResourceManager::GetInstance();
+    ResourceHandle<Texture> handle          = resourceManager.Find<Texture>(GRID_TEXTURE_PATH);
 
-    if (!isLoaded)
+    if (!handle.IsValid())
     {
-        ASSERT(texture.Load("assets/textures/grid.png"));
-        ASSERT(texture.Init());
+        handle = resourceManager.Load<Texture>(GRID_TEXTURE_PATH);
+        ASSERT(handle.IsValid(), "Failed to load texture at path \"%s\"", GRID_TEXTURE_PATH);
 
+        Texture& texture = *resourceManager.Get(handle);
         texture.SetFilters(ETextureFilter::NEAREST, ETextureFilter::NEAREST);
         texture.SetWrapModes(ETextureWrapMode::REPEAT, ETextureWrapMode::REPEAT);
-
-        isLoaded = true;
     }
 
-    return texture;
+    return *resourceManager.Get(handle);
 }
 
 std::tuple<int, int> AddInputTranslate(char i)
@@ -59,20 +92,125 @@ std::tuple<int, int> AddMouseTranslate(float i, float j)
     return { (int)i, (int)j };
 }
 
-void DrawModel(const Model& p_model)
+struct ModelRenderer
+{
+    const Model* m_model;
+    Color        m_tint;
+};
+
+// Copying a mesh uploads its buffers again, so instances share it instead
+struct MeshRenderer
+{
+    Shared<Mesh> m_mesh;
+    Color        m_tint;
+};
+
+struct Spinner
+{
+    Degree m_speed;
+    Degree m_angle;
+};
+
+// Built during culling in the frame allocator, so drawing doesn't touch the heap
+struct DrawCall
+{
+    const Mesh* m_mesh;
+    Matrix4     m_mvp;
+    Color       m_tint;
+};
+
+using DrawList = std::pmr::vector<DrawCall>;
+
+// Pooled transforms get moved around, so they must not be the parent of other transforms
+SV_SPARSE_COMPONENT(LibMath::Transform);
+SV_SPARSE_COMPONENT(ModelRenderer);
+SV_SPARSE_COMPONENT(MeshRenderer);
+
+BoundingBox GetLocalBounds(const ModelRenderer& p_renderer)
+{
+    return p_renderer.m_model->GetBoundingBox();
+}
+
+BoundingBox GetLocalBounds(const MeshRenderer& p_renderer)
+{
+    return p_renderer.m_mesh->GetBoundingBox();
+}
+
+void AddDrawCalls(const ModelRenderer& p_renderer, const Matrix4& p_mvp, DrawList& p_drawList)
+{
+    for (size_t i = 0; i < p_renderer.m_model->GetMeshCount(); ++i)
+        p_drawList.push_back({ &p_renderer.m_model->GetMesh(i), p_mvp, p_renderer.m_tint });
+}
+
+void AddDrawCalls(const MeshRenderer& p_renderer, const Matrix4& p_mvp, DrawList& p_drawList)
+{
+    p_drawList.push_back({ &p_renderer.m_mesh.Get(), p_mvp, p_renderer.m_tint });
+}
+
+template <class Renderer>
+void CullRenderers(View<const Transform, const Renderer>& p_view, const Frustum& p_frustum,
+                   const Matrix4& p_viewProjection, DrawList& p_drawList)
 {
-    for (size_t i = 0; i < p_model.GetMeshCount(); ++i)
+    // The renderers' pools only change when entities are spawned, so they stay packed between frames
+    p_view.Pack();
+    p_view.ForEachPacked([&](const size_t p_count, const Entity*, const Transform* p_transforms,
+                             const Renderer* p_renderers)
     {
-        const Mesh& mesh = p_model.GetMesh(i);
+        for (size_t i = 0; i < p_count; ++i)
+        {
+            const Matrix4     worldMatrix = p_transforms[i].getWorldMatrix();
+            const BoundingBox bounds      = TransformBoundingBox(GetLocalBounds(p_renderers[i]), worldMatrix);
+
+            if (p_frustum.Intersects(bounds))
+                AddDrawCalls(p_renderers[i], p_viewProjection * worldMatrix, p_drawList);
+        }
+    });
+}
+
+void DrawAll(Shader& p_shader, DrawList& p_drawList)
+{
+    SV_PROFILE_FUNCTION();
+
+    // Instances sharing a mesh are drawn together, binding it once
+    std::ranges::sort(p_drawList, std::less<>(), &DrawCall::m_mesh);
 
-        mesh.Bind();
-        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.GetIndexCount()), GL_UNSIGNED_INT, nullptr);
+    const Mesh* boundMesh = nullptr;
+
+    for (const DrawCall& drawCall : p_drawList)
+    {
+        if (drawCall.m_mesh != boundMesh)
+        {
+            drawCall.m_mesh->Bind();
+            boundMesh = drawCall.m_mesh;
+        }
+
+        p_shader.SetUniformMat4("u_mvp", drawCall.m_mvp);
+        p_shader.SetUniformVec4("u_tint", drawCall.m_tint);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(drawCall.m_mesh->GetIndexCount()), GL_UNSIGNED_INT, nullptr);
+    }
+}
+
+void AddSubsystemTimings(FrameStats& p_frameStats)
+{
+    uint32_t frameThread = UINT32_MAX;
+
+    // Subsystems are the frame zone's direct children
+    for (const ProfileZoneStats& zone : Profiler::GetInstance().GetFrameZones())
+    {
+        if (zone.m_depth == 0 && std::strcmp(zone.m_name, "Frame") == 0)
+            frameThread = zone.m_thread;
+        else if (zone.m_depth == 1 && zone.m_thread == frameThread)
+            p_frameStats.AddTiming(zone.m_name, static_cast<float>(zone.m_totalMs));
     }
 }
 
-int main()
+int main(int p_argc, char** p_argv)
 {
     SvCore::Debug::Logger::GetInstance().SetFile("debug.log");
+    SvCore::Debug::Logger::GetInstance().StartAsync();
+    Profiler::GetInstance().SetThreadName("Main");
+    MemoryTracker::SetBudget(EMemoryTag::TEXTURES, TEXTURE_BUDGET);
+    MemoryTracker::SetBudget(EMemoryTag::MESHES, MESH_BUDGET);
 
     ASSERT(SetWorkingDirectory(GetApplicationDirectory()), "Failed to update working directory");
     SV_LOG("Current working directory: \"%s\"", GetWorkingDirectory().c_str());
@@ -86,21 +224,30 @@ int main()
     glfwMakeContextCurrent(window);
 
     ASSERT(gladLoadGL(glfwGetProcAddress), "Failed to initialize glad");
+    GpuProfiler::GetInstance().Initialize();
 
     glEnable(GL_DEPTH_TEST);
     App::Window::SetupInputManager(window);
 
-    Model model;
+    ResourceManager& resourceManager = ResourceManager::GetInstance();
+    ResourceLoader   resourceLoader(resourceManager);
+
+    const LoadTicket modelTicket   = resourceLoader.LoadAsync<Model>(CUBE_MODEL_PATH);
+    const LoadTicket textureTicket = resourceLoader.LoadAsync<Texture>(GRID_TEXTURE_PATH);
+    const LoadTicket shaderTicket  = resourceLoader.LoadAsync<Shader>(UNLIT_SHADER_PATH);
 
-    ASSERT(model.Load("assets/models/cube.obj"), "Failed to load model");
-    ASSERT(model.Init(), "Failed to initialize model");
+    resourceLoader.Flush();
+
+    ASSERT(resourceLoader.GetState(modelTicket) == ELoadState::READY, "Failed to load model");
+    ASSERT(resourceLoader.GetState(textureTicket) == ELoadState::READY, "Failed to load texture");
+    ASSERT(resourceLoader.GetState(shaderTicket) == ELoadState::READY, "Failed to load shader at path \"%s\"", UNLIT_SHADER_PATH);
+
+    const Model& model = *resourceManager.Get(resourceLoader.GetHandle<Model>(modelTicket));
 
     const Texture& texture = GetTexture();
     texture.Bind(0);
 
-    Shader unlitShader;
-    ASSERT(unlitShader.Load(UNLIT_SHADER_PATH), "Failed to load shader at path \"%s\"", UNLIT_SHADER_PATH);
-    ASSERT(unlitShader.Init(), "Failed to initialize shader at path \"%s\"", UNLIT_SHADER_PATH);
+    Shader& unlitShader = *resourceManager.Get(resourceLoader.GetHandle<Shader>(shaderTicket));
 
     unlitShader.Use();
     unlitShader.SetUniformInt("u_diffuse", 0);
@@ -110,16 +257,44 @@ int main()
     Vector3   camPos(0.f, 1.8f, 2.f);
     Transform camTransform(camPos, Quaternion::identity(), Vector3::one());
 
-    const Vector3 testPos      = camPos + Vector3::front();
-    const Matrix4 testModelMat = translation(testPos) * scaling(1.5f, .5f, .1f);
+    World world;
+    world.CreateEntity(Transform(Vector3(-1.f, .5f, 0.f), Quaternion::identity(), Vector3::one()),
+        ModelRenderer{ &model, Color::white });
+    world.CreateEntity(Transform(Vector3(1.f, .5f, 0.f), Quaternion::identity(), Vector3::one()),
+        ModelRenderer{ &model, Color::red }, Spinner{ 20_deg, 0_deg });
 
-    Camera cam(projMat);
+    const Vector3 testPos = camPos + Vector3::front();
+    world.CreateEntity(Transform(testPos, Quaternion::identity(), Vector3(1.5f, .5f, .1f)),
+        ModelRenderer{ &model, Color::yellow });
+
+    // The ring's cubes are instantiated from a prefab in a single batch, then spread around the scene. Their mesh is
+    // uploaded once here, and only shared by the instances
+    Prefab ringCubePrefab;
+    ringCubePrefab.Add(Transform(Vector3::zero(), Quaternion::identity(), Vector3::one() * .2f))
+                  .Add(MeshRenderer{ Shared<Mesh>::Make(model.GetMesh(0)), Color::green })
+                  .Add(Spinner{ 90_deg, 0_deg });
 
-    Degree angle;
+    const std::vector<Entity> ringCubes = ringCubePrefab.Instantiate(world, RING_CUBE_COUNT);
+
+    for (size_t i = 0; i < ringCubes.size(); ++i)
+    {
+        const Radian angle = Degree(360.f * static_cast<float>(i) / static_cast<float>(ringCubes.size()));
+        world.GetComponent<Transform>(ringCubes[i])->setPosition(
+            Vector3(cos(angle) * RING_RADIUS, .1f, sin(angle) * RING_RADIUS));
+    }
+
+    View<const Transform, const ModelRenderer> modelView = world.GetView<const Transform, const ModelRenderer>();
+    View<const Transform, const MeshRenderer>  meshView  = world.GetView<const Transform, const MeshRenderer>();
+
+    Camera cam(projMat);
 
     cam.SetClearColor(Color::gray);
 
-    Timer timer;
+    Timer      timer;
+    FrameStats frameStats;
+
+    if (!frameStats.OpenCsv(FRAME_STATS_PATH))
+        SV_LOG_WARNING("Failed to open frame stats file \"%s\"", FRAME_STATS_PATH);
 
     //event and inputs
     using namespace Core;
@@ -128,6 +303,29 @@ int main()
 
     EventManager& em = EventManager::GetInstance();
     InputManager& im = InputManager::GetInstance();
+    InputRecorder& recorder = InputRecorder::GetInstance();
+
+    // "--record <path>" saves the session's input, "--replay <path>" plays it back and quits once it ends
+    for (int i = 1; i + 1 < p_argc; i += 2)
+    {
+        const char* path = p_argv[i + 1];
+
+        if (std::strcmp(p_argv[i], "--record") == 0)
+        {
+            recorder.StartRecording(path);
+        }
+        else if (std::strcmp(p_argv[i], "--replay") == 0)
+        {
+            const bool isLoaded = recorder.StartReplay(path);
+            ASSERT(isLoaded, "Failed to load input recording \"%s\"", path);
+        }
+    }
+
+    // Recorded frames must advance by the same time on every run
+    const bool isReplay = recorder.IsReplaying();
+
+    if (recorder.GetMode() != EInputRecorderMode::NONE)
+        timer.setFixedDeltaTime(INPUT_RECORD_STEP);
 
     AddEvent::EventDelegate printAdd = [](int i, int j)
     {
@@ -145,94 +343,33 @@ int main()
     im.AddInputEventBinding<AddEvent>(a, &AddInputTranslate);
     im.AddInputEventBinding<AddEvent>(b, &AddInputTranslate);
     //mouse, &AddMouseTranslate
-    im.AddInputEventBinding<AddEvent>(mouse, &AddMouseTranslate);
+    im.AddInputEventBinding<AddEvent>(mouse, &AddMouseTranslate, true);
     //im.CallInput(b, 'b');
 
-    Vector2 moveInput, rotateInput;
-
-    im.AddInputBinding({ EKey::W, EKeyState::PRESSED, EInputModifier() }, [&moveInput](const char)
-    {
-        ++moveInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::W, EKeyState::RELEASED, EInputModifier() }, [&moveInput](const char)
-    {
-        --moveInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::S, EKeyState::PRESSED, EInputModifier() }, [&moveInput](const char)
-    {
-        --moveInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::S, EKeyState::RELEASED, EInputModifier() }, [&moveInput](const char)
-    {
-        ++moveInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::A, EKeyState::PRESSED, EInputModifier() }, [&moveInput](const char)
-    {
-        --moveInput.m_x;
-    });
-
-    im.AddInputBinding({ EKey::A, EKeyState::RELEASED, EInputModifier() }, [&moveInput](const char)
-    {
-        ++moveInput.m_x;
-    });
-
-    im.AddInputBinding({ EKey::D, EKeyState::PRESSED, EInputModifier() }, [&moveInput](const char)
-    {
-        ++moveInput.m_x;
-    });
-
-    im.AddInputBinding({ EKey::D, EKeyState::RELEASED, EInputModifier() }, [&moveInput](const char)
-    {
-        --moveInput.m_x;
-    });
-
-    im.AddInputBinding({ EKey::UP, EKeyState::PRESSED, EInputModifier() }, [&rotateInput](const char)
-    {
-        ++rotateInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::UP, EKeyState::RELEASED, EInputModifier() }, [&rotateInput](const char)
-    {
-        --rotateInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::DOWN, EKeyState::PRESSED, EInputModifier() }, [&rotateInput](const char)
-    {
-        --rotateInput.m_y;
-    });
-
-    im.AddInputBinding({ EKey::DOWN, EKeyState::RELEASED, EInputModifier() }, [&rotateInput](const char)
+    im.AddInputBinding({ EKey::R, EKeyState::RELEASED, {} }, [&camTransform, &camPos](const char)
     {
-        ++rotateInput.m_y;
+        camTransform.setAll(camPos, Quaternion::identity(), Vector3::one());
     });
 
-    im.AddInputBinding({ EKey::LEFT, EKeyState::PRESSED, EInputModifier() }, [&rotateInput](const char)
+    im.AddInputBinding({ EKey::P, EKeyState::RELEASED, {} }, [](const char)
     {
-        --rotateInput.m_x;
-    });
+        Profiler& profiler = Profiler::GetInstance();
 
-    im.AddInputBinding({ EKey::LEFT, EKeyState::RELEASED, EInputModifier() }, [&rotateInput](const char)
-    {
-        ++rotateInput.m_x;
+        if (!profiler.IsCapturing())
+            profiler.BeginCapture();
+        else if (profiler.EndCapture(PROFILER_CAPTURE_PATH))
+            SV_LOG("Saved profiler capture to \"%s\"", PROFILER_CAPTURE_PATH);
     });
 
-    im.AddInputBinding({ EKey::RIGHT, EKeyState::PRESSED, EInputModifier() }, [&rotateInput](const char)
+    im.AddInputBinding({ EKey::M, EKeyState::RELEASED, {} }, [](const char)
     {
-        ++rotateInput.m_x;
-    });
+        const FrameMemoryStats& stats = FrameAllocator::GetInstance().GetLastFrameStats();
 
-    im.AddInputBinding({ EKey::RIGHT, EKeyState::RELEASED, EInputModifier() }, [&rotateInput](const char)
-    {
-        --rotateInput.m_x;
-    });
+        SV_LOG("Last frame: %zu frame allocator bytes (%zu overflows), %zu heap allocations, %zu heap frees",
+            stats.m_frameBytes, stats.m_frameOverflowCount, stats.m_heapAllocationCount, stats.m_heapFreeCount);
 
-    im.AddInputBinding({ EKey::R, EKeyState::RELEASED, {} }, [&camTransform, &camPos](const char)
-    {
-        camTransform.setAll(camPos, Quaternion::identity(), Vector3::one());
+        IObjectPool::LogAllStats();
+        MemoryTracker::LogReport();
     });
 
     im.AddInputBinding({ EKey::ESCAPE, EKeyState::RELEASED, {} }, [&window](const char)
@@ -242,18 +379,44 @@ int main()
 
     while (!glfwWindowShouldClose(window))
     {
+        Profiler::GetInstance().EndFrame();
+        GpuProfiler::GetInstance().EndFrame();
+        FrameAllocator::GetInstance().EndFrame();
+        MemoryTracker::EndFrame();
+        SV_PROFILE_SCOPE("Frame");
+
         timer.tick();
+        frameStats.AddFrame(timer);
+        AddSubsystemTimings(frameStats);
+        recorder.NextFrame();
         glfwPollEvents();
+        im.Update();
+        em.FlushQueue();
 
-        angle += 20_deg * timer.getDeltaTime();
+        JobSystem::GetInstance().ExecuteMainThreadJobs();
 
-        const Matrix4 modelRot  = rotation(angle, Vector3::up());
-        const Matrix4 modelMat1 = translation(-1.f, .5f, 0.f);
-        const Matrix4 modelMat2 = translation(1.f, .5f, 0.f) * modelRot;
+        if (isReplay && !recorder.IsReplaying())
+            glfwSetWindowShouldClose(window, true);
+
+        world.GetQuery<Spinner>().ForEach([&timer, &world](const Entity p_entity, Spinner& p_spinner)
+        {
+            p_spinner.m_angle += p_spinner.m_speed * timer.getDeltaTime();
+
+            if (Transform* transform = world.GetComponent<Transform>(p_entity))
+                transform->setRotation(Quaternion(p_spinner.m_angle, Vector3::up()));
+        });
 
         Vector3    newPos = camTransform.getPosition();
         Quaternion newRot = camTransform.getRotation();
 
+        const Vector2 moveInput(
+            static_cast<float>(im.IsKeyDown(EKey::D)) - static_cast<float>(im.IsKeyDown(EKey::A)),
+            static_cast<float>(im.IsKeyDown(EKey::W)) - static_cast<float>(im.IsKeyDown(EKey::S)));
+
+        const Vector2 rotateInput(
+            static_cast<float>(im.IsKeyDown(EKey::RIGHT)) - static_cast<float>(im.IsKeyDown(EKey::LEFT)),
+            static_cast<float>(im.IsKeyDown(EKey::UP)) - static_cast<float>(im.IsKeyDown(EKey::DOWN)));
+
         if (moveInput.magnitudeSquared() > 0.f)
         {
             const Vector3 moveDir = moveInput.m_x * camTransform.worldRight() + moveInput.m_y * camTransform.worldBack();
@@ -274,30 +437,41 @@ int main()
         camTransform.setAll(newPos, newRot, Vector3::one());
 
         cam.SetView(camTransform.getWorldMatrix().inverse());
+
+        SV_PROFILE_SCOPE("Render");
+        SV_GPU_PROFILE_SCOPE("Render");
         cam.Clear();
 
         const Frustum camFrustum     = cam.GetFrustum();
         const Matrix4 viewProjection = cam.GetViewProjection();
 
-        unlitShader.Use();
-        unlitShader.SetUniformMat4("u_mvp", viewProjection * modelMat1);
-        unlitShader.SetUniformVec4("u_tint", Color::white);
-        DrawModel(model);
+        DrawList drawList(FrameAllocator::GetInstance().GetResource());
 
-        unlitShader.SetUniformMat4("u_mvp", viewProjection * modelMat2);
-        unlitShader.SetUniformVec4("u_tint", Color::red);
-        DrawModel(model);
+        CullRenderers(modelView, camFrustum, viewProjection, drawList);
+        CullRenderers(meshView, camFrustum, viewProjection, drawList);
 
-        if (camFrustum.Intersects(TransformBoundingBox(model.GetBoundingBox(), testModelMat)))
-        {
-            unlitShader.SetUniformMat4("u_mvp", viewProjection * testModelMat);
-            unlitShader.SetUniformVec4("u_tint", Color::yellow);
-            DrawModel(model);
-        }
+        unlitShader.Use();
+        DrawAll(unlitShader, drawList);
 
         glfwSwapBuffers(window);
     }
 
+    if (recorder.GetMode() == EInputRecorderMode::RECORDING)
+    {
+        if (recorder.StopRecording())
+            SV_LOG("Saved input recording");
+        else
+            SV_LOG_WARNING("Failed to save input recording");
+    }
+
+    SV_LOG("%s", frameStats.ToString().c_str());
+    frameStats.WriteSummaryCsv(FRAME_SUMMARY_PATH);
+
+    // The shared mesh's buffers must be released while the context is still alive
+    world.ClearComponents<MeshRenderer>();
+    ringCubePrefab.Remove<MeshRenderer>();
+
+    GpuProfiler::GetInstance().Shutdown();
     glfwDestroyWindow(window);
     glfwTerminate();
 